@@ -0,0 +1,216 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeTestsUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeTests
+{
+	template<typename T>
+	void AppendRawValue(TArray<uint8>& Bytes, const T Value)
+	{
+		Bytes.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	// more than 4 components go through the generic kernel
+	struct FglTFRuntimeTestMatrix3
+	{
+		float M[9];
+
+		float& operator[](const int32 Index) { return M[Index]; }
+
+		bool operator==(const FglTFRuntimeTestMatrix3& Other) const
+		{
+			return FMemory::Memcmp(M, Other.M, sizeof(M)) == 0;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAccessorDecodingTest, "glTFRuntime.Parser.AccessorDecoding", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAccessorDecodingTest::RunTest(const FString& Parameters)
+{
+	// more than two decoding batches, the last one is partial
+	const int32 Count = 2500;
+
+	FRandomStream RandomStream(6);
+	glTFRuntimeTests::FglTFRuntimeTestBuffer Buffer;
+	TArray<FString> BufferViews;
+	TArray<FString> Accessors;
+	TSharedRef<FJsonObject> AccessorsObject = MakeShared<FJsonObject>();
+
+	auto AddAccessor = [&](const FString& Name, const TArray<uint8>& Bytes, const int32 ByteStride, const int32 ComponentType, const FString& Type, const FString& Extra)
+		{
+			const int32 Offset = Buffer.Append(Bytes.GetData(), Bytes.Num());
+			const FString JsonByteStride = ByteStride > 0 ? FString::Printf(TEXT(",\"byteStride\":%d"), ByteStride) : FString();
+			BufferViews.Add(FString::Printf(TEXT("{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d%s}"), Offset, Bytes.Num(), *JsonByteStride));
+			AccessorsObject->SetNumberField(Name, Accessors.Num());
+			Accessors.Add(FString::Printf(TEXT("{\"bufferView\":%d,\"componentType\":%d,\"count\":%d,\"type\":\"%s\"%s}"), BufferViews.Num() - 1, ComponentType, Count, *Type, *Extra));
+		};
+
+	// float VEC3 interleaved with another float (byteStride 16)
+	TArray<uint8> FloatBytes;
+	TArray<FVector> ExpectedFloats;
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		const float X = RandomStream.FRandRange(-1000, 1000);
+		const float Y = RandomStream.FRandRange(-1000, 1000);
+		const float Z = RandomStream.FRandRange(-1000, 1000);
+		glTFRuntimeTests::AppendRawValue(FloatBytes, X);
+		glTFRuntimeTests::AppendRawValue(FloatBytes, Y);
+		glTFRuntimeTests::AppendRawValue(FloatBytes, Z);
+		glTFRuntimeTests::AppendRawValue(FloatBytes, -1.0f);
+		ExpectedFloats.Add(FVector(X, Y, Z));
+	}
+	AddAccessor("Floats", FloatBytes, 16, 5126, "VEC3", "");
+
+	// normalized UNSIGNED_BYTE VEC4, both explicit and from the default (KHR_mesh_quantization)
+	TArray<uint8> UnsignedBytes;
+	TArray<FVector4> ExpectedNormalizedUnsignedBytes;
+	TArray<FVector4> ExpectedUnsignedBytes;
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		uint8 Values[4];
+		for (int32 Component = 0; Component < 4; Component++)
+		{
+			Values[Component] = static_cast<uint8>(RandomStream.RandRange(0, 255));
+			glTFRuntimeTests::AppendRawValue(UnsignedBytes, Values[Component]);
+		}
+		ExpectedNormalizedUnsignedBytes.Add(FVector4(Values[0] / 255.f, Values[1] / 255.f, Values[2] / 255.f, Values[3] / 255.f));
+		ExpectedUnsignedBytes.Add(FVector4(Values[0], Values[1], Values[2], Values[3]));
+	}
+	AddAccessor("NormalizedUnsignedBytes", UnsignedBytes, 0, 5121, "VEC4", ",\"normalized\":true");
+	AddAccessor("UnsignedBytes", UnsignedBytes, 0, 5121, "VEC4", "");
+
+	// normalized SHORT VEC2 (-32768 is clamped to -1)
+	TArray<uint8> ShortBytes;
+	TArray<FVector2D> ExpectedShorts;
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		const int16 X = Index == 0 ? -32768 : static_cast<int16>(RandomStream.RandRange(-32768, 32767));
+		const int16 Y = static_cast<int16>(RandomStream.RandRange(-32768, 32767));
+		glTFRuntimeTests::AppendRawValue(ShortBytes, X);
+		glTFRuntimeTests::AppendRawValue(ShortBytes, Y);
+		ExpectedShorts.Add(FVector2D(FMath::Max(X / 32767.f, -1.f), FMath::Max(Y / 32767.f, -1.f)));
+	}
+	AddAccessor("NormalizedShorts", ShortBytes, 0, 5122, "VEC2", ",\"normalized\":true");
+
+	// BYTE VEC3 (3 bytes elements)
+	TArray<uint8> ByteBytes;
+	TArray<FVector> ExpectedBytes;
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		int8 Values[3];
+		for (int32 Component = 0; Component < 3; Component++)
+		{
+			Values[Component] = static_cast<int8>(RandomStream.RandRange(-128, 127));
+			glTFRuntimeTests::AppendRawValue(ByteBytes, Values[Component]);
+		}
+		ExpectedBytes.Add(FVector(Values[0], Values[1], Values[2]));
+	}
+	AddAccessor("Bytes", ByteBytes, 0, 5120, "VEC3", "");
+
+	// UNSIGNED_SHORT SCALAR
+	TArray<uint8> ScalarBytes;
+	TArray<int32> ExpectedScalars;
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		const uint16 Value = static_cast<uint16>(RandomStream.RandRange(0, 65535));
+		glTFRuntimeTests::AppendRawValue(ScalarBytes, Value);
+		ExpectedScalars.Add(Value);
+	}
+	AddAccessor("Scalars", ScalarBytes, 0, 5123, "SCALAR", "");
+
+	// float MAT3
+	TArray<uint8> MatrixBytes;
+	TArray<glTFRuntimeTests::FglTFRuntimeTestMatrix3> ExpectedMatrices;
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		glTFRuntimeTests::FglTFRuntimeTestMatrix3& Matrix = ExpectedMatrices.AddDefaulted_GetRef();
+		for (int32 Component = 0; Component < 9; Component++)
+		{
+			Matrix[Component] = RandomStream.FRandRange(-1, 1);
+			glTFRuntimeTests::AppendRawValue(MatrixBytes, Matrix[Component]);
+		}
+	}
+	AddAccessor("Matrices", MatrixBytes, 0, 5126, "MAT3", "");
+
+	const FString Json = FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"accessors\":[%s],\"bufferViews\":[%s],\"buffers\":[{\"byteLength\":%d,\"uri\":\"%s\"}]}"),
+		*FString::Join(Accessors, TEXT(",")), *FString::Join(BufferViews, TEXT(",")), Buffer.Bytes.Num(), *Buffer.ToDataUri());
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromString(Json, FglTFRuntimeConfig());
+	if (!TestTrue(TEXT("Document is parsed"), Parser.IsValid()))
+	{
+		return false;
+	}
+
+	TArray<FVector> Floats;
+	if (TestTrue(TEXT("FLOAT VEC3 with byteStride"), Parser->BuildFromAccessorField(AccessorsObject, "Floats", Floats, { 3 }, { 5126 }, INDEX_NONE, false, nullptr)))
+	{
+		TestTrue(TEXT("FLOAT VEC3 with byteStride values"), Floats == ExpectedFloats);
+	}
+
+	TArray<FVector> ScaledFloats;
+	if (TestTrue(TEXT("FLOAT VEC3 with filter"), Parser->BuildFromAccessorField(AccessorsObject, "Floats", ScaledFloats, { 3 }, { 5126 }, [](FVector Value) -> FVector { return Value * 2; }, INDEX_NONE, false, nullptr)))
+	{
+		TArray<FVector> ExpectedScaledFloats;
+		for (const FVector& Value : ExpectedFloats)
+		{
+			ExpectedScaledFloats.Add(Value * 2);
+		}
+		TestTrue(TEXT("FLOAT VEC3 with filter values"), ScaledFloats == ExpectedScaledFloats);
+	}
+
+	TArray<FVector4> NormalizedUnsignedBytes;
+	if (TestTrue(TEXT("Normalized UNSIGNED_BYTE VEC4"), Parser->BuildFromAccessorField(AccessorsObject, "NormalizedUnsignedBytes", NormalizedUnsignedBytes, { 4 }, { 5121 }, INDEX_NONE, false, nullptr)))
+	{
+		TestTrue(TEXT("Normalized UNSIGNED_BYTE VEC4 values"), NormalizedUnsignedBytes == ExpectedNormalizedUnsignedBytes);
+	}
+
+	TArray<FVector4> DefaultNormalizedUnsignedBytes;
+	if (TestTrue(TEXT("Default normalized UNSIGNED_BYTE VEC4"), Parser->BuildFromAccessorField(AccessorsObject, "UnsignedBytes", DefaultNormalizedUnsignedBytes, { 4 }, { 5121 }, INDEX_NONE, true, nullptr)))
+	{
+		TestTrue(TEXT("Default normalized UNSIGNED_BYTE VEC4 values"), DefaultNormalizedUnsignedBytes == ExpectedNormalizedUnsignedBytes);
+	}
+
+	TArray<FVector4> UnsignedBytesValues;
+	if (TestTrue(TEXT("UNSIGNED_BYTE VEC4"), Parser->BuildFromAccessorField(AccessorsObject, "UnsignedBytes", UnsignedBytesValues, { 4 }, { 5121 }, INDEX_NONE, false, nullptr)))
+	{
+		TestTrue(TEXT("UNSIGNED_BYTE VEC4 values"), UnsignedBytesValues == ExpectedUnsignedBytes);
+	}
+
+	TArray<FVector2D> NormalizedShorts;
+	if (TestTrue(TEXT("Normalized SHORT VEC2"), Parser->BuildFromAccessorField(AccessorsObject, "NormalizedShorts", NormalizedShorts, { 2 }, { 5122 }, INDEX_NONE, false, nullptr)))
+	{
+		TestTrue(TEXT("Normalized SHORT VEC2 values"), NormalizedShorts == ExpectedShorts);
+	}
+
+	TArray<FVector> Bytes;
+	if (TestTrue(TEXT("BYTE VEC3"), Parser->BuildFromAccessorField(AccessorsObject, "Bytes", Bytes, { 3 }, { 5120 }, INDEX_NONE, false, nullptr)))
+	{
+		TestTrue(TEXT("BYTE VEC3 values"), Bytes == ExpectedBytes);
+	}
+
+	TArray<int32> Scalars;
+	if (TestTrue(TEXT("UNSIGNED_SHORT SCALAR"), Parser->BuildFromAccessorField(AccessorsObject, "Scalars", Scalars, { 5123 }, INDEX_NONE, false, nullptr)))
+	{
+		TestTrue(TEXT("UNSIGNED_SHORT SCALAR values"), Scalars == ExpectedScalars);
+	}
+
+	TArray<glTFRuntimeTests::FglTFRuntimeTestMatrix3> Matrices;
+	if (TestTrue(TEXT("FLOAT MAT3"), Parser->BuildFromAccessorField(AccessorsObject, "Matrices", Matrices, { 9 }, { 5126 }, INDEX_NONE, false, nullptr)))
+	{
+		TestTrue(TEXT("FLOAT MAT3 values"), Matrices == ExpectedMatrices);
+	}
+
+	// unsupported elements and component types are rejected
+	TArray<FVector> Rejected;
+	TestFalse(TEXT("Unsupported elements are rejected"), Parser->BuildFromAccessorField(AccessorsObject, "Floats", Rejected, { 4 }, { 5126 }, INDEX_NONE, false, nullptr));
+	TestFalse(TEXT("Unsupported component types are rejected"), Parser->BuildFromAccessorField(AccessorsObject, "Bytes", Rejected, { 3 }, { 5126 }, INDEX_NONE, false, nullptr));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,125 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeTests
+{
+	// the linear scan used before the binary search, the reference for the expected results
+	float FindBestFramesLinear(const TArray<float>& FramesTimes, float WantedTime, int32& FirstIndex, int32& SecondIndex)
+	{
+		SecondIndex = INDEX_NONE;
+		for (int32 i = 0; i < FramesTimes.Num(); i++)
+		{
+			float TimeValue = FramesTimes[i] - FramesTimes[0];
+			if (FMath::IsNearlyEqual(TimeValue, WantedTime))
+			{
+				FirstIndex = i;
+				SecondIndex = i;
+				return 0;
+			}
+			else if (TimeValue > WantedTime)
+			{
+				SecondIndex = i;
+				break;
+			}
+		}
+
+		if (SecondIndex == INDEX_NONE)
+		{
+			SecondIndex = FramesTimes.Num() - 1;
+		}
+
+		if (SecondIndex == 0)
+		{
+			FirstIndex = 0;
+			return 1.f;
+		}
+
+		FirstIndex = SecondIndex - 1;
+
+		return ((WantedTime + FramesTimes[0]) - FramesTimes[FirstIndex]) / (FramesTimes[SecondIndex] - FramesTimes[FirstIndex]);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeFindBestFramesTest, "glTFRuntime.Animation.FindBestFrames", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeFindBestFramesTest::RunTest(const FString& Parameters)
+{
+	FRandomStream RandomStream(11);
+
+	auto CheckTimeline = [&](const FString& What, const TArray<float>& FramesTimes, const TArray<float>& WantedTimes)
+		{
+			int32 Mismatches = 0;
+			for (const float WantedTime : WantedTimes)
+			{
+				int32 ExpectedFirstIndex = INDEX_NONE;
+				int32 ExpectedSecondIndex = INDEX_NONE;
+				const float ExpectedAlpha = glTFRuntimeTests::FindBestFramesLinear(FramesTimes, WantedTime, ExpectedFirstIndex, ExpectedSecondIndex);
+
+				int32 FirstIndex = INDEX_NONE;
+				int32 SecondIndex = INDEX_NONE;
+				const float Alpha = FglTFRuntimeParser::FindBestFramesInTimeline(FramesTimes.Num(), [&FramesTimes](const int32 Index) { return FramesTimes[Index]; }, WantedTime, FirstIndex, SecondIndex);
+
+				if (FirstIndex != ExpectedFirstIndex || SecondIndex != ExpectedSecondIndex || !FMath::IsNearlyEqual(Alpha, ExpectedAlpha))
+				{
+					if (Mismatches == 0)
+					{
+						AddError(FString::Printf(TEXT("%s: time %f gives frames %d-%d (alpha %f), expected %d-%d (alpha %f)"), *What, WantedTime, FirstIndex, SecondIndex, Alpha, ExpectedFirstIndex, ExpectedSecondIndex, ExpectedAlpha));
+					}
+					Mismatches++;
+				}
+			}
+			TestEqual(FString::Printf(TEXT("%s mismatches"), *What), Mismatches, 0);
+		};
+
+	// explicit cases: before the start, on keys, between keys, duplicated keys and past the end
+	const TArray<float> SimpleTimeline = { 0.5f, 1.0f, 1.0f, 2.0f, 4.5f };
+	CheckTimeline(TEXT("Simple timeline"), SimpleTimeline, { -1.0f, 0.0f, 0.25f, 0.5f, 0.75f, 1.5f, 2.0f, 3.0f, 4.0f, 5.0f });
+
+	int32 FirstIndex = INDEX_NONE;
+	int32 SecondIndex = INDEX_NONE;
+	float Alpha = FglTFRuntimeParser::FindBestFramesInTimeline(SimpleTimeline.Num(), [&SimpleTimeline](const int32 Index) { return SimpleTimeline[Index]; }, 0.5f, FirstIndex, SecondIndex);
+	TestTrue(TEXT("First of duplicated keys is an exact match"), FirstIndex == 1 && SecondIndex == 1 && Alpha == 0);
+	Alpha = FglTFRuntimeParser::FindBestFramesInTimeline(SimpleTimeline.Num(), [&SimpleTimeline](const int32 Index) { return SimpleTimeline[Index]; }, 2.75f, FirstIndex, SecondIndex);
+	TestTrue(TEXT("Interpolation between keys"), FirstIndex == 3 && SecondIndex == 4 && FMath::IsNearlyEqual(Alpha, 0.5f));
+	FglTFRuntimeParser::FindBestFramesInTimeline(SimpleTimeline.Num(), [&SimpleTimeline](const int32 Index) { return SimpleTimeline[Index]; }, 10.0f, FirstIndex, SecondIndex);
+	TestTrue(TEXT("Times past the end clamp to the last key"), FirstIndex == 3 && SecondIndex == 4);
+
+	const TArray<float> SingleKeyTimeline = { 1.0f };
+	CheckTimeline(TEXT("Single key timeline"), SingleKeyTimeline, { -1.0f, 0.0f, 1.0f });
+
+	// a long resampled clip (30 fps keys) and a sparse timeline with random gaps and duplicated keys
+	TArray<float> ClipTimeline;
+	for (int32 Frame = 0; Frame < 3000; Frame++)
+	{
+		ClipTimeline.Add(Frame / 30.0f);
+	}
+
+	TArray<float> SparseTimeline = { RandomStream.FRandRange(0, 2) };
+	for (int32 Frame = 1; Frame < 1000; Frame++)
+	{
+		SparseTimeline.Add(SparseTimeline.Last() + (RandomStream.RandRange(0, 9) == 0 ? 0.0f : RandomStream.FRandRange(0.001f, 0.5f)));
+	}
+
+	for (const TArray<float>* Timeline : { &ClipTimeline, &SparseTimeline })
+	{
+		const float Duration = Timeline->Last() - (*Timeline)[0];
+		TArray<float> WantedTimes;
+		for (int32 Frame = 0; Frame < Timeline->Num(); Frame++)
+		{
+			WantedTimes.Add((*Timeline)[Frame] - (*Timeline)[0]);
+		}
+		for (int32 Sample = 0; Sample < 5000; Sample++)
+		{
+			WantedTimes.Add(RandomStream.FRandRange(-0.1f, Duration + 0.1f));
+		}
+		CheckTimeline(Timeline == &ClipTimeline ? TEXT("Clip timeline") : TEXT("Sparse timeline"), *Timeline, WantedTimes);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,145 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeTestsAsyncReceiver.h"
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeTestsUtils.h"
+
+UglTFRuntimeTestsAsyncReceiver::UglTFRuntimeTestsAsyncReceiver()
+{
+	NumStaticMeshes = 0;
+	NumSkeletalMeshes = 0;
+	NumFailures = 0;
+}
+
+void UglTFRuntimeTestsAsyncReceiver::OnStaticMeshLoaded(UStaticMesh* StaticMesh)
+{
+	if (StaticMesh)
+	{
+		NumStaticMeshes++;
+	}
+	else
+	{
+		NumFailures++;
+	}
+}
+
+void UglTFRuntimeTestsAsyncReceiver::OnSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh)
+{
+	if (SkeletalMesh)
+	{
+		NumSkeletalMeshes++;
+	}
+	else
+	{
+		NumFailures++;
+	}
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeConcurrentMeshLoadsTest, "glTFRuntime.Parser.ConcurrentMeshLoads", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeConcurrentMeshLoadsTest::RunTest(const FString& Parameters)
+{
+	const int32 GridSize = 64;
+	const int32 NumMeshes = 4;
+	const int32 NumLoads = 32;
+
+	// all of the meshes share the same accessors, so every load hits the same buffers
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromString(glTFRuntimeTests::BuildSkinnedGridAsset(GridSize, NumMeshes, "Root"), FglTFRuntimeConfig());
+	if (!TestTrue(TEXT("Document is parsed"), Parser.IsValid()))
+	{
+		return false;
+	}
+
+	// decode runtime LODs from many threads at once (buffers, accessors, LODs and nodes caches are shared)
+	TArray<int32> NumVertices;
+	NumVertices.Init(INDEX_NONE, NumLoads);
+	ParallelFor(NumLoads, [&](const int32 LoadIndex)
+		{
+			FglTFRuntimeMeshLOD RuntimeLOD;
+			bool bLoaded = false;
+			if (LoadIndex % 2 == 0)
+			{
+				bLoaded = Parser->LoadMeshAsRuntimeLOD(LoadIndex % NumMeshes, RuntimeLOD, FglTFRuntimeMaterialsConfig());
+			}
+			else
+			{
+				int32 SkinIndex = INDEX_NONE;
+				FglTFRuntimeSkeletonConfig SkeletonConfig;
+				bLoaded = Parser->LoadSkinnedMeshRecursiveAsRuntimeLOD("Root", SkinIndex, {}, RuntimeLOD, FglTFRuntimeMaterialsConfig(), SkeletonConfig, EglTFRuntimeRecursiveMode::Ignore);
+			}
+
+			if (bLoaded)
+			{
+				NumVertices[LoadIndex] = 0;
+				for (const FglTFRuntimePrimitive& Primitive : RuntimeLOD.Primitives)
+				{
+					NumVertices[LoadIndex] += Primitive.Positions.Num();
+				}
+			}
+		});
+
+	for (int32 LoadIndex = 0; LoadIndex < NumLoads; LoadIndex++)
+	{
+		if (LoadIndex % 2 == 0)
+		{
+			TestEqual(FString::Printf(TEXT("Runtime LOD %d vertices"), LoadIndex), NumVertices[LoadIndex], GridSize * GridSize);
+		}
+		else
+		{
+			TestEqual(FString::Printf(TEXT("Skinned runtime LOD %d vertices"), LoadIndex), NumVertices[LoadIndex], NumVertices[1]);
+		}
+	}
+	TestTrue(TEXT("Skinned runtime LODs are loaded"), NumVertices[1] > 0);
+
+	// then build static and skeletal meshes concurrently on the task queue, the cache is disabled so every load decodes its own mesh
+	UglTFRuntimeTestsAsyncReceiver* Receiver = NewObject<UglTFRuntimeTestsAsyncReceiver>();
+	Receiver->AddToRoot();
+
+	FglTFRuntimeStaticMeshAsync StaticMeshDelegate;
+	StaticMeshDelegate.BindUFunction(Receiver, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeTestsAsyncReceiver, OnStaticMeshLoaded));
+	FglTFRuntimeSkeletalMeshAsync SkeletalMeshDelegate;
+	SkeletalMeshDelegate.BindUFunction(Receiver, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeTestsAsyncReceiver, OnSkeletalMeshLoaded));
+
+	FglTFRuntimeStaticMeshConfig StaticMeshConfig;
+	StaticMeshConfig.CacheMode = EglTFRuntimeCacheMode::None;
+	FglTFRuntimeSkeletalMeshConfig SkeletalMeshConfig;
+	SkeletalMeshConfig.CacheMode = EglTFRuntimeCacheMode::None;
+
+	for (int32 LoadIndex = 0; LoadIndex < NumLoads; LoadIndex++)
+	{
+		Parser->LoadStaticMeshAsync(LoadIndex % NumMeshes, StaticMeshDelegate, StaticMeshConfig);
+		Parser->LoadSkeletalMeshAsync(LoadIndex % NumMeshes, 0, SkeletalMeshDelegate, SkeletalMeshConfig);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Parser, Receiver, NumLoads, StartTime]() -> bool
+		{
+			const bool bCompleted = Receiver->NumStaticMeshes + Receiver->NumSkeletalMeshes + Receiver->NumFailures >= NumLoads * 2;
+			if (!bCompleted && FPlatformTime::Seconds() - StartTime < 60)
+			{
+				return false;
+			}
+
+			TestTrue(TEXT("Async loads completed"), bCompleted);
+			TestEqual(TEXT("Static meshes"), Receiver->NumStaticMeshes, NumLoads);
+			TestEqual(TEXT("Skeletal meshes"), Receiver->NumSkeletalMeshes, NumLoads);
+			TestEqual(TEXT("Failed loads"), Receiver->NumFailures, 0);
+			if (Receiver->NumFailures > 0)
+			{
+				for (const FString& Error : Parser->GetErrors())
+				{
+					AddError(Error);
+				}
+			}
+
+			Receiver->RemoveFromRoot();
+			return true;
+		}));
+
+	return true;
+}
+
+#endif
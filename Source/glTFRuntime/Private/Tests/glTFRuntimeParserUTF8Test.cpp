@@ -0,0 +1,118 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeTestsUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeTests
+{
+	TArray<uint8> StringToUTF8(const FString& String)
+	{
+		FTCHARToUTF8 UTF8String(*String);
+		return TArray<uint8>(reinterpret_cast<const uint8*>(UTF8String.Get()), UTF8String.Length());
+	}
+
+	TArray<uint8> BuildGLB(const FString& Json, const TArray<uint8>& BinaryChunk)
+	{
+		// chunks are 4 bytes aligned, json is padded with spaces
+		TArray<uint8> JsonChunk = StringToUTF8(Json);
+		while (JsonChunk.Num() % 4)
+		{
+			JsonChunk.Add(' ');
+		}
+
+		TArray<uint8> PaddedBinaryChunk = BinaryChunk;
+		while (PaddedBinaryChunk.Num() % 4)
+		{
+			PaddedBinaryChunk.Add(0);
+		}
+
+		TArray<uint8> GLB;
+		auto AppendUInt32 = [&GLB](const uint32 Value)
+			{
+				GLB.Append(reinterpret_cast<const uint8*>(&Value), sizeof(uint32));
+			};
+
+		AppendUInt32(0x46546C67);
+		AppendUInt32(2);
+		AppendUInt32(12 + 8 + JsonChunk.Num() + 8 + PaddedBinaryChunk.Num());
+		AppendUInt32(JsonChunk.Num());
+		AppendUInt32(0x4E4F534A);
+		GLB.Append(JsonChunk);
+		AppendUInt32(PaddedBinaryChunk.Num());
+		AppendUInt32(0x004E4942);
+		GLB.Append(PaddedBinaryChunk);
+
+		return GLB;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeParserUTF8Test, "glTFRuntime.Parser.FromUTF8", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeParserUTF8Test::RunTest(const FString& Parameters)
+{
+	const FglTFRuntimeConfig LoaderConfig;
+	const FString AsciiRootName = TEXT("Root");
+	const FString NonAsciiRootName = TEXT("Ra\u00EDz_\u6839");
+
+	auto CheckParser = [&](const FString& What, TSharedPtr<FglTFRuntimeParser> Parser, const FString& ExpectedRootName, const TArray<FVector>& ExpectedPositions)
+		{
+			if (!TestTrue(FString::Printf(TEXT("%s is parsed"), *What), Parser.IsValid()))
+			{
+				return;
+			}
+
+			FglTFRuntimeNode RootNode;
+			if (TestTrue(FString::Printf(TEXT("%s root node"), *What), Parser->LoadNode(0, RootNode)))
+			{
+				TestEqual(FString::Printf(TEXT("%s root node name"), *What), RootNode.Name, ExpectedRootName);
+			}
+
+			FglTFRuntimeMeshLOD RuntimeLOD;
+			if (TestTrue(FString::Printf(TEXT("%s mesh"), *What), Parser->LoadMeshAsRuntimeLOD(0, RuntimeLOD, FglTFRuntimeMaterialsConfig()) && RuntimeLOD.Primitives.Num() == 1))
+			{
+				TestTrue(FString::Printf(TEXT("%s positions"), *What), RuntimeLOD.Primitives[0].Positions == ExpectedPositions);
+			}
+		};
+
+	// the TCHAR path is the reference
+	const FString Json = glTFRuntimeTests::BuildSkinnedGridAsset(8, 1, AsciiRootName);
+	TSharedPtr<FglTFRuntimeParser> ReferenceParser = FglTFRuntimeParser::FromString(Json, LoaderConfig);
+	FglTFRuntimeMeshLOD ReferenceLOD;
+	if (!TestTrue(TEXT("Reference document is parsed"), ReferenceParser.IsValid() && ReferenceParser->LoadMeshAsRuntimeLOD(0, ReferenceLOD, FglTFRuntimeMaterialsConfig()) && ReferenceLOD.Primitives.Num() == 1))
+	{
+		return false;
+	}
+	const TArray<FVector>& ReferencePositions = ReferenceLOD.Primitives[0].Positions;
+
+	// pure ASCII documents are parsed in place
+	const TArray<uint8> JsonUTF8 = glTFRuntimeTests::StringToUTF8(Json);
+	CheckParser(TEXT("ASCII document"), FglTFRuntimeParser::FromUTF8(JsonUTF8.GetData(), JsonUTF8.Num(), LoaderConfig), AsciiRootName, ReferencePositions);
+
+	TArray<uint8> JsonUTF8WithBOM = { 0xEF, 0xBB, 0xBF };
+	JsonUTF8WithBOM.Append(JsonUTF8);
+	CheckParser(TEXT("Document with BOM"), FglTFRuntimeParser::FromUTF8(JsonUTF8WithBOM.GetData(), JsonUTF8WithBOM.Num(), LoaderConfig), AsciiRootName, ReferencePositions);
+
+	// multibyte sequences fallback to the TCHAR conversion
+	const TArray<uint8> NonAsciiJsonUTF8 = glTFRuntimeTests::StringToUTF8(glTFRuntimeTests::BuildSkinnedGridAsset(8, 1, NonAsciiRootName));
+	CheckParser(TEXT("Non-ASCII document"), FglTFRuntimeParser::FromUTF8(NonAsciiJsonUTF8.GetData(), NonAsciiJsonUTF8.Num(), LoaderConfig), NonAsciiRootName, ReferencePositions);
+
+	// GLB json chunks go through FromUTF8 too
+	TArray<uint8> BinaryChunk;
+	const FString GLBJson = glTFRuntimeTests::BuildSkinnedGridAsset(8, 1, AsciiRootName, &BinaryChunk);
+	const TArray<uint8> GLB = glTFRuntimeTests::BuildGLB(GLBJson, BinaryChunk);
+	CheckParser(TEXT("GLB"), FglTFRuntimeParser::FromBinary(GLB.GetData(), GLB.Num(), LoaderConfig), AsciiRootName, ReferencePositions);
+
+	const FString NonAsciiGLBJson = glTFRuntimeTests::BuildSkinnedGridAsset(8, 1, NonAsciiRootName, &BinaryChunk);
+	const TArray<uint8> NonAsciiGLB = glTFRuntimeTests::BuildGLB(NonAsciiGLBJson, BinaryChunk);
+	CheckParser(TEXT("Non-ASCII GLB"), FglTFRuntimeParser::FromBinary(NonAsciiGLB.GetData(), NonAsciiGLB.Num(), LoaderConfig), NonAsciiRootName, ReferencePositions);
+
+	const TArray<uint8> TruncatedJsonUTF8(JsonUTF8.GetData(), JsonUTF8.Num() / 2);
+	TestFalse(TEXT("Truncated document is rejected"), FglTFRuntimeParser::FromUTF8(TruncatedJsonUTF8.GetData(), TruncatedJsonUTF8.Num(), LoaderConfig).IsValid());
+
+	return true;
+}
+
+#endif
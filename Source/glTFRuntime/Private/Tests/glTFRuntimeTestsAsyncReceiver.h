@@ -0,0 +1,32 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "glTFRuntimeTestsAsyncReceiver.generated.h"
+
+class UStaticMesh;
+class USkeletalMesh;
+
+/**
+ * Counts the results of the async loaders in the automation tests (their callbacks are dynamic delegates)
+ */
+UCLASS(Transient)
+class UglTFRuntimeTestsAsyncReceiver : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UglTFRuntimeTestsAsyncReceiver();
+
+	UFUNCTION()
+	void OnStaticMeshLoaded(UStaticMesh* StaticMesh);
+
+	UFUNCTION()
+	void OnSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh);
+
+	int32 NumStaticMeshes;
+	int32 NumSkeletalMeshes;
+	int32 NumFailures;
+};
@@ -0,0 +1,118 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Base64.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeTests
+{
+	// binary payload of the generated assets, every view is 4 bytes aligned (as required by accessors)
+	struct FglTFRuntimeTestBuffer
+	{
+		TArray<uint8> Bytes;
+
+		int32 Append(const void* Data, const int32 Num)
+		{
+			const int32 Offset = Align(Bytes.Num(), 4);
+			Bytes.SetNumZeroed(Offset);
+			Bytes.Append(reinterpret_cast<const uint8*>(Data), Num);
+			return Offset;
+		}
+
+		template<typename T>
+		FString AppendView(const TArray<T>& Values)
+		{
+			const int32 Num = Values.Num() * sizeof(T);
+			const int32 Offset = Append(Values.GetData(), Num);
+			return FString::Printf(TEXT("{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d}"), Offset, Num);
+		}
+
+		FString ToDataUri() const
+		{
+			return FString("data:application/octet-stream;base64,") + FBase64::Encode(Bytes);
+		}
+	};
+
+	/*
+	* Builds a document with NumMeshes skinned meshes sharing the accessors of a GridSize x GridSize grid.
+	* The grid is split between two joints (children of the RootNodeName node).
+	* The buffer is embedded as a data uri, or returned in OutBinaryChunk (without uri, like in GLB files) when specified.
+	*/
+	inline FString BuildSkinnedGridAsset(const int32 GridSize, const int32 NumMeshes, const FString& RootNodeName, TArray<uint8>* OutBinaryChunk = nullptr)
+	{
+		TArray<float> Positions;
+		TArray<float> Normals;
+		TArray<uint8> Joints;
+		TArray<float> Weights;
+		TArray<uint32> Indices;
+
+		for (int32 Z = 0; Z < GridSize; Z++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				Positions.Append({ static_cast<float>(X), 0.0f, static_cast<float>(Z) });
+				Normals.Append({ 0.0f, 1.0f, 0.0f });
+				Joints.Append({ static_cast<uint8>(Z < GridSize / 2 ? 0 : 1), 0, 0, 0 });
+				Weights.Append({ 1.0f, 0.0f, 0.0f, 0.0f });
+			}
+		}
+
+		for (int32 Z = 0; Z < GridSize - 1; Z++)
+		{
+			for (int32 X = 0; X < GridSize - 1; X++)
+			{
+				const uint32 Vertex = Z * GridSize + X;
+				Indices.Append({ Vertex, Vertex + GridSize, Vertex + 1, Vertex + 1, Vertex + GridSize, Vertex + GridSize + 1 });
+			}
+		}
+
+		FglTFRuntimeTestBuffer Buffer;
+		TArray<FString> BufferViews;
+		BufferViews.Add(Buffer.AppendView(Positions));
+		BufferViews.Add(Buffer.AppendView(Normals));
+		BufferViews.Add(Buffer.AppendView(Joints));
+		BufferViews.Add(Buffer.AppendView(Weights));
+		BufferViews.Add(Buffer.AppendView(Indices));
+
+		const int32 NumVertices = GridSize * GridSize;
+		TArray<FString> Accessors;
+		Accessors.Add(FString::Printf(TEXT("{\"bufferView\":0,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\",\"min\":[0,0,0],\"max\":[%d,0,%d]}"), NumVertices, GridSize - 1, GridSize - 1));
+		Accessors.Add(FString::Printf(TEXT("{\"bufferView\":1,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\"}"), NumVertices));
+		Accessors.Add(FString::Printf(TEXT("{\"bufferView\":2,\"componentType\":5121,\"count\":%d,\"type\":\"VEC4\"}"), NumVertices));
+		Accessors.Add(FString::Printf(TEXT("{\"bufferView\":3,\"componentType\":5126,\"count\":%d,\"type\":\"VEC4\"}"), NumVertices));
+		Accessors.Add(FString::Printf(TEXT("{\"bufferView\":4,\"componentType\":5125,\"count\":%d,\"type\":\"SCALAR\"}"), Indices.Num()));
+
+		// 0 is the root, 1 and 2 are the joints, the meshes nodes follow
+		TArray<FString> Meshes;
+		TArray<FString> Nodes;
+		TArray<FString> RootChildren = { TEXT("1") };
+		Nodes.Add(TEXT("{\"name\":\"Joint0\",\"children\":[2]}"));
+		Nodes.Add(FString::Printf(TEXT("{\"name\":\"Joint1\",\"translation\":[0,0,%d]}"), GridSize / 2));
+		for (int32 MeshIndex = 0; MeshIndex < NumMeshes; MeshIndex++)
+		{
+			Meshes.Add(FString::Printf(TEXT("{\"name\":\"Grid%d\",\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1,\"JOINTS_0\":2,\"WEIGHTS_0\":3},\"indices\":4}]}"), MeshIndex));
+			Nodes.Add(FString::Printf(TEXT("{\"name\":\"Mesh%d\",\"mesh\":%d,\"skin\":0}"), MeshIndex, MeshIndex));
+			RootChildren.Add(FString::FromInt(3 + MeshIndex));
+		}
+		Nodes.Insert(FString::Printf(TEXT("{\"name\":\"%s\",\"children\":[%s]}"), *RootNodeName, *FString::Join(RootChildren, TEXT(","))), 0);
+
+		FString JsonBuffer;
+		if (OutBinaryChunk)
+		{
+			*OutBinaryChunk = Buffer.Bytes;
+			JsonBuffer = FString::Printf(TEXT("{\"byteLength\":%d}"), Buffer.Bytes.Num());
+		}
+		else
+		{
+			JsonBuffer = FString::Printf(TEXT("{\"byteLength\":%d,\"uri\":\"%s\"}"), Buffer.Bytes.Num(), *Buffer.ToDataUri());
+		}
+
+		return FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":[%s],\"skins\":[{\"joints\":[1,2]}],\"meshes\":[%s],\"accessors\":[%s],\"bufferViews\":[%s],\"buffers\":[%s]}"),
+			*FString::Join(Nodes, TEXT(",")), *FString::Join(Meshes, TEXT(",")), *FString::Join(Accessors, TEXT(",")), *FString::Join(BufferViews, TEXT(",")), *JsonBuffer);
+	}
+}
+
+#endif
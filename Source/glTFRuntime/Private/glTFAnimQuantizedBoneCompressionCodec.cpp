@@ -0,0 +1,437 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+
+#include "glTFAnimQuantizedBoneCompressionCodec.h"
+#include "Algo/BinarySearch.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace glTFRuntime
+{
+	// smallest-three components are in the [-1/sqrt(2), 1/sqrt(2)] range
+	const float QuantizedRotationScale = 1.41421356f;
+	const float QuantizedRotationMaxValue = 32767.0f;
+	const float QuantizedVectorMaxValue = 65535.0f;
+	// every candidate segment checks all of its skipped keys, so they are capped to keep the reduction linear on long (nearly) constant channels
+	const int32 MaxReducedSegmentFrames = 128;
+
+	FORCEINLINE FQuat InterpolateRotation(const FQuat& A, const FQuat& B, const float Alpha)
+	{
+		FQuat Result = FQuat::FastLerp(A, B, Alpha);
+		Result.Normalize();
+		return Result;
+	}
+
+	FORCEINLINE float GetRotationError(const FQuat& A, const FQuat& B)
+	{
+		const float Dot = FMath::Abs(A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W);
+		return FMath::RadiansToDegrees(2.0f * FMath::Acos(FMath::Min(Dot, 1.0f)));
+	}
+}
+
+FglTFAnimQuantizedCompressionStats UglTFAnimQuantizedBoneCompressionCodec::Compress(const float TranslationTolerance, const float RotationTolerance, const float ScaleTolerance)
+{
+	FglTFAnimQuantizedCompressionStats Stats;
+
+	for (const FRawAnimSequenceTrack& Track : Tracks)
+	{
+		Stats.RawSize += Track.PosKeys.Num() * Track.PosKeys.GetTypeSize();
+		Stats.RawSize += Track.RotKeys.Num() * Track.RotKeys.GetTypeSize();
+		Stats.RawSize += Track.ScaleKeys.Num() * Track.ScaleKeys.GetTypeSize();
+		// frame indices are stored as 16 bit
+		if (FMath::Max3(Track.PosKeys.Num(), Track.RotKeys.Num(), Track.ScaleKeys.Num()) > MAX_uint16 + 1)
+		{
+			Stats.CompressedSize = Stats.RawSize;
+			return Stats;
+		}
+	}
+
+	RotationChannels.SetNum(Tracks.Num());
+	TranslationChannels.SetNum(Tracks.Num());
+	ScaleChannels.SetNum(Tracks.Num());
+
+	Frames.Empty();
+	Values.Empty();
+
+	auto ReduceAndQuantizeVector = [this, &Stats](FChannel& Channel, const auto& Keys, const float Tolerance)
+	{
+		auto GetValue = [&Keys](const int32 Frame) { return FVector(Keys[Frame]); };
+
+		bool bConstant = true;
+		for (int32 Frame = 1; Frame < Keys.Num(); Frame++)
+		{
+			if (FVector::Dist(GetValue(0), GetValue(Frame)) > Tolerance)
+			{
+				bConstant = false;
+				break;
+			}
+		}
+
+		ReduceChannel(Channel, Keys.Num(), bConstant, [&](const int32 FirstFrame, const int32 LastFrame)
+			{
+				const FVector First = GetValue(FirstFrame);
+				const FVector Last = GetValue(LastFrame);
+				const float Delta = 1.0f / (LastFrame - FirstFrame);
+				for (int32 Frame = FirstFrame + 1; Frame < LastFrame; Frame++)
+				{
+					if (FVector::Dist(FMath::Lerp(First, Last, (Frame - FirstFrame) * Delta), GetValue(Frame)) > Tolerance)
+					{
+						return false;
+					}
+				}
+				return true;
+			});
+
+		QuantizeVectorChannel(Channel, GetValue);
+
+		if (bConstant && Keys.Num() > 0)
+		{
+			Stats.NumConstantChannels++;
+		}
+		Stats.NumSourceKeys += Keys.Num();
+		Stats.NumKeys += Channel.NumKeys;
+	};
+
+	for (int32 TrackIndex = 0; TrackIndex < Tracks.Num(); TrackIndex++)
+	{
+		const FRawAnimSequenceTrack& Track = Tracks[TrackIndex];
+
+		auto GetRotation = [&Track](const int32 Frame) { return FQuat(Track.RotKeys[Frame]).GetNormalized(); };
+
+		bool bConstantRotation = true;
+		for (int32 Frame = 1; Frame < Track.RotKeys.Num(); Frame++)
+		{
+			if (glTFRuntime::GetRotationError(GetRotation(0), GetRotation(Frame)) > RotationTolerance)
+			{
+				bConstantRotation = false;
+				break;
+			}
+		}
+
+		FChannel& RotationChannel = RotationChannels[TrackIndex];
+		ReduceChannel(RotationChannel, Track.RotKeys.Num(), bConstantRotation, [&](const int32 FirstFrame, const int32 LastFrame)
+			{
+				const FQuat First = GetRotation(FirstFrame);
+				const FQuat Last = GetRotation(LastFrame);
+				const float Delta = 1.0f / (LastFrame - FirstFrame);
+				for (int32 Frame = FirstFrame + 1; Frame < LastFrame; Frame++)
+				{
+					if (glTFRuntime::GetRotationError(glTFRuntime::InterpolateRotation(First, Last, (Frame - FirstFrame) * Delta), GetRotation(Frame)) > RotationTolerance)
+					{
+						return false;
+					}
+				}
+				return true;
+			});
+		QuantizeRotationChannel(RotationChannel, GetRotation);
+
+		if (bConstantRotation && Track.RotKeys.Num() > 0)
+		{
+			Stats.NumConstantChannels++;
+		}
+		Stats.NumSourceKeys += Track.RotKeys.Num();
+		Stats.NumKeys += RotationChannel.NumKeys;
+
+		ReduceAndQuantizeVector(TranslationChannels[TrackIndex], Track.PosKeys, TranslationTolerance);
+		ReduceAndQuantizeVector(ScaleChannels[TrackIndex], Track.ScaleKeys, ScaleTolerance);
+	}
+
+	Frames.Shrink();
+	Values.Shrink();
+
+	// measure the real error (key reduction + quantization) on every source frame
+	for (int32 TrackIndex = 0; TrackIndex < Tracks.Num(); TrackIndex++)
+	{
+		const FRawAnimSequenceTrack& Track = Tracks[TrackIndex];
+		for (int32 Frame = 0; Frame < Track.RotKeys.Num(); Frame++)
+		{
+			const float RelativePos = Track.RotKeys.Num() > 1 ? static_cast<float>(Frame) / (Track.RotKeys.Num() - 1) : 0;
+			const FQuat Rotation = DecodeRotation(RotationChannels[TrackIndex], RelativePos, EAnimInterpolationType::Linear);
+			Stats.MaxRotationError = FMath::Max(Stats.MaxRotationError, glTFRuntime::GetRotationError(Rotation, FQuat(Track.RotKeys[Frame]).GetNormalized()));
+		}
+		for (int32 Frame = 0; Frame < Track.PosKeys.Num(); Frame++)
+		{
+			const float RelativePos = Track.PosKeys.Num() > 1 ? static_cast<float>(Frame) / (Track.PosKeys.Num() - 1) : 0;
+			const FVector Location = DecodeVector(TranslationChannels[TrackIndex], RelativePos, EAnimInterpolationType::Linear, FVector::ZeroVector);
+			Stats.MaxTranslationError = FMath::Max<float>(Stats.MaxTranslationError, FVector::Dist(Location, FVector(Track.PosKeys[Frame])));
+		}
+		for (int32 Frame = 0; Frame < Track.ScaleKeys.Num(); Frame++)
+		{
+			const float RelativePos = Track.ScaleKeys.Num() > 1 ? static_cast<float>(Frame) / (Track.ScaleKeys.Num() - 1) : 0;
+			const FVector Scale = DecodeVector(ScaleChannels[TrackIndex], RelativePos, EAnimInterpolationType::Linear, FVector::OneVector);
+			Stats.MaxScaleError = FMath::Max<float>(Stats.MaxScaleError, FVector::Dist(Scale, FVector(Track.ScaleKeys[Frame])));
+		}
+	}
+
+	Stats.CompressedSize = Frames.Num() * sizeof(uint16) + Values.Num() * sizeof(uint16) + (RotationChannels.Num() + TranslationChannels.Num() + ScaleChannels.Num()) * sizeof(FChannel);
+
+	Tracks.Empty();
+	bCompressed = true;
+
+	return Stats;
+}
+
+void UglTFAnimQuantizedBoneCompressionCodec::ReduceChannel(FChannel& Channel, const int32 NumSourceKeys, const bool bConstant, TFunctionRef<bool(const int32 FirstFrame, const int32 LastFrame)> IsSegmentValid)
+{
+	Channel.FirstKey = Frames.Num();
+	Channel.NumSourceKeys = NumSourceKeys;
+
+	if (NumSourceKeys > 0)
+	{
+		Frames.Add(0);
+	}
+
+	if (!bConstant && NumSourceKeys > 1)
+	{
+		// greedy reduction: extend the current segment until the interpolation of the skipped keys goes out of tolerance
+		int32 AnchorFrame = 0;
+		for (int32 Frame = 2; Frame < NumSourceKeys; Frame++)
+		{
+			if (Frame - AnchorFrame > glTFRuntime::MaxReducedSegmentFrames || !IsSegmentValid(AnchorFrame, Frame))
+			{
+				AnchorFrame = Frame - 1;
+				Frames.Add(AnchorFrame);
+			}
+		}
+		Frames.Add(NumSourceKeys - 1);
+	}
+
+	Channel.NumKeys = Frames.Num() - Channel.FirstKey;
+}
+
+void UglTFAnimQuantizedBoneCompressionCodec::QuantizeVectorChannel(FChannel& Channel, TFunctionRef<FVector(const int32 Frame)> GetValue)
+{
+	if (Channel.NumKeys < 1)
+	{
+		return;
+	}
+
+	FVector Min = GetValue(Frames[Channel.FirstKey]);
+	FVector Max = Min;
+	for (int32 KeyIndex = 1; KeyIndex < Channel.NumKeys; KeyIndex++)
+	{
+		const FVector Value = GetValue(Frames[Channel.FirstKey + KeyIndex]);
+		Min = Min.ComponentMin(Value);
+		Max = Max.ComponentMax(Value);
+	}
+
+	const FVector Extent = Max - Min;
+	for (int32 Component = 0; Component < 3; Component++)
+	{
+		Channel.RangeMin[Component] = Min[Component];
+		Channel.RangeExtent[Component] = Extent[Component];
+	}
+
+	Values.AddZeroed(Channel.NumKeys * 3);
+	for (int32 KeyIndex = 0; KeyIndex < Channel.NumKeys; KeyIndex++)
+	{
+		const FVector Value = GetValue(Frames[Channel.FirstKey + KeyIndex]);
+		uint16* Quantized = Values.GetData() + (Channel.FirstKey + KeyIndex) * 3;
+		for (int32 Component = 0; Component < 3; Component++)
+		{
+			if (Extent[Component] > 0)
+			{
+				Quantized[Component] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt((Value[Component] - Min[Component]) / Extent[Component] * glTFRuntime::QuantizedVectorMaxValue), 0, MAX_uint16));
+			}
+		}
+	}
+}
+
+void UglTFAnimQuantizedBoneCompressionCodec::QuantizeRotationChannel(FChannel& Channel, TFunctionRef<FQuat(const int32 Frame)> GetValue)
+{
+	Values.AddZeroed(Channel.NumKeys * 3);
+	for (int32 KeyIndex = 0; KeyIndex < Channel.NumKeys; KeyIndex++)
+	{
+		const FQuat Rotation = GetValue(Frames[Channel.FirstKey + KeyIndex]);
+		const float Components[4] = { static_cast<float>(Rotation.X), static_cast<float>(Rotation.Y), static_cast<float>(Rotation.Z), static_cast<float>(Rotation.W) };
+
+		int32 Largest = 0;
+		for (int32 Component = 1; Component < 4; Component++)
+		{
+			if (FMath::Abs(Components[Component]) > FMath::Abs(Components[Largest]))
+			{
+				Largest = Component;
+			}
+		}
+
+		// q and -q are the same rotation, so the largest component is always reconstructed as positive
+		const float Sign = Components[Largest] < 0 ? -1.0f : 1.0f;
+
+		// 2 bits for the largest component index + 3 x 15 bits for the others
+		uint64 Packed = Largest;
+		for (int32 Component = 0; Component < 4; Component++)
+		{
+			if (Component != Largest)
+			{
+				const float Value = FMath::Clamp(Components[Component] * Sign * glTFRuntime::QuantizedRotationScale, -1.0f, 1.0f);
+				Packed = (Packed << 15) | static_cast<uint64>(FMath::RoundToInt((Value * 0.5f + 0.5f) * glTFRuntime::QuantizedRotationMaxValue));
+			}
+		}
+
+		uint16* Quantized = Values.GetData() + (Channel.FirstKey + KeyIndex) * 3;
+		Quantized[0] = static_cast<uint16>(Packed >> 32);
+		Quantized[1] = static_cast<uint16>(Packed >> 16);
+		Quantized[2] = static_cast<uint16>(Packed);
+	}
+}
+
+FQuat UglTFAnimQuantizedBoneCompressionCodec::DequantizeRotation(const int32 Key) const
+{
+	const uint16* Quantized = Values.GetData() + Key * 3;
+	const uint64 Packed = (static_cast<uint64>(Quantized[0]) << 32) | (static_cast<uint64>(Quantized[1]) << 16) | static_cast<uint64>(Quantized[2]);
+
+	const int32 Largest = static_cast<int32>((Packed >> 45) & 0x3);
+
+	float Components[4];
+	float SquaredSum = 0;
+	int32 Shift = 30;
+	for (int32 Component = 0; Component < 4; Component++)
+	{
+		if (Component != Largest)
+		{
+			const float Value = static_cast<float>((Packed >> Shift) & 0x7FFF) / glTFRuntime::QuantizedRotationMaxValue;
+			Components[Component] = (Value * 2.0f - 1.0f) / glTFRuntime::QuantizedRotationScale;
+			SquaredSum += Components[Component] * Components[Component];
+			Shift -= 15;
+		}
+	}
+	Components[Largest] = FMath::Sqrt(FMath::Max(1.0f - SquaredSum, 0.0f));
+
+	return FQuat(Components[0], Components[1], Components[2], Components[3]);
+}
+
+FVector UglTFAnimQuantizedBoneCompressionCodec::DequantizeVector(const FChannel& Channel, const int32 Key) const
+{
+	const uint16* Quantized = Values.GetData() + Key * 3;
+	const float Scale = 1.0f / glTFRuntime::QuantizedVectorMaxValue;
+	return FVector(
+		Channel.RangeMin[0] + Channel.RangeExtent[0] * (Quantized[0] * Scale),
+		Channel.RangeMin[1] + Channel.RangeExtent[1] * (Quantized[1] * Scale),
+		Channel.RangeMin[2] + Channel.RangeExtent[2] * (Quantized[2] * Scale));
+}
+
+float UglTFAnimQuantizedBoneCompressionCodec::GetChannelKeys(const FChannel& Channel, const float RelativePos, const EAnimInterpolationType Interpolation, int32& KeyA, int32& KeyB) const
+{
+	const int32 LastKey = Channel.FirstKey + Channel.NumKeys - 1;
+
+	if (Channel.NumKeys < 2 || RelativePos <= 0.f)
+	{
+		KeyA = Channel.FirstKey;
+		KeyB = Channel.FirstKey;
+		return 0.0f;
+	}
+
+	if (RelativePos >= 1.0f)
+	{
+		KeyA = LastKey;
+		KeyB = LastKey;
+		return 0.0f;
+	}
+
+	float KeyPos = RelativePos * (Channel.NumSourceKeys - 1);
+	if (Interpolation == EAnimInterpolationType::Step)
+	{
+		KeyPos = FMath::FloorToFloat(KeyPos);
+	}
+
+	// the first kept frame is always 0, so the upper bound is at least 1
+	const TArrayView<const uint16> ChannelFrames(Frames.GetData() + Channel.FirstKey, Channel.NumKeys);
+	const int32 UpperBound = Algo::UpperBound(ChannelFrames, KeyPos);
+	if (UpperBound >= Channel.NumKeys)
+	{
+		KeyA = LastKey;
+		KeyB = LastKey;
+		return 0.0f;
+	}
+
+	KeyB = Channel.FirstKey + UpperBound;
+	KeyA = KeyB - 1;
+
+	const float FrameA = Frames[KeyA];
+	const float FrameB = Frames[KeyB];
+	return FMath::Clamp((KeyPos - FrameA) / (FrameB - FrameA), 0.0f, 1.0f);
+}
+
+FQuat UglTFAnimQuantizedBoneCompressionCodec::DecodeRotation(const FChannel& Channel, const float RelativePos, const EAnimInterpolationType Interpolation) const
+{
+	if (Channel.NumKeys < 1)
+	{
+		return FQuat::Identity;
+	}
+
+	int32 KeyA = 0;
+	int32 KeyB = 0;
+	const float Alpha = GetChannelKeys(Channel, RelativePos, Interpolation, KeyA, KeyB);
+	if (KeyA == KeyB)
+	{
+		return DequantizeRotation(KeyA);
+	}
+	return glTFRuntime::InterpolateRotation(DequantizeRotation(KeyA), DequantizeRotation(KeyB), Alpha);
+}
+
+FVector UglTFAnimQuantizedBoneCompressionCodec::DecodeVector(const FChannel& Channel, const float RelativePos, const EAnimInterpolationType Interpolation, const FVector& DefaultValue) const
+{
+	if (Channel.NumKeys < 1)
+	{
+		return DefaultValue;
+	}
+
+	int32 KeyA = 0;
+	int32 KeyB = 0;
+	const float Alpha = GetChannelKeys(Channel, RelativePos, Interpolation, KeyA, KeyB);
+	if (KeyA == KeyB)
+	{
+		return DequantizeVector(Channel, KeyA);
+	}
+	return FMath::Lerp(DequantizeVector(Channel, KeyA), DequantizeVector(Channel, KeyB), Alpha);
+}
+
+void UglTFAnimQuantizedBoneCompressionCodec::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
+{
+	if (!bCompressed)
+	{
+		Super::DecompressBone(DecompContext, TrackIndex, OutAtom);
+		return;
+	}
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0
+	const float RelativePos = DecompContext.GetRelativePosition();
+#else
+	const float RelativePos = DecompContext.RelativePos;
+#endif
+
+	OutAtom.SetLocation(DecodeVector(TranslationChannels[TrackIndex], RelativePos, DecompContext.Interpolation, FVector::ZeroVector));
+	OutAtom.SetRotation(DecodeRotation(RotationChannels[TrackIndex], RelativePos, DecompContext.Interpolation));
+	OutAtom.SetScale3D(DecodeVector(ScaleChannels[TrackIndex], RelativePos, DecompContext.Interpolation, FVector::OneVector));
+}
+
+void UglTFAnimQuantizedBoneCompressionCodec::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
+{
+	if (!bCompressed)
+	{
+		Super::DecompressPose(DecompContext, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+		return;
+	}
+
+	// the sampling position is shared by the whole pose, channels only differ in their (reduced) keys
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0
+	const float RelativePos = DecompContext.GetRelativePosition();
+#else
+	const float RelativePos = DecompContext.RelativePos;
+#endif
+	const EAnimInterpolationType Interpolation = DecompContext.Interpolation;
+
+	for (const BoneTrackPair& BoneTrackPair : RotationPairs)
+	{
+		OutAtoms[BoneTrackPair.AtomIndex].SetRotation(DecodeRotation(RotationChannels[BoneTrackPair.TrackIndex], RelativePos, Interpolation));
+	}
+
+	for (const BoneTrackPair& BoneTrackPair : TranslationPairs)
+	{
+		OutAtoms[BoneTrackPair.AtomIndex].SetLocation(DecodeVector(TranslationChannels[BoneTrackPair.TrackIndex], RelativePos, Interpolation, FVector::ZeroVector));
+	}
+
+	for (const BoneTrackPair& BoneTrackPair : ScalePairs)
+	{
+		OutAtoms[BoneTrackPair.AtomIndex].SetScale3D(DecodeVector(ScaleChannels[BoneTrackPair.TrackIndex], RelativePos, Interpolation, FVector::OneVector));
+	}
+}
@@ -1,15 +1,21 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntime.h"
+#include "glTFRuntimeFinalizationQueue.h"
+#include "glTFRuntimeTaskQueue.h"
 
 #define LOCTEXT_NAMESPACE "FglTFRuntimeModule"
 
 void FglTFRuntimeModule::StartupModule()
 {
+	FglTFRuntimeFinalizationQueue::Get().Startup();
+	FglTFRuntimeTaskQueue::Get().Startup();
 }
 
 void FglTFRuntimeModule::ShutdownModule()
 {
+	FglTFRuntimeTaskQueue::Get().Shutdown();
+	FglTFRuntimeFinalizationQueue::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -2,11 +2,15 @@
 
 
 #include "glTFRuntimeAnimationCurve.h"
+#include "glTFRuntimeParser.h"
+#include "Algo/BinarySearch.h"
 
 UglTFRuntimeAnimationCurve::UglTFRuntimeAnimationCurve()
 {
 	glTFCurveAnimationIndex = INDEX_NONE;
 	glTFCurveAnimationDuration = 0;
+	BakedMinTime = 0;
+	bBaked = false;
 }
 
 FTransform UglTFRuntimeAnimationCurve::GetTransformValue(float InTime) const
@@ -47,44 +51,6 @@ FTransform UglTFRuntimeAnimationCurve::GetTransformValue(float InTime) const
 		}
 		else
 		{
-			// TODO refactor it to reuse the skeletal animations one
-			auto FindBestFrames = [&](const float WantedTime, int32& FirstIndex, int32& SecondIndex) -> float
-				{
-					SecondIndex = INDEX_NONE;
-					// first search for second (higher value)
-					for (int32 Index = 0; Index < ConvertedQuaternions.Num(); Index++)
-					{
-						float TimeValue = ConvertedQuaternions[Index].Key - ConvertedQuaternions[0].Key;
-						if (FMath::IsNearlyEqual(TimeValue, WantedTime))
-						{
-							FirstIndex = Index;
-							SecondIndex = Index;
-							return 0;
-						}
-						else if (TimeValue > WantedTime)
-						{
-							SecondIndex = Index;
-							break;
-						}
-					}
-
-					// not found ? use the last value
-					if (SecondIndex == INDEX_NONE)
-					{
-						SecondIndex = ConvertedQuaternions.Num() - 1;
-					}
-
-					if (SecondIndex == 0)
-					{
-						FirstIndex = 0;
-						return 1.f;
-					}
-
-					FirstIndex = SecondIndex - 1;
-
-					return ((WantedTime + ConvertedQuaternions[0].Key) - ConvertedQuaternions[FirstIndex].Key) / (ConvertedQuaternions[SecondIndex].Key - ConvertedQuaternions[FirstIndex].Key);
-				};
-
 			if (InTime <= ConvertedQuaternions[0].Key)
 			{
 				Transform.SetRotation(ConvertedQuaternions[0].Value);
@@ -97,7 +63,7 @@ FTransform UglTFRuntimeAnimationCurve::GetTransformValue(float InTime) const
 			{
 				int32 FirstIndex;
 				int32 SecondIndex;
-				const float Alpha = FindBestFrames(InTime, FirstIndex, SecondIndex);
+				const float Alpha = FglTFRuntimeParser::FindBestFramesInTimeline(ConvertedQuaternions.Num(), [this](const int32 Index) { return ConvertedQuaternions[Index].Key; }, InTime, FirstIndex, SecondIndex);
 
 				Transform.SetRotation(FQuat::Slerp(ConvertedQuaternions[FirstIndex].Value, ConvertedQuaternions[SecondIndex].Value, Alpha));
 			}
@@ -110,6 +76,8 @@ FTransform UglTFRuntimeAnimationCurve::GetTransformValue(float InTime) const
 
 void UglTFRuntimeAnimationCurve::SetDefaultValues(const FVector Location, const FQuat Quat, const FRotator Rotator, const FVector Scale)
 {
+	bBaked = false;
+
 	LocationCurves[0].DefaultValue = Location.X;
 	LocationCurves[1].DefaultValue = Location.Y;
 	LocationCurves[2].DefaultValue = Location.Z;
@@ -216,6 +184,8 @@ bool UglTFRuntimeAnimationCurve::IsValidCurve(FRichCurveEditInfo CurveInfo)
 
 void UglTFRuntimeAnimationCurve::AddLocationValue(const float InTime, const FVector InLocation, const ERichCurveInterpMode InterpolationMode)
 {
+	bBaked = false;
+
 	FKeyHandle LocationKey0 = LocationCurves[0].AddKey(InTime, InLocation.X);
 	LocationCurves[0].SetKeyInterpMode(LocationKey0, InterpolationMode);
 	FKeyHandle LocationKey1 = LocationCurves[1].AddKey(InTime, InLocation.Y);
@@ -226,6 +196,8 @@ void UglTFRuntimeAnimationCurve::AddLocationValue(const float InTime, const FVec
 
 void UglTFRuntimeAnimationCurve::AddQuatValue(const float InTime, const FQuat InQuat, const ERichCurveInterpMode InterpolationMode)
 {
+	bBaked = false;
+
 	FKeyHandle RotationKey0 = QuatCurves[0].AddKey(InTime, InQuat.X);
 	QuatCurves[0].SetKeyInterpMode(RotationKey0, InterpolationMode);
 	FKeyHandle RotationKey1 = QuatCurves[1].AddKey(InTime, InQuat.Y);
@@ -238,6 +210,8 @@ void UglTFRuntimeAnimationCurve::AddQuatValue(const float InTime, const FQuat In
 
 void UglTFRuntimeAnimationCurve::AddConvertedQuaternion(const float InTime, const FQuat InQuat, const bool bStep)
 {
+	bBaked = false;
+
 	int32 Index = 0;
 	if (ConvertedQuaternions.Num() == 0 || ConvertedQuaternions.Last().Key < InTime)
 	{
@@ -255,6 +229,8 @@ void UglTFRuntimeAnimationCurve::AddConvertedQuaternion(const float InTime, cons
 
 void UglTFRuntimeAnimationCurve::AddRotatorValue(const float InTime, const FRotator InRotator, const ERichCurveInterpMode InterpolationMode)
 {
+	bBaked = false;
+
 	FKeyHandle RotationKey0 = RotatorCurves[0].AddKey(InTime, InRotator.Roll, true);
 	RotatorCurves[0].SetKeyInterpMode(RotationKey0, InterpolationMode);
 	FKeyHandle RotationKey1 = RotatorCurves[1].AddKey(InTime, InRotator.Pitch, true);
@@ -265,6 +241,8 @@ void UglTFRuntimeAnimationCurve::AddRotatorValue(const float InTime, const FRota
 
 void UglTFRuntimeAnimationCurve::AddScaleValue(const float InTime, const FVector InScale, const ERichCurveInterpMode InterpolationMode)
 {
+	bBaked = false;
+
 	FKeyHandle ScaleKey0 = ScaleCurves[0].AddKey(InTime, InScale.X);
 	ScaleCurves[0].SetKeyInterpMode(ScaleKey0, InterpolationMode);
 	FKeyHandle ScaleKey1 = ScaleCurves[1].AddKey(InTime, InScale.Y);
@@ -272,3 +250,117 @@ void UglTFRuntimeAnimationCurve::AddScaleValue(const float InTime, const FVector
 	FKeyHandle ScaleKey2 = ScaleCurves[2].AddKey(InTime, InScale.Z);
 	ScaleCurves[2].SetKeyInterpMode(ScaleKey2, InterpolationMode);
 }
+
+void UglTFRuntimeAnimationCurve::BakeVectorCurves(const FRichCurve* Curves, FBakedTimeline& Timeline) const
+{
+	// components are keyed together, so use the curve with most keys as the timeline
+	const FRichCurve* TimelineCurve = &Curves[0];
+	for (int32 Component = 1; Component < 3; Component++)
+	{
+		if (Curves[Component].GetNumKeys() > TimelineCurve->GetNumKeys())
+		{
+			TimelineCurve = &Curves[Component];
+		}
+	}
+
+	Timeline.Times.Empty(TimelineCurve->GetNumKeys());
+	Timeline.Values.Empty(TimelineCurve->GetNumKeys());
+	Timeline.Steps.Empty(TimelineCurve->GetNumKeys());
+	Timeline.DefaultValue = FVector4(Curves[0].Eval(0), Curves[1].Eval(0), Curves[2].Eval(0), 0);
+
+	for (const FRichCurveKey& Key : TimelineCurve->GetConstRefOfKeys())
+	{
+		Timeline.Times.Add(Key.Time);
+		Timeline.Values.Add(FVector4(Curves[0].Eval(Key.Time), Curves[1].Eval(Key.Time), Curves[2].Eval(Key.Time), 0));
+		Timeline.Steps.Add(Key.InterpMode == ERichCurveInterpMode::RCIM_Constant);
+	}
+}
+
+void UglTFRuntimeAnimationCurve::Bake()
+{
+	BakeVectorCurves(LocationCurves, BakedLocations);
+	BakeVectorCurves(ScaleCurves, BakedScales);
+
+	BakedRotations.Times.Empty(ConvertedQuaternions.Num());
+	BakedRotations.Values.Empty(ConvertedQuaternions.Num());
+	BakedRotations.Steps.Empty(ConvertedQuaternions.Num());
+	BakedRotations.DefaultValue = FVector4(0, 0, 0, 1);
+	for (const TPair<float, FQuat>& Pair : ConvertedQuaternions)
+	{
+		BakedRotations.Times.Add(Pair.Key);
+		BakedRotations.Values.Add(FVector4(Pair.Value.X, Pair.Value.Y, Pair.Value.Z, Pair.Value.W));
+		BakedRotations.Steps.Add(bIsStepped);
+	}
+
+	BakedBasisMatrixInverse = BasisMatrix.Inverse();
+
+	float MaxTime = 0;
+	GetTimeRange(BakedMinTime, MaxTime);
+
+	bBaked = true;
+}
+
+bool UglTFRuntimeAnimationCurve::FBakedTimeline::GetKeys(const float InTime, int32& FirstIndex, int32& SecondIndex, float& Alpha) const
+{
+	if (Times.Num() == 0)
+	{
+		return false;
+	}
+
+	Alpha = 0;
+
+	if (InTime <= Times[0])
+	{
+		FirstIndex = 0;
+		SecondIndex = 0;
+		return true;
+	}
+
+	if (InTime >= Times.Last())
+	{
+		FirstIndex = Times.Num() - 1;
+		SecondIndex = FirstIndex;
+		return true;
+	}
+
+	SecondIndex = Algo::UpperBound(Times, InTime);
+	FirstIndex = SecondIndex - 1;
+
+	if (!Steps[FirstIndex])
+	{
+		Alpha = (InTime - Times[FirstIndex]) / (Times[SecondIndex] - Times[FirstIndex]);
+	}
+
+	return true;
+}
+
+FTransform UglTFRuntimeAnimationCurve::GetBakedTransformValue(const float InTime) const
+{
+	int32 FirstIndex = 0;
+	int32 SecondIndex = 0;
+	float Alpha = 0;
+
+	FVector Location = FVector(BakedLocations.DefaultValue);
+	if (BakedLocations.GetKeys(InTime, FirstIndex, SecondIndex, Alpha))
+	{
+		Location = FVector(FMath::Lerp(BakedLocations.Values[FirstIndex], BakedLocations.Values[SecondIndex], Alpha));
+	}
+
+	FVector Scale = FVector(BakedScales.DefaultValue);
+	if (BakedScales.GetKeys(InTime, FirstIndex, SecondIndex, Alpha))
+	{
+		Scale = FVector(FMath::Lerp(BakedScales.Values[FirstIndex], BakedScales.Values[SecondIndex], Alpha));
+	}
+
+	FMatrix Matrix = FScaleMatrix(Scale) * FTranslationMatrix(Location);
+	FTransform Transform = FTransform(BakedBasisMatrixInverse * Matrix * BasisMatrix);
+
+	if (BakedRotations.GetKeys(InTime, FirstIndex, SecondIndex, Alpha))
+	{
+		const FVector4& FirstValue = BakedRotations.Values[FirstIndex];
+		const FVector4& SecondValue = BakedRotations.Values[SecondIndex];
+		Transform.SetRotation(FQuat::Slerp(FQuat(FirstValue.X, FirstValue.Y, FirstValue.Z, FirstValue.W), FQuat(SecondValue.X, SecondValue.Y, SecondValue.Z, SecondValue.W), Alpha));
+	}
+
+	return Transform;
+}
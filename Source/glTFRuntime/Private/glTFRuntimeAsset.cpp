@@ -930,6 +930,10 @@ UTexture2D* UglTFRuntimeAsset::LoadImage(const int32 ImageIndex, const FglTFRunt
 		Mip.Height = Height;
 		Mip.PixelFormat = PixelFormat;
 		TArray<FglTFRuntimeMipMap> Mips = { Mip };
+		if (ImagesConfig.bCompressMips)
+		{
+			FglTFRuntimeParser::CompressMips(Mips, ImagesConfig);
+		}
 		return Parser->BuildTexture(this, Mips, ImagesConfig, FglTFRuntimeTextureSampler());
 	}
 
@@ -1067,6 +1071,10 @@ UTexture2D* UglTFRuntimeAsset::LoadImageFromBlob(const FglTFRuntimeImagesConfig&
 		Mip.PixelFormat = PixelFormat;
 		TArray<FglTFRuntimeMipMap> Mips;
 		Mips.Add(MoveTemp(Mip));
+		if (ImagesConfig.bCompressMips)
+		{
+			FglTFRuntimeParser::CompressMips(Mips, ImagesConfig);
+		}
 		return Parser->BuildTexture(this, Mips, ImagesConfig, FglTFRuntimeTextureSampler());
 	}
 
@@ -1075,7 +1083,7 @@ UTexture2D* UglTFRuntimeAsset::LoadImageFromBlob(const FglTFRuntimeImagesConfig&
 
 void UglTFRuntimeAsset::LoadImageFromBlobAsync(const FglTFRuntimeTexture2DAsync& AsyncCallback, const FglTFRuntimeImagesConfig& ImagesConfig)
 {
-	Async(EAsyncExecution::Thread, [this, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(EglTFRuntimeTaskPriority::Normal, nullptr, [this, ImagesConfig, AsyncCallback]()
 		{
 			TArray64<uint8> UncompressedBytes;
 			int32 Width = 0;
@@ -1102,6 +1110,10 @@ void UglTFRuntimeAsset::LoadImageFromBlobAsync(const FglTFRuntimeTexture2DAsync&
 			Mip.PixelFormat = PixelFormat;
 			TArray<FglTFRuntimeMipMap> Mips;
 			Mips.Add(MoveTemp(Mip));
+			if (ImagesConfig.bCompressMips)
+			{
+				FglTFRuntimeParser::CompressMips(Mips, ImagesConfig);
+			}
 
 			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
 				{
@@ -1155,7 +1167,7 @@ UTexture2DArray* UglTFRuntimeAsset::LoadImageArrayFromBlob(const FglTFRuntimeIma
 
 void UglTFRuntimeAsset::LoadImageArrayFromBlobAsync(const FglTFRuntimeTexture2DArrayAsync& AsyncCallback, const FglTFRuntimeImagesConfig& ImagesConfig)
 {
-	Async(EAsyncExecution::Thread, [this, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(EglTFRuntimeTaskPriority::Normal, nullptr, [this, ImagesConfig, AsyncCallback]()
 		{
 			TArray64<uint8> UncompressedBytes;
 			int32 Width = 0;
@@ -1223,7 +1235,7 @@ UTexture2D* UglTFRuntimeAsset::LoadMipsFromBlob(const FglTFRuntimeImagesConfig&
 
 void UglTFRuntimeAsset::LoadMipsFromBlobAsync(const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTexture2DAsync& AsyncCallback)
 {
-	Async(EAsyncExecution::Thread, [this, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(EglTFRuntimeTaskPriority::Normal, nullptr, [this, ImagesConfig, AsyncCallback]()
 		{
 			if (!Parser)
 			{
@@ -1264,7 +1276,7 @@ void UglTFRuntimeAsset::LoadMipsFromBlobAsync(const FglTFRuntimeImagesConfig& Im
 
 void UglTFRuntimeAsset::LoadCubeMapFromBlobAsync(const bool bSpherical, const bool bAutoRotate, const FglTFRuntimeTextureCubeAsync& AsyncCallback, const FglTFRuntimeImagesConfig& ImagesConfig)
 {
-	Async(EAsyncExecution::Thread, [this, bSpherical, bAutoRotate, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(EglTFRuntimeTaskPriority::Normal, nullptr, [this, bSpherical, bAutoRotate, ImagesConfig, AsyncCallback]()
 		{
 			if (!Parser)
 			{
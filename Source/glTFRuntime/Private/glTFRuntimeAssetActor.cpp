@@ -435,30 +435,133 @@ void AglTFRuntimeAssetActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	const int32 NumCurveAnimations = CurveBasedAnimations.Num();
+	bool bCurveAnimationsHierarchyChanged = CurveAnimationsComponents.Num() != NumCurveAnimations;
+
+	CurveAnimationsComponents.SetNum(NumCurveAnimations);
+	CurveAnimationsCurves.SetNum(NumCurveAnimations);
+	CurveAnimationsTimes.SetNum(NumCurveAnimations);
+	CurveAnimationsTransforms.SetNum(NumCurveAnimations);
+	CurveAnimationsUpdated.Init(false, NumCurveAnimations);
+
+	// gather (and advance) the animations to evaluate
+	int32 AnimationIndex = 0;
 	for (TPair<USceneComponent*, UglTFRuntimeAnimationCurve*>& Pair : CurveBasedAnimations)
 	{
+		if (CurveAnimationsComponents[AnimationIndex] != Pair.Key)
+		{
+			CurveAnimationsComponents[AnimationIndex] = Pair.Key;
+			bCurveAnimationsHierarchyChanged = true;
+		}
+
+		CurveAnimationsCurves[AnimationIndex] = nullptr;
+
 		// the curve could be null
-		if (!Pair.Value)
+		UglTFRuntimeAnimationCurve* AnimationCurve = Pair.Value;
+		if (AnimationCurve)
+		{
+			if (!AnimationCurve->IsBaked())
+			{
+				AnimationCurve->Bake();
+			}
+
+			float& CurrentTime = CurveBasedAnimationsTimeTracker.FindOrAdd(Pair.Key);
+			if (CurrentTime > AnimationCurve->glTFCurveAnimationDuration)
+			{
+				CurrentTime = 0;
+			}
+
+			if (CurrentTime >= AnimationCurve->GetBakedMinTime())
+			{
+				CurveAnimationsCurves[AnimationIndex] = AnimationCurve;
+				CurveAnimationsTimes[AnimationIndex] = CurrentTime;
+			}
+			CurrentTime += DeltaTime;
+		}
+
+		AnimationIndex++;
+	}
+
+	if (bCurveAnimationsHierarchyChanged)
+	{
+		TMap<USceneComponent*, int32> CurveAnimationsComponentsMap;
+		for (int32 Index = 0; Index < NumCurveAnimations; Index++)
+		{
+			CurveAnimationsComponentsMap.Add(CurveAnimationsComponents[Index], Index);
+		}
+
+		CurveAnimationsParents.Init(INDEX_NONE, NumCurveAnimations);
+		for (int32 Index = 0; Index < NumCurveAnimations; Index++)
+		{
+			for (USceneComponent* Parent = CurveAnimationsComponents[Index] ? CurveAnimationsComponents[Index]->GetAttachParent() : nullptr; Parent; Parent = Parent->GetAttachParent())
+			{
+				if (const int32* ParentIndex = CurveAnimationsComponentsMap.Find(Parent))
+				{
+					CurveAnimationsParents[Index] = *ParentIndex;
+					break;
+				}
+			}
+		}
+	}
+
+	ParallelFor(NumCurveAnimations, [this](const int32 Index)
+		{
+			if (CurveAnimationsCurves[Index])
+			{
+				CurveAnimationsTransforms[Index] = CurveAnimationsCurves[Index]->GetBakedTransformValue(CurveAnimationsTimes[Index]);
+			}
+		}, NumCurveAnimations < 64);
+
+	// first store the relative transforms...
+	for (int32 Index = 0; Index < NumCurveAnimations; Index++)
+	{
+		USceneComponent* SceneComponent = CurveAnimationsComponents[Index];
+		if (!SceneComponent || !CurveAnimationsCurves[Index])
 		{
 			continue;
 		}
-		float MinTime;
-		float MaxTime;
-		Pair.Value->GetTimeRange(MinTime, MaxTime);
 
-		float CurrentTime = CurveBasedAnimationsTimeTracker[Pair.Key];
-		if (CurrentTime > Pair.Value->glTFCurveAnimationDuration)
+		const FTransform& FrameTransform = CurveAnimationsTransforms[Index];
+		if (SceneComponent->GetRelativeTransform().Equals(FrameTransform))
 		{
-			CurveBasedAnimationsTimeTracker[Pair.Key] = 0;
-			CurrentTime = 0;
+			continue;
+		}
+
+		SceneComponent->SetRelativeLocation_Direct(FrameTransform.GetLocation());
+		SceneComponent->SetRelativeRotation_Direct(FrameTransform.Rotator());
+		SceneComponent->SetRelativeScale3D_Direct(FrameTransform.GetScale3D());
+		CurveAnimationsUpdated[Index] = true;
+	}
+
+	// ...then propagate them only from the topmost updated components (children are updated by their parents)
+	for (int32 Index = 0; Index < NumCurveAnimations; Index++)
+	{
+		if (!CurveAnimationsUpdated[Index])
+		{
+			continue;
 		}
 
-		if (CurrentTime >= MinTime)
+		bool bUpdatedByAncestor = false;
+		for (int32 ParentIndex = CurveAnimationsParents[Index]; ParentIndex != INDEX_NONE; ParentIndex = CurveAnimationsParents[ParentIndex])
 		{
-			FTransform FrameTransform = Pair.Value->GetTransformValue(CurveBasedAnimationsTimeTracker[Pair.Key]);
-			Pair.Key->SetRelativeTransform(FrameTransform);
+			if (CurveAnimationsUpdated[ParentIndex])
+			{
+				bUpdatedByAncestor = CurveAnimationsComponents[Index]->IsAttachedTo(CurveAnimationsComponents[ParentIndex]);
+				break;
+			}
+		}
+
+		if (!bUpdatedByAncestor)
+		{
+			USceneComponent* SceneComponent = CurveAnimationsComponents[Index];
+			SceneComponent->UpdateComponentToWorld();
+			// the _Direct setters bypass the movement path, so overlaps need to be refreshed explicitly
+			UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(SceneComponent);
+			if (!PrimitiveComponent || PrimitiveComponent->GetGenerateOverlapEvents())
+			{
+				SceneComponent->UpdateOverlaps();
+			}
 		}
-		CurveBasedAnimationsTimeTracker[Pair.Key] += DeltaTime;
 	}
 }
 
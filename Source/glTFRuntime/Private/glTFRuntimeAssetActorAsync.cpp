@@ -6,6 +6,9 @@
 #include "Components/StaticMeshComponent.h"
 #include "Components/LightComponent.h"
 #include "Engine/StaticMeshSocket.h"
+#include "Algo/StableSort.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
 
 // Sets default values
 AglTFRuntimeAssetActorAsync::AglTFRuntimeAssetActorAsync()
@@ -20,6 +23,11 @@ AglTFRuntimeAssetActorAsync::AglTFRuntimeAssetActorAsync()
 	bStaticMeshesAsSkeletal = false;
 
 	bAllowLights = true;
+
+	MaxConcurrentMeshLoads = 4;
+	MeshesFinalizationBudget = 2;
+	bPrioritizeByCameraDistance = true;
+	NextMeshToLoad = 0;
 }
 
 // Called when the game starts or when spawned
@@ -52,6 +60,27 @@ void AglTFRuntimeAssetActorAsync::BeginPlay()
 		}
 	}
 
+	if (bPrioritizeByCameraDistance)
+	{
+		FVector ViewLocation = GetActorLocation();
+		APlayerController* PlayerController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+		if (PlayerController && PlayerController->PlayerCameraManager)
+		{
+			ViewLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+		}
+
+		Algo::StableSortBy(MeshesToLoad, [ViewLocation](const TPair<UPrimitiveComponent*, FglTFRuntimeNode>& Pair)
+			{
+				return FVector::DistSquared(Pair.Key->GetComponentLocation(), ViewLocation);
+			});
+	}
+
+	if (MeshesToLoad.Num() == 0)
+	{
+		ScenesLoaded();
+		return;
+	}
+
 	LoadNextMeshAsync();
 }
 
@@ -90,7 +119,7 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 			StaticMeshComponent->RegisterComponent();
 			StaticMeshComponent->SetRelativeTransform(Node.Transform);
 			AddInstanceComponent(StaticMeshComponent);
-			MeshesToLoad.Add(StaticMeshComponent, Node);
+			MeshesToLoad.Add(TPair<UPrimitiveComponent*, FglTFRuntimeNode>(StaticMeshComponent, Node));
 			NewComponent = StaticMeshComponent;
 			ReceiveOnStaticMeshComponentCreated(StaticMeshComponent, Node);
 		}
@@ -101,7 +130,7 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 			SkeletalMeshComponent->RegisterComponent();
 			SkeletalMeshComponent->SetRelativeTransform(Node.Transform);
 			AddInstanceComponent(SkeletalMeshComponent);
-			MeshesToLoad.Add(SkeletalMeshComponent, Node);
+			MeshesToLoad.Add(TPair<UPrimitiveComponent*, FglTFRuntimeNode>(SkeletalMeshComponent, Node));
 			NewComponent = SkeletalMeshComponent;
 			ReceiveOnSkeletalMeshComponentCreated(SkeletalMeshComponent, Node);
 		}
@@ -153,36 +182,106 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 
 void AglTFRuntimeAssetActorAsync::LoadNextMeshAsync()
 {
-	if (MeshesToLoad.Num() == 0)
+	// the asset could have been already released
+	if (!Asset)
+	{
+		return;
+	}
+
+	while (NextMeshToLoad < MeshesToLoad.Num() && InFlightMeshRequests.Num() < FMath::Max(MaxConcurrentMeshLoads, 1))
+	{
+		const TPair<UPrimitiveComponent*, FglTFRuntimeNode>& MeshToLoad = MeshesToLoad[NextMeshToLoad++];
+
+		UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest = NewObject<UglTFRuntimeAssetActorAsyncMeshRequest>(this);
+		MeshRequest->PrimitiveComponent = MeshToLoad.Key;
+		MeshRequest->Mesh = nullptr;
+		MeshRequest->Node = MeshToLoad.Value;
+		MeshRequest->Actor = this;
+		InFlightMeshRequests.Add(MeshRequest);
+
+		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshToLoad.Key))
+		{
+			if (StaticMeshConfig.Outer == nullptr)
+			{
+				StaticMeshConfig.Outer = StaticMeshComponent;
+			}
+			FglTFRuntimeStaticMeshAsync Delegate;
+			Delegate.BindDynamic(MeshRequest, &UglTFRuntimeAssetActorAsyncMeshRequest::OnStaticMeshLoaded);
+			Asset->LoadStaticMeshAsync(MeshToLoad.Value.MeshIndex, Delegate, OverrideStaticMeshConfig(MeshToLoad.Value.Index, StaticMeshComponent));
+		}
+		else if (Cast<USkeletalMeshComponent>(MeshToLoad.Key))
+		{
+			FglTFRuntimeSkeletalMeshAsync Delegate;
+			Delegate.BindDynamic(MeshRequest, &UglTFRuntimeAssetActorAsyncMeshRequest::OnSkeletalMeshLoaded);
+			Asset->LoadSkeletalMeshAsync(MeshToLoad.Value.MeshIndex, MeshToLoad.Value.SkinIndex, Delegate, SkeletalMeshConfig);
+		}
+	}
+}
+
+void UglTFRuntimeAssetActorAsyncMeshRequest::OnStaticMeshLoaded(UStaticMesh* StaticMesh)
+{
+	Mesh = StaticMesh;
+	if (Actor.IsValid())
+	{
+		Actor->OnMeshLoaded(this);
+	}
+}
+
+void UglTFRuntimeAssetActorAsyncMeshRequest::OnSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh)
+{
+	Mesh = SkeletalMesh;
+	if (Actor.IsValid())
+	{
+		Actor->OnMeshLoaded(this);
+	}
+}
+
+void AglTFRuntimeAssetActorAsync::OnMeshLoaded(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest)
+{
+	// components are updated in Tick() (within the frame budget), here we only keep the workers busy
+	InFlightMeshRequests.Remove(MeshRequest);
+	LoadedMeshRequests.Add(MeshRequest);
+
+	LoadNextMeshAsync();
+}
+
+void AglTFRuntimeAssetActorAsync::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (LoadedMeshRequests.Num() == 0)
 	{
 		return;
 	}
 
-	auto It = MeshesToLoad.CreateIterator();
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(It->Key))
+	const double FinalizationStartTime = FPlatformTime::Seconds();
+
+	int32 NumFinalizedMeshes = 0;
+	while (NumFinalizedMeshes < LoadedMeshRequests.Num())
 	{
-		CurrentPrimitiveComponent = StaticMeshComponent;
-		if (StaticMeshConfig.Outer == nullptr)
+		FinalizeMeshRequest(LoadedMeshRequests[NumFinalizedMeshes++]);
+		if ((FPlatformTime::Seconds() - FinalizationStartTime) * 1000.0 >= MeshesFinalizationBudget)
 		{
-			StaticMeshConfig.Outer = StaticMeshComponent;
+			break;
 		}
-		FglTFRuntimeStaticMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync);
-		Asset->LoadStaticMeshAsync(It->Value.MeshIndex, Delegate, OverrideStaticMeshConfig(It->Value.Index, StaticMeshComponent));
 	}
-	else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(It->Key))
+
+	LoadedMeshRequests.RemoveAt(0, NumFinalizedMeshes);
+
+	// trigger event
+	if (NextMeshToLoad >= MeshesToLoad.Num() && InFlightMeshRequests.Num() == 0 && LoadedMeshRequests.Num() == 0)
 	{
-		CurrentPrimitiveComponent = SkeletalMeshComponent;
-		FglTFRuntimeSkeletalMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync);
-		Asset->LoadSkeletalMeshAsync(It->Value.MeshIndex, It->Value.SkinIndex, Delegate, SkeletalMeshConfig);
+		MeshesToLoad.Empty();
+		NextMeshToLoad = 0;
+		ScenesLoaded();
 	}
 }
 
-void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
+void AglTFRuntimeAssetActorAsync::FinalizeMeshRequest(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest)
 {
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(CurrentPrimitiveComponent))
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshRequest->PrimitiveComponent))
 	{
+		UStaticMesh* StaticMesh = Cast<UStaticMesh>(MeshRequest->Mesh);
 		DiscoveredStaticMeshComponents.Add(StaticMeshComponent, StaticMesh);
 		if (bShowWhileLoading)
 		{
@@ -201,42 +300,16 @@ void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
 				StaticMeshComponent->SetRelativeTransform(NewTransform);
 			}
 		}
-
 	}
-
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
-	{
-		LoadNextMeshAsync();
-	}
-	// trigger event
-	else
-	{
-		ScenesLoaded();
-	}
-}
-
-void AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh)
-{
-	if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(CurrentPrimitiveComponent))
+	else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(MeshRequest->PrimitiveComponent))
 	{
+		USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(MeshRequest->Mesh);
 		DiscoveredSkeletalMeshComponents.Add(SkeletalMeshComponent, SkeletalMesh);
 		if (bShowWhileLoading)
 		{
 			SkeletalMeshComponent->SetSkeletalMesh(SkeletalMesh);
 		}
 	}
-
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
-	{
-		LoadNextMeshAsync();
-	}
-	// trigger event
-	else
-	{
-		ScenesLoaded();
-	}
 }
 
 void AglTFRuntimeAssetActorAsync::ScenesLoaded()
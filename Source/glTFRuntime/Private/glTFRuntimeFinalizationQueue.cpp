@@ -0,0 +1,181 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeFinalizationQueue.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/IConsoleManager.h"
+#include "glTFRuntimeParser.h"
+
+DEFINE_STAT(STAT_glTFRuntime_FinalizationQueueTick);
+DEFINE_STAT(STAT_glTFRuntime_FinalizeStaticMeshResources);
+DEFINE_STAT(STAT_glTFRuntime_FinalizeStaticMeshCollisions);
+DEFINE_STAT(STAT_glTFRuntime_FinalizeStaticMeshSockets);
+DEFINE_STAT(STAT_glTFRuntime_FinalizeStaticMeshNavigation);
+DEFINE_STAT(STAT_glTFRuntime_FinalizeSkeletalMeshLODs);
+DEFINE_STAT(STAT_glTFRuntime_FinalizeSkeletalMeshMorphTargets);
+DEFINE_STAT(STAT_glTFRuntime_FinalizeSkeletalMeshPhysicsAsset);
+DEFINE_STAT(STAT_glTFRuntime_FinalizeSkeletalMeshResources);
+DEFINE_STAT(STAT_glTFRuntime_PendingFinalizationSteps);
+DEFINE_STAT(STAT_glTFRuntime_FinalizationStepsPerFrame);
+
+static TAutoConsoleVariable<float> CVarglTFRuntimeFinalizationBudget(
+	TEXT("glTFRuntime.FinalizationBudget"),
+	4.0f,
+	TEXT("Milliseconds per frame the game thread can spend finalizing async loaded meshes (at least one step is always run per frame, <= 0 runs all of the pending steps)."),
+	ECVF_Default);
+
+FglTFRuntimeFinalizationQueue& FglTFRuntimeFinalizationQueue::Get()
+{
+	static FglTFRuntimeFinalizationQueue Queue;
+	return Queue;
+}
+
+void FglTFRuntimeFinalizationQueue::Startup()
+{
+	check(IsInGameThread());
+
+#if ENGINE_MAJOR_VERSION > 4
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FglTFRuntimeFinalizationQueue::Tick));
+#else
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FglTFRuntimeFinalizationQueue::Tick));
+#endif
+
+	FScopeLock Lock(&IncomingJobsLock);
+	bStarted = true;
+}
+
+void FglTFRuntimeFinalizationQueue::Shutdown()
+{
+	check(IsInGameThread());
+
+	{
+		FScopeLock Lock(&IncomingJobsLock);
+		bStarted = false;
+	}
+
+#if ENGINE_MAJOR_VERSION > 4
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+	FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+
+	FScopeLock Lock(&IncomingJobsLock);
+	IncomingJobs.Empty();
+	Jobs.Empty();
+	SET_DWORD_STAT(STAT_glTFRuntime_PendingFinalizationSteps, 0);
+}
+
+void FglTFRuntimeFinalizationQueue::Enqueue(TArray<FglTFRuntimeFinalizationStep>&& Steps)
+{
+	if (Steps.Num() == 0)
+	{
+		return;
+	}
+
+	FJob Job;
+	Job.Steps = MoveTemp(Steps);
+
+	{
+		FScopeLock Lock(&IncomingJobsLock);
+		if (bStarted)
+		{
+			INC_DWORD_STAT_BY(STAT_glTFRuntime_PendingFinalizationSteps, Job.Steps.Num());
+			IncomingJobs.Add(MoveTemp(Job));
+			return;
+		}
+	}
+
+	// no ticker available (e.g. the module is shutting down), just run the whole job in a single game thread task
+	FFunctionGraphTask::CreateAndDispatchWhenReady([Job = MoveTemp(Job)]() mutable
+		{
+			for (FglTFRuntimeFinalizationStep& Step : Job.Steps)
+			{
+				Step.Function();
+			}
+		}, TStatId(), nullptr, ENamedThreads::GameThread);
+}
+
+int32 FglTFRuntimeFinalizationQueue::GetNumPendingJobs() const
+{
+	FScopeLock Lock(&IncomingJobsLock);
+	return IncomingJobs.Num() + Jobs.Num();
+}
+
+void FglTFRuntimeFinalizationQueue::DrainIncomingJobs()
+{
+	FScopeLock Lock(&IncomingJobsLock);
+	for (FJob& Job : IncomingJobs)
+	{
+		Jobs.Add(MoveTemp(Job));
+	}
+	IncomingJobs.Empty();
+}
+
+void FglTFRuntimeFinalizationQueue::RunStep(FJob& Job)
+{
+	FglTFRuntimeFinalizationStep& Step = Job.Steps[Job.NextStep++];
+
+	SCOPED_NAMED_EVENT_TCHAR(Step.Name, FColor::Magenta);
+
+	const double StartTime = FPlatformTime::Seconds();
+	Step.Function();
+	// release the captured contexts as soon as possible
+	Step.Function = nullptr;
+
+	UE_LOG(LogGLTFRuntime, Verbose, TEXT("Finalization step %s completed in %f ms"), Step.Name, (FPlatformTime::Seconds() - StartTime) * 1000);
+
+	DEC_DWORD_STAT(STAT_glTFRuntime_PendingFinalizationSteps);
+	INC_DWORD_STAT(STAT_glTFRuntime_FinalizationStepsPerFrame);
+}
+
+bool FglTFRuntimeFinalizationQueue::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizationQueueTick);
+
+	DrainIncomingJobs();
+
+	const float Budget = CVarglTFRuntimeFinalizationBudget.GetValueOnGameThread();
+	const double EndTime = FPlatformTime::Seconds() + Budget / 1000.0;
+
+	bool bFirstStep = true;
+	while (Jobs.Num() > 0)
+	{
+		if (!bFirstStep && Budget > 0 && FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+
+		// steps could enqueue new jobs or flush the queue, so always work on a copy of the job
+		FJob Job = MoveTemp(Jobs[0]);
+		Jobs.RemoveAt(0);
+
+		RunStep(Job);
+		bFirstStep = false;
+
+		if (Job.NextStep < Job.Steps.Num())
+		{
+			Jobs.Insert(MoveTemp(Job), 0);
+		}
+	}
+
+	return true;
+}
+
+void FglTFRuntimeFinalizationQueue::Flush()
+{
+	check(IsInGameThread());
+
+	DrainIncomingJobs();
+
+	while (Jobs.Num() > 0)
+	{
+		FJob Job = MoveTemp(Jobs[0]);
+		Jobs.RemoveAt(0);
+
+		while (Job.NextStep < Job.Steps.Num())
+		{
+			RunStep(Job);
+		}
+
+		DrainIncomingJobs();
+	}
+}
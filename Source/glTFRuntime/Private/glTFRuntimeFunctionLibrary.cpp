@@ -61,11 +61,11 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 		OverrideConfig.bSearchContentDir = true;
 	}
 
-	Async(EAsyncExecution::Thread, [Filename, Asset, Completed, OverrideConfig]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(OverrideConfig.AsyncPriority, UglTFRuntimeCancellationToken::GetTokenFlag(OverrideConfig.CancellationToken), [Filename, Asset, Completed, OverrideConfig]()
 		{
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, OverrideConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -76,7 +76,12 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+		}, [Completed]()
+		{
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				{
+					Completed.ExecuteIfBound(nullptr);
+				}, TStatId(), nullptr, ENamedThreads::GameThread);
 		});
 }
 
@@ -137,23 +142,22 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromBase64Async(const FString& Ba
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [Base64, Asset, LoaderConfig, Completed]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(LoaderConfig.AsyncPriority, UglTFRuntimeCancellationToken::GetTokenFlag(LoaderConfig.CancellationToken), [Base64, Asset, LoaderConfig, Completed]()
 		{
 			TArray<uint8> BytesBase64;
 
 			if (!FBase64::Decode(Base64, BytesBase64))
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
 					{
 						Completed.ExecuteIfBound(nullptr);
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(BytesBase64, LoaderConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -164,7 +168,12 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromBase64Async(const FString& Ba
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+		}, [Completed]()
+		{
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				{
+					Completed.ExecuteIfBound(nullptr);
+				}, TStatId(), nullptr, ENamedThreads::GameThread);
 		});
 }
 
@@ -205,7 +214,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [String, Asset, LoaderConfig, Completed]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(LoaderConfig.AsyncPriority, UglTFRuntimeCancellationToken::GetTokenFlag(LoaderConfig.CancellationToken), [String, Asset, LoaderConfig, Completed]()
 		{
 #if ENGINE_MAJOR_VERSION >= 5
 			auto UTF8String = StringCast<UTF8CHAR>(*String);
@@ -215,7 +224,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString
 
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(reinterpret_cast<const uint8*>(UTF8String.Get()), UTF8String.Length(), LoaderConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -226,7 +235,12 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+		}, [Completed]()
+		{
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				{
+					Completed.ExecuteIfBound(nullptr);
+				}, TStatId(), nullptr, ENamedThreads::GameThread);
 		});
 }
 
@@ -242,11 +256,11 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromStringAsync(const FString& Js
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [JsonData, Asset, LoaderConfig, Completed]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(LoaderConfig.AsyncPriority, UglTFRuntimeCancellationToken::GetTokenFlag(LoaderConfig.CancellationToken), [JsonData, Asset, LoaderConfig, Completed]()
 		{
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromString(JsonData, LoaderConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -257,7 +271,12 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromStringAsync(const FString& Js
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+		}, [Completed]()
+		{
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				{
+					Completed.ExecuteIfBound(nullptr);
+				}, TStatId(), nullptr, ENamedThreads::GameThread);
 		});
 }
 
@@ -305,7 +324,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FStri
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [FileMap, Asset, LoaderConfig, Completed]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(LoaderConfig.AsyncPriority, UglTFRuntimeCancellationToken::GetTokenFlag(LoaderConfig.CancellationToken), [FileMap, Asset, LoaderConfig, Completed]()
 		{
 			TMap<FString, TArray64<uint8>> Map;
 
@@ -320,7 +339,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FStri
 
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromMap(Map, LoaderConfig);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
 				{
 					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
@@ -331,7 +350,12 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FStri
 						Completed.ExecuteIfBound(nullptr);
 					}
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+		}, [Completed]()
+		{
+			FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				{
+					Completed.ExecuteIfBound(nullptr);
+				}, TStatId(), nullptr, ENamedThreads::GameThread);
 		});
 }
 
@@ -969,4 +993,15 @@ UBlendSpace1D* UglTFRuntimeFunctionLibrary::CreateRuntimeBlendSpace1D(const FStr
 #else
 	return nullptr;
 #endif
-}
\ No newline at end of file
+}
+
+UglTFRuntimeCancellationToken* UglTFRuntimeFunctionLibrary::glTFCreateCancellationToken()
+{
+	return NewObject<UglTFRuntimeCancellationToken>();
+}
+
+void UglTFRuntimeFunctionLibrary::glTFGetAsyncTasksCounters(int32& NumQueuedTasks, int32& NumInFlightTasks)
+{
+	NumQueuedTasks = FglTFRuntimeTaskQueue::Get().GetNumQueuedTasks();
+	NumInFlightTasks = FglTFRuntimeTaskQueue::Get().GetNumInFlightTasks();
+}
@@ -19,6 +19,9 @@
 #include "Misc/Compression.h"
 #include "Misc/Crc.h"
 #include "Misc/Paths.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
 #include "Interfaces/IPluginManager.h"
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 2
 #include "RenderMath.h"
@@ -79,14 +82,49 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 		}
 	}
 
-	TArray64<uint8> Content;
-	if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+	TSharedPtr<FglTFRuntimeParser> Parser = nullptr;
+
+	// zip entries will be read on demand from the file
+	TSharedPtr<FglTFRuntimeArchiveZipFile> StreamedZipFile = nullptr;
+	if (LoaderConfig.bStreamZipFromFile && !LoaderConfig.bNoArchive && !LoaderConfig.bAsBlob)
 	{
-		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
-		return nullptr;
+		StreamedZipFile = MakeShared<FglTFRuntimeArchiveZipFile>();
+		if (!StreamedZipFile->FromFilename(TruePath))
+		{
+			StreamedZipFile = nullptr;
+		}
+	}
+
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile = nullptr;
+	if (!StreamedZipFile && LoaderConfig.bMemoryMapFile)
+	{
+		MappedFile = FglTFRuntimeMappedFile::Open(TruePath);
+		if (!MappedFile)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to memory map file %s, falling back to standard loading"), *Filename);
+		}
+	}
+
+	if (StreamedZipFile)
+	{
+		StreamedZipFile->ApplyLoaderConfig(LoaderConfig);
+		Parser = FromRawDataAndArchive(nullptr, 0, StreamedZipFile, LoaderConfig);
 	}
+	else if (MappedFile)
+	{
+		Parser = FromMappedFile(MappedFile.ToSharedRef(), LoaderConfig);
+	}
+	else
+	{
+		TArray64<uint8> Content;
+		if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
+			return nullptr;
+		}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+		Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+	}
 
 	if (Parser)
 	{
@@ -96,6 +134,20 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 			Parser->BaseDirectory = FPaths::GetPath(TruePath);
 		}
 		Parser->BaseFilename = FPaths::GetBaseFilename(TruePath);
+
+		// external files can be resolved only now
+		if (!Parser->BaseDirectory.IsEmpty())
+		{
+			if (LoaderConfig.bPrefetchBuffers)
+			{
+				Parser->PrefetchBuffers();
+			}
+
+			if (LoaderConfig.bPrefetchCompressedBufferViews)
+			{
+				Parser->PrefetchCompressedBufferViews();
+			}
+		}
 	}
 
 	return Parser;
@@ -160,26 +212,38 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const u
 		return NewParser;
 	}
 
+	TSharedPtr<FglTFRuntimeParser> Parser = nullptr;
+
 	// detect binary format
-	if (DataNum > 20)
+	if (DataNum > 20 &&
+		DataPtr[0] == 0x67 &&
+		DataPtr[1] == 0x6C &&
+		DataPtr[2] == 0x54 &&
+		DataPtr[3] == 0x46)
 	{
-		if (DataPtr[0] == 0x67 &&
-			DataPtr[1] == 0x6C &&
-			DataPtr[2] == 0x54 &&
-			DataPtr[3] == 0x46)
-		{
-			return FromBinary(DataPtr, DataNum, LoaderConfig, InArchive);
-		}
+		Parser = FromBinary(DataPtr, DataNum, LoaderConfig, InArchive);
+	}
+	else if (DataNum > 0 && DataNum <= INT32_MAX)
+	{
+		Parser = FromUTF8(DataPtr, DataNum, LoaderConfig, InArchive);
 	}
 
-	if (DataNum > 0 && DataNum <= INT32_MAX)
+	if (!Parser)
 	{
-		FString JsonData;
-		FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
-		return FromString(JsonData, LoaderConfig, InArchive);
+		return nullptr;
 	}
 
-	return nullptr;
+	if (LoaderConfig.bPrefetchBuffers)
+	{
+		Parser->PrefetchBuffers();
+	}
+
+	if (LoaderConfig.bPrefetchCompressedBufferViews)
+	{
+		Parser->PrefetchCompressedBufferViews();
+	}
+
+	return Parser;
 }
 
 TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
@@ -485,20 +549,7 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 	if (!LoaderConfig.bNoArchive && DataNum > 4 && DataPtr[0] == 0x50 && DataPtr[1] == 0x4b && DataPtr[2] == 0x03 && DataPtr[3] == 0x04)
 	{
 		TSharedPtr<FglTFRuntimeArchiveZip> ZipFile = MakeShared<FglTFRuntimeArchiveZip>();
-		if (!LoaderConfig.EncryptionKey.IsEmpty())
-		{
-			ZipFile->SetPassword(LoaderConfig.EncryptionKey);
-		}
-
-		if (LoaderConfig.PasswordPromptHook.IsBound())
-		{
-			ZipFile->PromptHook = LoaderConfig.PasswordPromptHook;
-		}
-
-		if (LoaderConfig.AESDecrypterHook.IsBound())
-		{
-			ZipFile->AESDecrypterHook = LoaderConfig.AESDecrypterHook;
-		}
+		ZipFile->ApplyLoaderConfig(LoaderConfig);
 
 		if (!ZipFile->FromData(DataPtr, DataNum))
 		{
@@ -636,7 +687,64 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 	if (!JsonObject)
 		return nullptr;
 
-	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject.ToSharedRef(), LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
+	return FromJsonObject(JsonObject.ToSharedRef(), LoaderConfig, InArchive);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromUTF8(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromUTF8, FColor::Magenta);
+
+	// skip UTF-8 BOM
+	if (DataNum >= 3 && DataPtr[0] == 0xEF && DataPtr[1] == 0xBB && DataPtr[2] == 0xBF)
+	{
+		DataPtr += 3;
+		DataNum -= 3;
+	}
+
+	if (DataNum <= 0 || DataNum > INT32_MAX)
+	{
+		return nullptr;
+	}
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
+	// the UTF-8 reader works on code units, so parse in place only pure ASCII documents (the vast majority of glTF files)
+	// and fallback to TCHAR conversion when multibyte sequences are found
+	bool bIsASCII = true;
+	for (int64 ByteIndex = 0; ByteIndex < DataNum; ByteIndex++)
+	{
+		if (DataPtr[ByteIndex] & 0x80)
+		{
+			bIsASCII = false;
+			break;
+		}
+	}
+
+	if (bIsASCII)
+	{
+		TSharedPtr<FJsonValue> RootValue;
+
+		TSharedRef<TJsonReader<UTF8CHAR>> JsonReader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(DataPtr), (int32)DataNum));
+		if (!FJsonSerializer::Deserialize(JsonReader, RootValue))
+		{
+			return nullptr;
+		}
+
+		TSharedPtr<FJsonObject> JsonObject = RootValue->AsObject();
+		if (!JsonObject)
+			return nullptr;
+
+		return FromJsonObject(JsonObject.ToSharedRef(), LoaderConfig, InArchive);
+	}
+#endif
+
+	FString JsonData;
+	FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
+	return FromString(JsonData, LoaderConfig, InArchive);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromJsonObject(TSharedRef<FJsonObject> JsonObject, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject, LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
 
 	if (Parser)
 	{
@@ -652,20 +760,21 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 			}
 		}
 		Parser->DefaultPrefixForUnnamedNodes = LoaderConfig.PrefixForUnnamedNodes;
+		Parser->bMemoryMapBuffers = LoaderConfig.bMemoryMapFile;
 		Parser->Archive = InArchive;
 		Parser->AssetUserDataClasses = LoaderConfig.AssetUserDataClasses;
+
+		if (LoaderConfig.bIndexJsonTables)
+		{
+			Parser->BuildJsonTables();
+		}
 	}
 
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+bool FglTFRuntimeParser::GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, FglTFRuntimeBlob& JsonChunk, FglTFRuntimeBlob& BinaryChunk)
 {
-	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
-
-	FString JsonData;
-	TArray64<uint8> BinaryBuffer;
-
 	bool bJsonFound = false;
 	bool bBinaryFound = false;
 	int64 BlobIndex = 12;
@@ -674,46 +783,99 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 	{
 		if (BlobIndex + 8 > DataNum)
 		{
-			return nullptr;
+			return false;
 		}
 
-		uint32* ChunkLength = (uint32*)&DataPtr[BlobIndex];
-		uint32* ChunkType = (uint32*)&DataPtr[BlobIndex + 4];
+		const uint32* ChunkLength = (const uint32*)&DataPtr[BlobIndex];
+		const uint32* ChunkType = (const uint32*)&DataPtr[BlobIndex + 4];
 
 		BlobIndex += 8;
 
 		if ((BlobIndex + *ChunkLength) > DataNum)
 		{
-			return nullptr;
+			return false;
 		}
 
+		// blobs are never written, so we can safely reference the original data
 		if (*ChunkType == 0x4E4F534A && !bJsonFound)
 		{
 			bJsonFound = true;
-			FFileHelper::BufferToString(JsonData, &DataPtr[BlobIndex], *ChunkLength);
+			JsonChunk.Data = const_cast<uint8*>(&DataPtr[BlobIndex]);
+			JsonChunk.Num = *ChunkLength;
 		}
 
 		else if (*ChunkType == 0x004E4942 && !bBinaryFound)
 		{
 			bBinaryFound = true;
-			BinaryBuffer.Append(&DataPtr[BlobIndex], *ChunkLength);
+			BinaryChunk.Data = const_cast<uint8*>(&DataPtr[BlobIndex]);
+			BinaryChunk.Num = *ChunkLength;
 		}
 
 		BlobIndex += *ChunkLength;
 	}
 
-	if (!bJsonFound)
+	return bJsonFound;
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
+
+	FglTFRuntimeBlob JsonChunk;
+	FglTFRuntimeBlob BinaryChunk;
+
+	if (!GetBinaryChunks(DataPtr, DataNum, JsonChunk, BinaryChunk))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(JsonChunk.Data, JsonChunk.Num, LoaderConfig, InArchive);
+
+	if (Parser)
+	{
+		if (BinaryChunk.Data)
+		{
+			Parser->BinaryBuffer.Append(BinaryChunk.Data, BinaryChunk.Num);
+		}
+	}
+
+	return Parser;
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromMappedFile(TSharedRef<FglTFRuntimeMappedFile> InMappedFile, const FglTFRuntimeConfig& LoaderConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromMappedFile, FColor::Magenta);
+
+	const uint8* DataPtr = InMappedFile->GetData();
+	const int64 DataNum = InMappedFile->Num();
+
+	// only plain GLB files can be referenced in place, compressed data and archives need to be unpacked in memory anyway
+	const bool bIsBinary = DataNum > 20 &&
+		DataPtr[0] == 0x67 &&
+		DataPtr[1] == 0x6C &&
+		DataPtr[2] == 0x54 &&
+		DataPtr[3] == 0x46;
+
+	if (LoaderConfig.bAsBlob || !bIsBinary)
+	{
+		return FromData(DataPtr, DataNum, LoaderConfig);
+	}
+
+	FglTFRuntimeBlob JsonChunk;
+	FglTFRuntimeBlob BinaryChunk;
+
+	if (!GetBinaryChunks(DataPtr, DataNum, JsonChunk, BinaryChunk))
 	{
 		return nullptr;
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromString(JsonData, LoaderConfig, InArchive);
+	TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(JsonChunk.Data, JsonChunk.Num, LoaderConfig, nullptr);
 
 	if (Parser)
 	{
-		if (bBinaryFound)
+		if (BinaryChunk.Data)
 		{
-			Parser->SetBinaryBuffer(BinaryBuffer);
+			Parser->SetMappedBinaryBuffer(InMappedFile, BinaryChunk);
 		}
 	}
 
@@ -871,6 +1033,8 @@ FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const
 {
 	bAllNodesCached = false;
 	DownloadTime = 0;
+	bMemoryMapBuffers = false;
+	bJsonTablesIndexed = false;
 
 	if (IsInGameThread())
 	{
@@ -916,6 +1080,8 @@ FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const
 
 bool FglTFRuntimeParser::LoadNodes()
 {
+	FScopeLock Lock(&NodesCacheLock);
+
 	if (bAllNodesCached)
 	{
 		return true;
@@ -1068,13 +1234,36 @@ bool FglTFRuntimeParser::CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, cons
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index) const
 {
-	TArray<TSharedRef<FJsonValue>> JsonArray;
-	if (!CheckJsonIndex(JsonObject, FieldName, Index, JsonArray))
+	if (Index < 0)
+	{
+		return nullptr;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+	if (!JsonObject->TryGetArrayField(FieldName, JsonArray))
+	{
+		return nullptr;
+	}
+
+	if (Index >= JsonArray->Num())
 	{
 		return nullptr;
 	}
 
-	return JsonArray[Index]->AsObject();
+	return (*JsonArray)[Index]->AsObject();
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const
+{
+	if (bJsonTablesIndexed)
+	{
+		const TArray<TSharedPtr<FJsonObject>>* Table = RootObjectsTables.Find(FieldName);
+		if (Table)
+		{
+			return Table->IsValidIndex(Index) ? (*Table)[Index] : nullptr;
+		}
+	}
+	return GetJsonObjectFromIndex(Root, FieldName, Index);
 }
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index)
@@ -1359,6 +1548,8 @@ bool FglTFRuntimeParser::LoadScene(int32 SceneIndex, FglTFRuntimeScene& Scene)
 
 bool FglTFRuntimeParser::GetAllNodes(TArray<FglTFRuntimeNode>& Nodes)
 {
+	FScopeLock Lock(&NodesCacheLock);
+
 	if (!bAllNodesCached)
 	{
 		if (!LoadNodes())
@@ -1374,6 +1565,8 @@ bool FglTFRuntimeParser::GetAllNodes(TArray<FglTFRuntimeNode>& Nodes)
 
 int32 FglTFRuntimeParser::AddFakeRootNode(const FString& BaseName)
 {
+	FScopeLock Lock(&NodesCacheLock);
+
 	TArray<int32> OrphanNodes;
 	TArray<FglTFRuntimeNode> AllNodes;
 
@@ -1409,6 +1602,8 @@ int32 FglTFRuntimeParser::AddFakeRootNode(const FString& BaseName)
 
 bool FglTFRuntimeParser::LoadNode(const int32 Index, FglTFRuntimeNode& Node)
 {
+	FScopeLock Lock(&NodesCacheLock);
+
 	// a bit hacky, but allows zero-copy for cached values
 	if (!bAllNodesCached)
 	{
@@ -1429,6 +1624,8 @@ bool FglTFRuntimeParser::LoadNode(const int32 Index, FglTFRuntimeNode& Node)
 
 bool FglTFRuntimeParser::LoadNodeByName(const FString& Name, FglTFRuntimeNode& Node)
 {
+	FScopeLock Lock(&NodesCacheLock);
+
 	// a bit hacky, but allows zero-copy for cached values
 	if (!bAllNodesCached)
 	{
@@ -1488,7 +1685,10 @@ bool FglTFRuntimeParser::LoadJointByName(const int64 RootBoneIndex, const FStrin
 void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	FString FullMessage = ErrorContext + ": " + ErrorMessage;
-	Errors.Add(FullMessage);
+	{
+		FScopeLock Lock(&ErrorsLock);
+		Errors.Add(FullMessage);
+	}
 	UE_LOG(LogGLTFRuntime, Error, TEXT("%s"), *FullMessage);
 	if (OnError.IsBound())
 	{
@@ -1498,16 +1698,19 @@ void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& Er
 
 bool FglTFRuntimeParser::HasErrors() const
 {
+	FScopeLock Lock(&ErrorsLock);
 	return Errors.Num() > 0;
 }
 
-const TArray<FString>& FglTFRuntimeParser::GetErrors() const
+TArray<FString> FglTFRuntimeParser::GetErrors() const
 {
+	FScopeLock Lock(&ErrorsLock);
 	return Errors;
 }
 
 void FglTFRuntimeParser::ClearErrors()
 {
+	FScopeLock Lock(&ErrorsLock);
 	Errors.Empty();
 }
 
@@ -2192,9 +2395,13 @@ USkeleton* FglTFRuntimeParser::LoadSkeleton(const int32 SkinIndex, const FglTFRu
 		return nullptr;
 	}
 
-	if (CanReadFromCache(SkeletonConfig.CacheMode) && SkeletonsCache.Contains(SkinIndex))
+	if (CanReadFromCache(SkeletonConfig.CacheMode))
 	{
-		return SkeletonsCache[SkinIndex];
+		FScopeLock Lock(&MeshesCacheLock);
+		if (SkeletonsCache.Contains(SkinIndex))
+		{
+			return SkeletonsCache[SkinIndex];
+		}
 	}
 
 	TMap<int32, FName> BoneMap;
@@ -2238,6 +2445,7 @@ USkeleton* FglTFRuntimeParser::LoadSkeleton(const int32 SkinIndex, const FglTFRu
 
 	if (CanWriteToCache(SkeletonConfig.CacheMode))
 	{
+		FScopeLock Lock(&MeshesCacheLock);
 		SkeletonsCache.Add(SkinIndex, Skeleton);
 	}
 
@@ -2917,7 +3125,7 @@ bool FglTFRuntimeParser::TraverseJoints(FReferenceSkeletonModifier& Modifier, co
 	return true;
 }
 
-bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines)
+bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, const bool bCompactVertexStreams)
 {
 	// get primitives
 	const TArray<TSharedPtr<FJsonValue>>* JsonPrimitives;
@@ -2938,7 +3146,7 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 		}
 
 		FglTFRuntimePrimitive Primitive;
-		if (!LoadPrimitive(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig, bTriangulatePointsAndLines))
+		if (!LoadPrimitive(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig, bTriangulatePointsAndLines, bCompactVertexStreams))
 		{
 			return false;
 		}
@@ -2946,7 +3154,7 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 		// add the primitive only if it has at least one index 
 		if (Primitive.Indices.Num() > 0)
 		{
-			Primitives.Add(Primitive);
+			Primitives.Add(MoveTemp(Primitive));
 		}
 	}
 
@@ -3050,7 +3258,7 @@ FTransform FglTFRuntimeParser::TransformTransform(const FTransform& Transform) c
 	return NewTransform;
 }
 
-bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines)
+bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, const bool bCompactVertexStreams)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_LoadPrimitive, FColor::Magenta);
 
@@ -3089,6 +3297,10 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	const bool bHasMeshQuantization = ExtensionsRequired.Contains("KHR_mesh_quantization");
 
+	// compact streams can be used only for triangles (points and lines triangulation, sections merging and primitive/static mesh hooks require the double precision arrays)
+	Primitive.bCompactVertexStreams = bCompactVertexStreams && Primitive.Mode >= 4 && !MaterialsConfig.bMergeSectionsByMaterial &&
+		!OnPreLoadedPrimitive.IsBound() && !OnLoadedPrimitive.IsBound() && !OnPreCreatedStaticMesh.IsBound() && !OnPostCreatedStaticMesh.IsBound();
+
 	TArray<int64> SupportedPositionComponentTypes = { 5126 };
 	TArray<int64> SupportedNormalComponentTypes = { 5126 };
 	TArray<int64> SupportedTangentComponentTypes = { 5126 };
@@ -3102,69 +3314,68 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		SupportedTexCoordComponentTypes.Append({ 5120, 5122 });
 	}
 
-	if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions,
-		{ 3 }, SupportedPositionComponentTypes, [&](FVector Value) -> FVector {return SceneBasis.TransformPosition(Value) * SceneScale; }, Primitive.AdditionalBufferView, false, nullptr))
+	if (Primitive.bCompactVertexStreams)
 	{
-		AddError("LoadPrimitive()", "Unable to load POSITION attribute");
-		return false;
-	}
-
-	if ((*JsonAttributesObject)->HasField(TEXT("NORMAL")))
-	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
-			{ 3 }, SupportedNormalComponentTypes, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, Primitive.AdditionalBufferView, true, nullptr))
+		if (!LoadPrimitiveCompactVertexStreams(JsonAttributesObject->ToSharedRef(), Primitive, SupportedPositionComponentTypes, SupportedNormalComponentTypes, SupportedTangentComponentTypes, SupportedTexCoordComponentTypes, bHasMeshQuantization))
 		{
-			AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
 			return false;
 		}
 	}
-
-	if ((*JsonAttributesObject)->HasField(TEXT("TANGENT")))
+	else
 	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents,
-			{ 4 }, SupportedTangentComponentTypes, [&](FVector4 Value) -> FVector4 { return SceneBasis.TransformFVector4(Value); }, Primitive.AdditionalBufferView, true, nullptr))
+		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions,
+			{ 3 }, SupportedPositionComponentTypes, [&](FVector Value) -> FVector {return SceneBasis.TransformPosition(Value) * SceneScale; }, Primitive.AdditionalBufferView, false, nullptr))
 		{
-			AddError("LoadPrimitive()", "Unable to load TANGENT attribute");
+			AddError("LoadPrimitive()", "Unable to load POSITION attribute");
 			return false;
 		}
-	}
 
-	if ((*JsonAttributesObject)->HasField(TEXT("TEXCOORD_0")))
-	{
-		TArray<FVector2D> UV;
-		int64 TexCoordComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_0", UV,
-			{ 2 }, SupportedTexCoordComponentTypes, [&](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
+		if ((*JsonAttributesObject)->HasField(TEXT("NORMAL")))
 		{
-			AddError("LoadPrimitive()", "Error loading TEXCOORD_0");
-			return false;
+			if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
+				{ 3 }, SupportedNormalComponentTypes, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, Primitive.AdditionalBufferView, true, nullptr))
+			{
+				AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
+				return false;
+			}
 		}
 
-		if (TexCoordComponentType == 5126)
+		if ((*JsonAttributesObject)->HasField(TEXT("TANGENT")))
 		{
-			Primitive.bHighPrecisionUVs = true;
+			if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents,
+				{ 4 }, SupportedTangentComponentTypes, [&](FVector4 Value) -> FVector4 { return SceneBasis.TransformFVector4(Value); }, Primitive.AdditionalBufferView, true, nullptr))
+			{
+				AddError("LoadPrimitive()", "Unable to load TANGENT attribute");
+				return false;
+			}
 		}
 
-		Primitive.UVs.Add(UV);
-	}
-
-	if ((*JsonAttributesObject)->HasField(TEXT("TEXCOORD_1")))
-	{
-		TArray<FVector2D> UV;
-		int64 TexCoordComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_1", UV,
-			{ 2 }, SupportedTexCoordComponentTypes, [&](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
+		for (int32 TexCoordIndex = 0; TexCoordIndex < MAX_STATIC_TEXCOORDS; TexCoordIndex++)
 		{
-			AddError("LoadPrimitive()", "Error loading TEXCOORD_1");
-			return false;
-		}
+			const FString TexCoordName = FString::Printf(TEXT("TEXCOORD_%d"), TexCoordIndex);
+			if (!(*JsonAttributesObject)->HasField(TexCoordName))
+			{
+				continue;
+			}
 
-		if (TexCoordComponentType == 5126)
-		{
-			Primitive.bHighPrecisionUVs = true;
-		}
+			TArray<FVector2D> UV;
+			int64 TexCoordComponentType = 0;
+			if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), TexCoordName, UV,
+				{ 2 }, SupportedTexCoordComponentTypes, [&](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
+			{
+				AddError("LoadPrimitive()", FString::Printf(TEXT("Error loading %s"), *TexCoordName));
+				return false;
+			}
+
+			// half precision is enough for normalized integers
+			Primitive.HighPrecisionUVChannels.Add(TexCoordComponentType == 5126);
+			if (TexCoordComponentType == 5126)
+			{
+				Primitive.bHighPrecisionUVs = true;
+			}
 
-		Primitive.UVs.Add(UV);
+			Primitive.UVs.Add(UV);
+		}
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("JOINTS_0")))
@@ -3263,7 +3474,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		Primitive.Weights.Add(Weights);
 	}
 
-	if ((*JsonAttributesObject)->HasField(TEXT("COLOR_0")))
+	if (!Primitive.bCompactVertexStreams && (*JsonAttributesObject)->HasField(TEXT("COLOR_0")))
 	{
 		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "COLOR_0", Primitive.Colors,
 			{ 3, 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, nullptr))
@@ -3273,8 +3484,9 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		}
 	}
 
+	// morph targets are not used by compact primitives (they are loaded only for skeletal meshes)
 	const TArray<TSharedPtr<FJsonValue>>* JsonTargetsArray;
-	if (JsonPrimitiveObject->TryGetArrayField(TEXT("targets"), JsonTargetsArray))
+	if (!Primitive.bCompactVertexStreams && JsonPrimitiveObject->TryGetArrayField(TEXT("targets"), JsonTargetsArray))
 	{
 		for (TSharedPtr<FJsonValue> JsonTargetItem : *JsonTargetsArray)
 		{
@@ -3382,15 +3594,15 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			});
 
 		// use indices only if their number is higher than positions (this reduces gpu usage on assets reusing the same POSITION buffer)
-		if (Primitive.Positions.Num() < Primitive.Indices.Num())
+		if (Primitive.GetNumVertices() < Primitive.Indices.Num())
 		{
 			Primitive.bHasIndices = true;
 		}
 	}
 	else
 	{
-		Primitive.Indices.AddUninitialized(Primitive.Positions.Num());
-		ParallelFor(Primitive.Positions.Num(), [&](const int32 VertexIndex)
+		Primitive.Indices.AddUninitialized(Primitive.GetNumVertices());
+		ParallelFor(Primitive.GetNumVertices(), [&](const int32 VertexIndex)
 			{
 				Primitive.Indices[VertexIndex] = VertexIndex;
 			});
@@ -3485,7 +3697,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 		if (MaterialIndex != INDEX_NONE)
 		{
-			Primitive.Material = LoadMaterial(MaterialIndex, MaterialsConfig, Primitive.Colors.Num() > 0, Primitive.MaterialName, ForceBaseMaterial);
+			Primitive.Material = LoadMaterial(MaterialIndex, MaterialsConfig, Primitive.HasColors(), Primitive.MaterialName, ForceBaseMaterial);
 			if (!Primitive.Material)
 			{
 				AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to load material %lld"), MaterialIndex));
@@ -3494,7 +3706,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			Primitive.bHasMaterial = true;
 		}
 		// special case for primitives without a material but with a color buffer
-		else if (Primitive.Colors.Num() > 0)
+		else if (Primitive.HasColors())
 		{
 			Primitive.Material = BuildVertexColorOnlyMaterial(MaterialsConfig, false);
 		}
@@ -3505,6 +3717,75 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 	return true;
 }
 
+bool FglTFRuntimeParser::LoadPrimitiveCompactVertexStreams(TSharedRef<FJsonObject> JsonAttributesObject, FglTFRuntimePrimitive& Primitive, const TArray<int64>& SupportedPositionComponentTypes, const TArray<int64>& SupportedNormalComponentTypes, const TArray<int64>& SupportedTangentComponentTypes, const TArray<int64>& SupportedTexCoordComponentTypes, const bool bHasMeshQuantization)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_LoadPrimitiveCompactVertexStreams, FColor::Magenta);
+
+	// accessors are decoded straight to single precision, scene basis conversion is still computed in double precision
+	if (!BuildConvertedFromAccessorField<FglTFRuntimeCompactVector3>(JsonAttributesObject, "POSITION", Primitive.CompactPositions,
+		{ 3 }, SupportedPositionComponentTypes, [&](FglTFRuntimeCompactVector3 Value) -> FglTFRuntimeCompactVector3 { return FglTFRuntimeCompactVector3(SceneBasis.TransformPosition(FVector(Value)) * SceneScale); }, Primitive.AdditionalBufferView, false, nullptr))
+	{
+		AddError("LoadPrimitive()", "Unable to load POSITION attribute");
+		return false;
+	}
+
+	if (JsonAttributesObject->HasField(TEXT("NORMAL")))
+	{
+		if (!BuildConvertedFromAccessorField<FglTFRuntimeCompactVector3>(JsonAttributesObject, "NORMAL", Primitive.CompactNormals,
+			{ 3 }, SupportedNormalComponentTypes, [&](FglTFRuntimeCompactVector3 Value) -> FglTFRuntimeCompactVector3 { return FglTFRuntimeCompactVector3(SceneBasis.TransformVector(FVector(Value))); }, Primitive.AdditionalBufferView, true, nullptr))
+		{
+			AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
+			return false;
+		}
+	}
+
+	if (JsonAttributesObject->HasField(TEXT("TANGENT")))
+	{
+		if (!BuildConvertedFromAccessorField<FglTFRuntimeCompactVector4>(JsonAttributesObject, "TANGENT", Primitive.CompactTangents,
+			{ 4 }, SupportedTangentComponentTypes, [&](FglTFRuntimeCompactVector4 Value) -> FglTFRuntimeCompactVector4 { return FglTFRuntimeCompactVector4(SceneBasis.TransformFVector4(FVector4(Value))); }, Primitive.AdditionalBufferView, true, nullptr))
+		{
+			AddError("LoadPrimitive()", "Unable to load TANGENT attribute");
+			return false;
+		}
+	}
+
+	for (int32 TexCoordIndex = 0; TexCoordIndex < MAX_STATIC_TEXCOORDS; TexCoordIndex++)
+	{
+		const FString TexCoordName = FString::Printf(TEXT("TEXCOORD_%d"), TexCoordIndex);
+		if (!JsonAttributesObject->HasField(TexCoordName))
+		{
+			continue;
+		}
+
+		TArray<FglTFRuntimeCompactVector2>& UV = Primitive.CompactUVs.AddDefaulted_GetRef();
+		int64 TexCoordComponentType = 0;
+		if (!BuildConvertedFromAccessorField<FglTFRuntimeCompactVector2>(JsonAttributesObject, TexCoordName, UV,
+			{ 2 }, SupportedTexCoordComponentTypes, [&](FglTFRuntimeCompactVector2 Value) -> FglTFRuntimeCompactVector2 { return Value; }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
+		{
+			AddError("LoadPrimitive()", FString::Printf(TEXT("Error loading %s"), *TexCoordName));
+			return false;
+		}
+
+		Primitive.HighPrecisionUVChannels.Add(TexCoordComponentType == 5126);
+		if (TexCoordComponentType == 5126)
+		{
+			Primitive.bHighPrecisionUVs = true;
+		}
+	}
+
+	if (JsonAttributesObject->HasField(TEXT("COLOR_0")))
+	{
+		if (!BuildConvertedFromAccessorField<FglTFRuntimeCompactVector4>(JsonAttributesObject, "COLOR_0", Primitive.CompactColors,
+			{ 3, 4 }, { 5126, 5121, 5123 }, [&](FglTFRuntimeCompactVector4 Value) -> FColor { return FLinearColor(Value.X, Value.Y, Value.Z, Value.W).ToFColor(true); }, Primitive.AdditionalBufferView, true, nullptr))
+		{
+			AddError("LoadPrimitive()", "Error loading COLOR_0");
+			return false;
+		}
+	}
+
+	return true;
+}
+
 UMaterialInterface* FglTFRuntimeParser::TriangulatePoints(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
 	TArray<uint32> PointsIndices;
@@ -4420,21 +4701,59 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		return true;
 	}
 
-	// first check cache
-	if (BuffersCache.Contains(Index))
+	if (Index == 0 && MappedBinaryBlob.Num > 0)
 	{
-		Blob.Data = BuffersCache[Index].GetData();
-		Blob.Num = BuffersCache[Index].Num();
+		Blob = MappedBinaryBlob;
 		return true;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* JsonBuffers;
+	// cached buffers are never moved in memory (only their TArray64 header is), so blobs stay valid until ReleaseBuffer()
+	auto FindCachedBuffer = [this, Index, &Blob]() -> bool
+		{
+			FReadScopeLock ReadLock(BuffersCacheLock);
+			if (const TArray64<uint8>* CachedBuffer = BuffersCache.Find(Index))
+			{
+				Blob.Data = const_cast<uint8*>(CachedBuffer->GetData());
+				Blob.Num = CachedBuffer->Num();
+				return true;
+			}
 
-	// no buffers ?
-	if (!Root->TryGetArrayField(TEXT("buffers"), JsonBuffers))
-	{
-		return false;
-	}
+			if (const TSharedPtr<FglTFRuntimeMappedFile>* CachedMappedBuffer = MappedBuffersCache.Find(Index))
+			{
+				Blob = (*CachedMappedBuffer)->GetBlob();
+				return true;
+			}
+			return false;
+		};
+
+	auto AddCachedBuffer = [this, Index, &Blob](TArray64<uint8>&& Data)
+		{
+			FWriteScopeLock WriteLock(BuffersCacheLock);
+			TArray64<uint8>& CachedBuffer = BuffersCache.Add(Index, MoveTemp(Data));
+			Blob.Data = CachedBuffer.GetData();
+			Blob.Num = CachedBuffer.Num();
+		};
+
+	// first check cache
+	if (FindCachedBuffer())
+	{
+		return true;
+	}
+
+	// another thread could have loaded the buffer while waiting for the lock
+	FScopeLock LoadLock(&BuffersLoadLock);
+	if (FindCachedBuffer())
+	{
+		return true;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonBuffers;
+
+	// no buffers ?
+	if (!Root->TryGetArrayField(TEXT("buffers"), JsonBuffers))
+	{
+		return false;
+	}
 
 	if (Index >= JsonBuffers->Num())
 	{
@@ -4465,9 +4784,7 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		TArray64<uint8> Base64Data;
 		if (ParseBase64Uri(Uri, Base64Data))
 		{
-			BuffersCache.Add(Index, Base64Data);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			AddCachedBuffer(MoveTemp(Base64Data));
 			return true;
 		}
 		return false;
@@ -4478,9 +4795,7 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		TArray64<uint8> ArchiveItemData;
 		if (Archive->GetFileContent(Uri, ArchiveItemData))
 		{
-			BuffersCache.Add(Index, ArchiveItemData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			AddCachedBuffer(MoveTemp(ArchiveItemData));
 			return true;
 		}
 	}
@@ -4488,12 +4803,24 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	// fallback
 	if (!BaseDirectory.IsEmpty())
 	{
+		if (bMemoryMapBuffers)
+		{
+			TSharedPtr<FglTFRuntimeMappedFile> MappedBuffer = FglTFRuntimeMappedFile::Open(FPaths::Combine(BaseDirectory, Uri));
+			if (MappedBuffer)
+			{
+				{
+					FWriteScopeLock WriteLock(BuffersCacheLock);
+					MappedBuffersCache.Add(Index, MappedBuffer);
+				}
+				Blob = MappedBuffer->GetBlob();
+				return true;
+			}
+		}
+
 		TArray64<uint8> FileData;
 		if (FFileHelper::LoadFileToArray(FileData, *FPaths::Combine(BaseDirectory, Uri)))
 		{
-			BuffersCache.Add(Index, FileData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			AddCachedBuffer(MoveTemp(FileData));
 			return true;
 		}
 	}
@@ -4502,6 +4829,180 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	return false;
 }
 
+void FglTFRuntimeParser::PrefetchBuffers()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_PrefetchBuffers, FColor::Magenta);
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonBuffers;
+	if (!Root->TryGetArrayField(TEXT("buffers"), JsonBuffers))
+	{
+		return;
+	}
+
+	struct FglTFRuntimePrefetchedBuffer
+	{
+		int32 Index;
+		FString Uri;
+		TArray64<uint8> Data;
+		bool bLoaded;
+	};
+
+	TArray<FglTFRuntimePrefetchedBuffer> PrefetchedBuffers;
+
+	for (int32 BufferIndex = 0; BufferIndex < JsonBuffers->Num(); BufferIndex++)
+	{
+		if (BufferIndex == 0 && (BinaryBuffer.Num() > 0 || MappedBinaryBlob.Num > 0))
+		{
+			continue;
+		}
+
+		{
+			FReadScopeLock ReadLock(BuffersCacheLock);
+			if (BuffersCache.Contains(BufferIndex) || MappedBuffersCache.Contains(BufferIndex))
+			{
+				continue;
+			}
+		}
+
+		TSharedPtr<FJsonObject> JsonBufferObject = (*JsonBuffers)[BufferIndex]->AsObject();
+		if (!JsonBufferObject)
+		{
+			continue;
+		}
+
+		FString Uri;
+		if (!JsonBufferObject->TryGetStringField(TEXT("uri"), Uri))
+		{
+			continue;
+		}
+
+		// memory mapping is lazy by design, no need to prefetch
+		if (bMemoryMapBuffers && !Archive && !Uri.StartsWith("data:"))
+		{
+			continue;
+		}
+
+		FglTFRuntimePrefetchedBuffer PrefetchedBuffer;
+		PrefetchedBuffer.Index = BufferIndex;
+		PrefetchedBuffer.Uri = Uri;
+		PrefetchedBuffer.bLoaded = false;
+		PrefetchedBuffers.Add(MoveTemp(PrefetchedBuffer));
+	}
+
+	if (PrefetchedBuffers.Num() == 0)
+	{
+		return;
+	}
+
+	// password prompts and decrypter hooks need the game thread, leave those entries to GetBuffer()
+	const bool bArchiveConcurrentReads = Archive && Archive->SupportsConcurrentReads();
+
+	// each task owns its slot, results are published to the cache only after the join
+	ParallelFor(PrefetchedBuffers.Num(), [&](const int32 PrefetchIndex)
+		{
+			FglTFRuntimePrefetchedBuffer& PrefetchedBuffer = PrefetchedBuffers[PrefetchIndex];
+			if (PrefetchedBuffer.Uri.StartsWith("data:"))
+			{
+				PrefetchedBuffer.bLoaded = ParseBase64Uri(PrefetchedBuffer.Uri, PrefetchedBuffer.Data);
+				return;
+			}
+
+			if (Archive)
+			{
+				if (!bArchiveConcurrentReads)
+				{
+					return;
+				}
+
+				if (Archive->GetFileContent(PrefetchedBuffer.Uri, PrefetchedBuffer.Data))
+				{
+					PrefetchedBuffer.bLoaded = true;
+					return;
+				}
+				PrefetchedBuffer.Data.Empty();
+			}
+
+			if (!BaseDirectory.IsEmpty() && !bMemoryMapBuffers)
+			{
+				PrefetchedBuffer.bLoaded = FFileHelper::LoadFileToArray(PrefetchedBuffer.Data, *FPaths::Combine(BaseDirectory, PrefetchedBuffer.Uri));
+			}
+		});
+
+	FWriteScopeLock WriteLock(BuffersCacheLock);
+	for (FglTFRuntimePrefetchedBuffer& PrefetchedBuffer : PrefetchedBuffers)
+	{
+		if (PrefetchedBuffer.bLoaded && !BuffersCache.Contains(PrefetchedBuffer.Index))
+		{
+			BuffersCache.Add(PrefetchedBuffer.Index, MoveTemp(PrefetchedBuffer.Data));
+		}
+	}
+}
+
+void FglTFRuntimeParser::PrefetchCompressedBufferViews()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_PrefetchCompressedBufferViews, FColor::Magenta);
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonBufferViews;
+	if (!Root->TryGetArrayField(TEXT("bufferViews"), JsonBufferViews))
+	{
+		return;
+	}
+
+	TArray<int32> CompressedBufferViews;
+	for (int32 BufferViewIndex = 0; BufferViewIndex < JsonBufferViews->Num(); BufferViewIndex++)
+	{
+		FglTFRuntimeBufferViewRecord LocalRecord;
+		const FglTFRuntimeBufferViewRecord* Record = &LocalRecord;
+		if (bJsonTablesIndexed)
+		{
+			Record = &BufferViewRecords[BufferViewIndex];
+		}
+		else
+		{
+			TSharedPtr<FJsonObject> JsonBufferViewObject = (*JsonBufferViews)[BufferViewIndex]->AsObject();
+			if (!JsonBufferViewObject)
+			{
+				continue;
+			}
+			ParseBufferViewRecord(JsonBufferViewObject.ToSharedRef(), LocalRecord);
+		}
+
+		if (!Record->bValid || !Record->bMeshOptCompressed)
+		{
+			continue;
+		}
+
+		// only already available buffers are considered (GetBuffer() would report an error for the not yet resolvable ones)
+		bool bBufferAvailable = Record->Buffer == 0 && (BinaryBuffer.Num() > 0 || MappedBinaryBlob.Num > 0);
+		if (!bBufferAvailable)
+		{
+			FReadScopeLock ReadLock(BuffersCacheLock);
+			bBufferAvailable = BuffersCache.Contains(Record->Buffer) || MappedBuffersCache.Contains(Record->Buffer);
+		}
+
+		if (bBufferAvailable)
+		{
+			CompressedBufferViews.Add(BufferViewIndex);
+		}
+	}
+
+	// every buffer view is decoded (and cached) by a different task
+	ParallelFor(CompressedBufferViews.Num(), [&](const int32 Index)
+		{
+			FglTFRuntimeBlob Blob;
+			int64 Stride;
+			GetBufferView(CompressedBufferViews[Index], Blob, Stride);
+		});
+}
+
+bool FglTFRuntimeParser::ReleaseBuffer(const int32 Index)
+{
+	FWriteScopeLock WriteLock(BuffersCacheLock);
+	bool bReleased = BuffersCache.Remove(Index) > 0;
+	bReleased |= MappedBuffersCache.Remove(Index) > 0;
+	return bReleased;
+}
+
 bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Bytes)
 {
 	const FString Base64Signature = ";base64,";
@@ -4523,149 +5024,133 @@ bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Byt
 	return bSuccess;
 }
 
-bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob, int64& Stride)
+void FglTFRuntimeParser::BuildJsonTables()
 {
-	TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex("bufferViews", Index);
-	if (!JsonBufferViewObject)
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_BuildJsonTables, FColor::Magenta);
+
+	RootObjectsTables.Empty();
+	AccessorRecords.Empty();
+	BufferViewRecords.Empty();
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Root->Values)
 	{
-		return false;
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+		if (!Pair.Value.IsValid() || !Pair.Value->TryGetArray(JsonArray))
+		{
+			continue;
+		}
+
+		TArray<TSharedPtr<FJsonObject>>& Table = RootObjectsTables.Add(Pair.Key);
+		Table.Reserve(JsonArray->Num());
+		for (const TSharedPtr<FJsonValue>& JsonValue : *JsonArray)
+		{
+			const TSharedPtr<FJsonObject>* JsonObject = nullptr;
+			Table.Add(JsonValue.IsValid() && JsonValue->TryGetObject(JsonObject) ? *JsonObject : nullptr);
+		}
 	}
 
-	TSharedPtr<FJsonObject> JsonBufferViewCompressedObject = GetJsonObjectExtension(JsonBufferViewObject.ToSharedRef(), "EXT_meshopt_compression");
-	if (JsonBufferViewCompressedObject)
+	if (const TArray<TSharedPtr<FJsonObject>>* JsonAccessors = RootObjectsTables.Find(TEXT("accessors")))
 	{
-		JsonBufferViewObject = JsonBufferViewCompressedObject;
-		if (CompressedBufferViewsCache.Contains(Index))
+		AccessorRecords.AddDefaulted(JsonAccessors->Num());
+		for (int32 AccessorIndex = 0; AccessorIndex < JsonAccessors->Num(); AccessorIndex++)
 		{
-			Blob.Data = CompressedBufferViewsCache[Index].GetData();
-			Blob.Num = CompressedBufferViewsCache[Index].Num();
-			Stride = CompressedBufferViewsStridesCache[Index];
-			return true;
+			if ((*JsonAccessors)[AccessorIndex])
+			{
+				ParseAccessorRecord((*JsonAccessors)[AccessorIndex].ToSharedRef(), AccessorRecords[AccessorIndex]);
+			}
 		}
 	}
 
-	int64 BufferIndex;
-	if (!JsonBufferViewObject->TryGetNumberField(TEXT("buffer"), BufferIndex))
+	if (const TArray<TSharedPtr<FJsonObject>>* JsonBufferViews = RootObjectsTables.Find(TEXT("bufferViews")))
 	{
-		return false;
+		BufferViewRecords.AddDefaulted(JsonBufferViews->Num());
+		for (int32 BufferViewIndex = 0; BufferViewIndex < JsonBufferViews->Num(); BufferViewIndex++)
+		{
+			if ((*JsonBufferViews)[BufferViewIndex])
+			{
+				ParseBufferViewRecord((*JsonBufferViews)[BufferViewIndex].ToSharedRef(), BufferViewRecords[BufferViewIndex]);
+			}
+		}
 	}
 
-	FglTFRuntimeBlob BufferBlob;
-	if (!GetBuffer(BufferIndex, BufferBlob))
+	bJsonTablesIndexed = true;
+}
+
+bool FglTFRuntimeParser::ParseBufferViewRecord(TSharedRef<FJsonObject> JsonBufferViewObject, FglTFRuntimeBufferViewRecord& Record) const
+{
+	TSharedPtr<FJsonObject> JsonBufferViewCompressedObject = GetJsonObjectExtension(JsonBufferViewObject, "EXT_meshopt_compression");
+	if (JsonBufferViewCompressedObject)
 	{
-		return false;
+		JsonBufferViewObject = JsonBufferViewCompressedObject.ToSharedRef();
+		Record.bMeshOptCompressed = true;
 	}
 
-	int64 ByteLength;
-	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteLength"), ByteLength))
+	if (!JsonBufferViewObject->TryGetNumberField(TEXT("buffer"), Record.Buffer))
 	{
 		return false;
 	}
 
-	int64 ByteOffset;
-	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteOffset"), ByteOffset))
+	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteLength"), Record.ByteLength))
 	{
-		ByteOffset = 0;
+		return false;
 	}
 
-	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteStride"), Stride))
+	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteOffset"), Record.ByteOffset))
 	{
-		Stride = 0;
+		Record.ByteOffset = 0;
 	}
 
-	if (ByteOffset + ByteLength > BufferBlob.Num)
+	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteStride"), Record.ByteStride))
 	{
-		return false;
+		Record.ByteStride = 0;
 	}
 
-	Blob.Data = BufferBlob.Data + ByteOffset;
-	Blob.Num = ByteLength;
-
-	if (JsonBufferViewCompressedObject)
+	if (Record.bMeshOptCompressed)
 	{
-		// decompress bitstream
-		if (Stride == 0)
-		{
-			return false;
-		}
-		int64 Elements;
-		if (!JsonBufferViewObject->TryGetNumberField(TEXT("count"), Elements))
+		if (!JsonBufferViewObject->TryGetNumberField(TEXT("count"), Record.MeshOptCount))
 		{
 			return false;
 		}
-		FString MeshOptMode;
-		if (!JsonBufferViewObject->TryGetStringField(TEXT("mode"), MeshOptMode))
+		if (!JsonBufferViewObject->TryGetStringField(TEXT("mode"), Record.MeshOptMode))
 		{
 			return false;
 		}
-		FString MeshOptFilter;
-		if (!JsonBufferViewObject->TryGetStringField(TEXT("filter"), MeshOptFilter))
-		{
-			MeshOptFilter = "NONE";
-		}
-
-		CompressedBufferViewsCache.Add(Index);
-		if (!DecompressMeshOptimizer(Blob, Stride, Elements, MeshOptMode, MeshOptFilter, CompressedBufferViewsCache[Index]))
+		if (!JsonBufferViewObject->TryGetStringField(TEXT("filter"), Record.MeshOptFilter))
 		{
-			CompressedBufferViewsCache.Remove(Index);
-			return false;
+			Record.MeshOptFilter = "NONE";
 		}
-		Blob.Data = CompressedBufferViewsCache[Index].GetData();
-		Blob.Num = CompressedBufferViewsCache[Index].Num();
-		CompressedBufferViewsStridesCache.Add(Index, Stride);
 	}
 
+	Record.bValid = true;
 	return true;
 }
 
-bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, const FglTFRuntimeBlob* AdditionalBufferView)
+bool FglTFRuntimeParser::ParseAccessorRecord(TSharedRef<FJsonObject> JsonAccessorObject, FglTFRuntimeAccessorRecord& Record) const
 {
-
-	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex("accessors", Index);
-	if (!JsonAccessorObject)
+	if (!JsonAccessorObject->TryGetNumberField(TEXT("bufferView"), Record.BufferView))
 	{
-		return false;
+		Record.BufferView = INDEX_NONE;
 	}
 
-	bool bInitWithZeros = false;
-	bool bHasSparse = false;
-
-	int64 BufferViewIndex = INDEX_NONE;
-	int64 ByteOffset = 0;
-
-	if (!AdditionalBufferView)
+	if (!JsonAccessorObject->TryGetNumberField(TEXT("byteOffset"), Record.ByteOffset))
 	{
-		if (!JsonAccessorObject->TryGetNumberField(TEXT("bufferView"), BufferViewIndex))
-		{
-			bInitWithZeros = true;
-		}
-
-
-		if (!JsonAccessorObject->TryGetNumberField(TEXT("byteOffset"), ByteOffset))
-		{
-			ByteOffset = 0;
-		}
+		Record.ByteOffset = 0;
 	}
 
 	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
 	if (JsonAccessorObject->TryGetObjectField(TEXT("sparse"), JsonSparseObject))
 	{
-		bHasSparse = true;
+		Record.JsonSparseObject = *JsonSparseObject;
 	}
 
-	const bool bOriginalNormalized = bNormalized;
-
-	if (!JsonAccessorObject->TryGetBoolField(TEXT("normalized"), bNormalized))
-	{
-		bNormalized = bOriginalNormalized;
-	}
+	Record.bHasNormalized = JsonAccessorObject->TryGetBoolField(TEXT("normalized"), Record.bNormalized);
 
-	if (!JsonAccessorObject->TryGetNumberField(TEXT("componentType"), ComponentType))
+	if (!JsonAccessorObject->TryGetNumberField(TEXT("componentType"), Record.ComponentType))
 	{
 		return false;
 	}
 
-	if (!JsonAccessorObject->TryGetNumberField(TEXT("count"), Count))
+	if (!JsonAccessorObject->TryGetNumberField(TEXT("count"), Record.Count))
 	{
 		return false;
 	}
@@ -4676,76 +5161,215 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		return false;
 	}
 
-	ElementSize = GetComponentTypeSize(ComponentType);
-	if (ElementSize == 0)
+	Record.ElementSize = GetComponentTypeSize(Record.ComponentType);
+	if (Record.ElementSize == 0)
 	{
 		return false;
 	}
 
-	Elements = GetTypeSize(Type);
-	if (Elements == 0)
+	Record.Elements = GetTypeSize(Type);
+	if (Record.Elements == 0)
 	{
 		return false;
 	}
 
-	int64 FinalSize = ElementSize * Elements * Count;
+	Record.bValid = true;
+	return true;
+}
 
-	if (AdditionalBufferView)
+bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob, int64& Stride)
+{
+	FglTFRuntimeBufferViewRecord LocalRecord;
+	const FglTFRuntimeBufferViewRecord* Record = nullptr;
+	if (bJsonTablesIndexed)
 	{
-		if (AdditionalBufferView->Num < FinalSize)
+		if (!BufferViewRecords.IsValidIndex(Index))
 		{
 			return false;
 		}
-		Blob.Data = AdditionalBufferView->Data;
-		Blob.Num = FinalSize;
-
-		// special case for bigger buffers
-		if (FinalSize < AdditionalBufferView->Num && (AdditionalBufferView->Num % (ElementSize * Elements)) == 0)
+		Record = &BufferViewRecords[Index];
+	}
+	else
+	{
+		TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex("bufferViews", Index);
+		if (!JsonBufferViewObject)
 		{
-			Count = AdditionalBufferView->Num / (ElementSize * Elements);
+			return false;
 		}
+		ParseBufferViewRecord(JsonBufferViewObject.ToSharedRef(), LocalRecord);
+		Record = &LocalRecord;
+	}
 
-		if (!bHasSparse)
+	if (Record->bMeshOptCompressed)
+	{
+		if (const FglTFRuntimeDecodedBuffer* DecodedBuffer = CompressedBufferViewsCache.Find(Index))
 		{
-			Stride = ElementSize * Elements;
+			Blob.Data = const_cast<uint8*>(DecodedBuffer->Data.GetData());
+			Blob.Num = DecodedBuffer->Data.Num();
+			Stride = DecodedBuffer->Stride;
 			return true;
 		}
 	}
-	else if (bInitWithZeros)
+
+	if (!Record->bValid)
 	{
+		return false;
+	}
 
-		if (ZeroBuffer.Num() < FinalSize)
-		{
-			ZeroBuffer.AddZeroed(FinalSize - ZeroBuffer.Num());
-		}
-		Blob.Data = ZeroBuffer.GetData();
-		Blob.Num = FinalSize;
-		if (!bHasSparse)
-		{
-			Stride = ElementSize * Elements;
-			return true;
-		}
+	FglTFRuntimeBlob BufferBlob;
+	if (!GetBuffer(Record->Buffer, BufferBlob))
+	{
+		return false;
 	}
-	else
+
+	Stride = Record->ByteStride;
+
+	if (Record->ByteOffset + Record->ByteLength > BufferBlob.Num)
 	{
-		if (!GetBufferView(BufferViewIndex, Blob, Stride))
+		return false;
+	}
+
+	Blob.Data = BufferBlob.Data + Record->ByteOffset;
+	Blob.Num = Record->ByteLength;
+
+	if (Record->bMeshOptCompressed)
+	{
+		// decompress bitstream
+		if (Stride == 0)
 		{
 			return false;
 		}
 
-		if (Stride == 0)
+		// concurrent requests for the same buffer view wait for the first decompression
+		FglTFRuntimeDecodedBuffer* DecodedBuffer = CompressedBufferViewsCache.FindOrInit(Index, [&](FglTFRuntimeDecodedBuffer& NewDecodedBuffer)
+			{
+				NewDecodedBuffer.Stride = Stride;
+				return DecompressMeshOptimizer(Blob, Stride, Record->MeshOptCount, Record->MeshOptMode, Record->MeshOptFilter, NewDecodedBuffer.Data);
+			});
+		if (!DecodedBuffer)
 		{
-			Stride = ElementSize * Elements;
+			return false;
 		}
+		Blob.Data = DecodedBuffer->Data.GetData();
+		Blob.Num = DecodedBuffer->Data.Num();
+		Stride = DecodedBuffer->Stride;
+	}
 
-		FinalSize = Stride * Count;
+	return true;
+}
 
-		if (FinalSize > Blob.Num)
+bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, const FglTFRuntimeBlob* AdditionalBufferView)
+{
+	FglTFRuntimeAccessorRecord LocalRecord;
+	const FglTFRuntimeAccessorRecord* Record = nullptr;
+	if (bJsonTablesIndexed)
+	{
+		if (!AccessorRecords.IsValidIndex(Index))
 		{
 			return false;
 		}
-
-		if (ByteOffset > 0)
+		Record = &AccessorRecords[Index];
+	}
+	else
+	{
+		TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex("accessors", Index);
+		if (!JsonAccessorObject)
+		{
+			return false;
+		}
+		ParseAccessorRecord(JsonAccessorObject.ToSharedRef(), LocalRecord);
+		Record = &LocalRecord;
+	}
+
+	bool bInitWithZeros = false;
+	const bool bHasSparse = Record->JsonSparseObject.IsValid();
+
+	int64 BufferViewIndex = INDEX_NONE;
+	int64 ByteOffset = 0;
+
+	if (!AdditionalBufferView)
+	{
+		BufferViewIndex = Record->BufferView;
+		if (BufferViewIndex == INDEX_NONE)
+		{
+			bInitWithZeros = true;
+		}
+		ByteOffset = Record->ByteOffset;
+	}
+
+	if (Record->bHasNormalized)
+	{
+		bNormalized = Record->bNormalized;
+	}
+
+	if (!Record->bValid)
+	{
+		return false;
+	}
+
+	ComponentType = Record->ComponentType;
+	Count = Record->Count;
+	ElementSize = Record->ElementSize;
+	Elements = Record->Elements;
+
+	int64 FinalSize = ElementSize * Elements * Count;
+
+	if (AdditionalBufferView)
+	{
+		if (AdditionalBufferView->Num < FinalSize)
+		{
+			return false;
+		}
+		Blob.Data = AdditionalBufferView->Data;
+		Blob.Num = FinalSize;
+
+		// special case for bigger buffers
+		if (FinalSize < AdditionalBufferView->Num && (AdditionalBufferView->Num % (ElementSize * Elements)) == 0)
+		{
+			Count = AdditionalBufferView->Num / (ElementSize * Elements);
+		}
+
+		if (!bHasSparse)
+		{
+			Stride = ElementSize * Elements;
+			return true;
+		}
+	}
+	else if (bInitWithZeros)
+	{
+
+		if (ZeroBuffer.Num() < FinalSize)
+		{
+			ZeroBuffer.AddZeroed(FinalSize - ZeroBuffer.Num());
+		}
+		Blob.Data = ZeroBuffer.GetData();
+		Blob.Num = FinalSize;
+		if (!bHasSparse)
+		{
+			Stride = ElementSize * Elements;
+			return true;
+		}
+	}
+	else
+	{
+		if (!GetBufferView(BufferViewIndex, Blob, Stride))
+		{
+			return false;
+		}
+
+		if (Stride == 0)
+		{
+			Stride = ElementSize * Elements;
+		}
+
+		FinalSize = Stride * Count;
+
+		if (FinalSize > Blob.Num)
+		{
+			return false;
+		}
+
+		if (ByteOffset > 0)
 		{
 			Blob.Data += ByteOffset;
 			if (Stride > ElementSize * Elements)
@@ -4764,16 +5388,16 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		}
 	}
 
-	if (SparseAccessorsCache.Contains(Index))
+	if (const FglTFRuntimeDecodedBuffer* SparseBuffer = SparseAccessorsCache.Find(Index))
 	{
-		Stride = SparseAccessorsStridesCache[Index];
-		Blob.Data = SparseAccessorsCache[Index].GetData();
-		Blob.Num = SparseAccessorsCache[Index].Num();
+		Stride = SparseBuffer->Stride;
+		Blob.Data = const_cast<uint8*>(SparseBuffer->Data.GetData());
+		Blob.Num = SparseBuffer->Data.Num();
 		return true;
 	}
 
 	int64 SparseCount;
-	if (!(*JsonSparseObject)->TryGetNumberField(TEXT("count"), SparseCount))
+	if (!Record->JsonSparseObject->TryGetNumberField(TEXT("count"), SparseCount))
 	{
 		return false;
 	}
@@ -4784,7 +5408,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 	}
 
 	const TSharedPtr<FJsonObject>* JsonSparseIndicesObject = nullptr;
-	if (!(*JsonSparseObject)->TryGetObjectField(TEXT("indices"), JsonSparseIndicesObject))
+	if (!Record->JsonSparseObject->TryGetObjectField(TEXT("indices"), JsonSparseIndicesObject))
 	{
 		return true;
 	}
@@ -4855,7 +5479,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 	}
 
 	const TSharedPtr<FJsonObject>* JsonSparseValuesObject = nullptr;
-	if (!(*JsonSparseObject)->TryGetObjectField(TEXT("values"), JsonSparseValuesObject))
+	if (!Record->JsonSparseObject->TryGetObjectField(TEXT("values"), JsonSparseValuesObject))
 	{
 		return true;
 	}
@@ -4886,25 +5510,34 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 
 	Stride = SparseBufferViewValuesStride;
 
-	SparseAccessorsCache.Add(Index);
-	SparseAccessorsStridesCache.Add(Index, Stride);
-	TArray64<uint8>& SparseData = SparseAccessorsCache[Index];
-	SparseData.Append(Blob.Data, Blob.Num);
-
-	for (int32 IndexToChange = 0; IndexToChange < SparseCount; IndexToChange++)
-	{
-		uint32 SparseIndexToChange = SparseIndices[IndexToChange];
-		if (SparseIndexToChange >= (Blob.Num / Stride))
+	// concurrent requests for the same accessor wait for the first one to build the data
+	FglTFRuntimeDecodedBuffer* SparseBuffer = SparseAccessorsCache.FindOrInit(Index, [&](FglTFRuntimeDecodedBuffer& NewSparseBuffer)
 		{
-			return false;
-		}
+			NewSparseBuffer.Stride = Stride;
+			TArray64<uint8>& SparseData = NewSparseBuffer.Data;
+			SparseData.Append(Blob.Data, Blob.Num);
+
+			for (int32 IndexToChange = 0; IndexToChange < SparseCount; IndexToChange++)
+			{
+				uint32 SparseIndexToChange = SparseIndices[IndexToChange];
+				if (SparseIndexToChange >= (Blob.Num / Stride))
+				{
+					return false;
+				}
 
-		uint8* OriginalValuePtr = (uint8*)(SparseData.GetData() + Stride * SparseIndexToChange);
-		uint8* NewValuePtr = (uint8*)(SparseBytesValues.Data + SparseBufferViewValuesStride * IndexToChange);
-		FMemory::Memcpy(OriginalValuePtr, NewValuePtr, SparseBufferViewValuesStride);
+				uint8* OriginalValuePtr = (uint8*)(SparseData.GetData() + Stride * SparseIndexToChange);
+				uint8* NewValuePtr = (uint8*)(SparseBytesValues.Data + SparseBufferViewValuesStride * IndexToChange);
+				FMemory::Memcpy(OriginalValuePtr, NewValuePtr, SparseBufferViewValuesStride);
+			}
+			return true;
+		});
+
+	if (!SparseBuffer)
+	{
+		return false;
 	}
 
-	Blob.Data = SparseData.GetData();
+	Blob.Data = SparseBuffer->Data.GetData();
 
 	return true;
 }
@@ -4954,12 +5587,18 @@ int64 FglTFRuntimeParser::GetTypeSize(const FString& Type) const
 
 void FglTFRuntimeParser::AddReferencedObjects(FReferenceCollector& Collector)
 {
-	Collector.AddReferencedObjects(StaticMeshesCache);
-	Collector.AddReferencedObjects(MaterialsCache);
-	Collector.AddReferencedObjects(SkeletonsCache);
-	Collector.AddReferencedObjects(SkeletalMeshesCache);
-	Collector.AddReferencedObjects(TexturesCache);
-	Collector.AddReferencedObjects(MaterialsNameCache);
+	{
+		FScopeLock Lock(&MeshesCacheLock);
+		Collector.AddReferencedObjects(StaticMeshesCache);
+		Collector.AddReferencedObjects(SkeletonsCache);
+		Collector.AddReferencedObjects(SkeletalMeshesCache);
+	}
+	{
+		FScopeLock Lock(&MaterialsCacheLock);
+		Collector.AddReferencedObjects(MaterialsCache);
+		Collector.AddReferencedObjects(TexturesCache);
+		Collector.AddReferencedObjects(MaterialsNameCache);
+	}
 	Collector.AddReferencedObjects(MetallicRoughnessMaterialsMap);
 	Collector.AddReferencedObjects(SpecularGlossinessMaterialsMap);
 	Collector.AddReferencedObjects(UnlitMaterialsMap);
@@ -4969,12 +5608,18 @@ void FglTFRuntimeParser::AddReferencedObjects(FReferenceCollector& Collector)
 
 void FglTFRuntimeParser::ClearCache()
 {
-	StaticMeshesCache.Empty();
-	MaterialsCache.Empty();
-	SkeletonsCache.Empty();
-	SkeletalMeshesCache.Empty();
-	TexturesCache.Empty();
-	MaterialsNameCache.Empty();
+	{
+		FScopeLock Lock(&MeshesCacheLock);
+		StaticMeshesCache.Empty();
+		SkeletonsCache.Empty();
+		SkeletalMeshesCache.Empty();
+	}
+	{
+		FScopeLock Lock(&MaterialsCacheLock);
+		MaterialsCache.Empty();
+		TexturesCache.Empty();
+		MaterialsNameCache.Empty();
+	}
 	MetallicRoughnessMaterialsMap.Empty();
 	SpecularGlossinessMaterialsMap.Empty();
 	UnlitMaterialsMap.Empty();
@@ -4984,39 +5629,7 @@ void FglTFRuntimeParser::ClearCache()
 
 float FglTFRuntimeParser::FindBestFrames(const TArray<float>& FramesTimes, float WantedTime, int32& FirstIndex, int32& SecondIndex)
 {
-	SecondIndex = INDEX_NONE;
-	// first search for second (higher value)
-	for (int32 i = 0; i < FramesTimes.Num(); i++)
-	{
-		float TimeValue = FramesTimes[i] - FramesTimes[0];
-		if (FMath::IsNearlyEqual(TimeValue, WantedTime))
-		{
-			FirstIndex = i;
-			SecondIndex = i;
-			return 0;
-		}
-		else if (TimeValue > WantedTime)
-		{
-			SecondIndex = i;
-			break;
-		}
-	}
-
-	// not found ? use the last value
-	if (SecondIndex == INDEX_NONE)
-	{
-		SecondIndex = FramesTimes.Num() - 1;
-	}
-
-	if (SecondIndex == 0)
-	{
-		FirstIndex = 0;
-		return 1.f;
-	}
-
-	FirstIndex = SecondIndex - 1;
-
-	return ((WantedTime + FramesTimes[0]) - FramesTimes[FirstIndex]) / (FramesTimes[SecondIndex] - FramesTimes[FirstIndex]);
+	return FindBestFramesInTimeline(FramesTimes.Num(), [&FramesTimes](const int32 Index) { return FramesTimes[Index]; }, WantedTime, FirstIndex, SecondIndex);
 }
 
 bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePrimitives, FglTFRuntimePrimitive& OutPrimitive)
@@ -5049,11 +5662,6 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 			return false;
 		}
 
-		if (SourcePrimitive.UVs.Num() != MainPrimitive.UVs.Num())
-		{
-			return false;
-		}
-
 		if (SourcePrimitive.Joints.Num() != MainPrimitive.Joints.Num())
 		{
 			return false;
@@ -5070,6 +5678,15 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 		}
 	}
 
+	// primitives without some of the TEXCOORD_n get zeroed channels
+	int32 NumUVs = 0;
+	for (const FglTFRuntimePrimitive& SourcePrimitive : SourcePrimitives)
+	{
+		NumUVs = FMath::Max(NumUVs, SourcePrimitive.UVs.Num());
+	}
+	OutPrimitive.UVs.SetNum(NumUVs);
+	OutPrimitive.HighPrecisionUVChannels.Init(false, NumUVs);
+
 	uint32 BaseIndex = 0;
 	for (FglTFRuntimePrimitive& SourcePrimitive : SourcePrimitives)
 	{
@@ -5087,20 +5704,30 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 			OutPrimitive.Indices.Add(Index + BaseIndex);
 		}
 
+		for (int32 UVChannel = 0; UVChannel < NumUVs; UVChannel++)
+		{
+			if (SourcePrimitive.UVs.IsValidIndex(UVChannel))
+			{
+				OutPrimitive.UVs[UVChannel].Append(SourcePrimitive.UVs[UVChannel]);
+				if (SourcePrimitive.IsHighPrecisionUVChannel(UVChannel))
+				{
+					OutPrimitive.HighPrecisionUVChannels[UVChannel] = true;
+				}
+			}
+			else
+			{
+				OutPrimitive.UVs[UVChannel].AddZeroed(SourcePrimitive.Positions.Num());
+			}
+		}
+
 		if (BaseIndex == 0)
 		{
-			OutPrimitive.UVs = SourcePrimitive.UVs;
 			OutPrimitive.Joints = SourcePrimitive.Joints;
 			OutPrimitive.Weights = SourcePrimitive.Weights;
 			OutPrimitive.MorphTargets = SourcePrimitive.MorphTargets;
 		}
 		else
 		{
-			for (int32 UVChannel = 0; UVChannel < OutPrimitive.UVs.Num(); UVChannel++)
-			{
-				OutPrimitive.UVs[UVChannel].Append(SourcePrimitive.UVs[UVChannel]);
-			}
-
 			for (int32 JointsIndex = 0; JointsIndex < OutPrimitive.Joints.Num(); JointsIndex++)
 			{
 				OutPrimitive.Joints[JointsIndex].Append(SourcePrimitive.Joints[JointsIndex]);
@@ -5240,6 +5867,20 @@ bool FglTFRuntimeParser::GetMorphTargetNames(const int32 MeshIndex, TArray<FStri
 	return true;
 }
 
+namespace glTFRuntime
+{
+	// zip fields are always little endian and not necessarily aligned
+	uint16 ZipReadUInt16(const uint8* Ptr)
+	{
+		return static_cast<uint16>(Ptr[0]) | (static_cast<uint16>(Ptr[1]) << 8);
+	}
+
+	uint32 ZipReadUInt32(const uint8* Ptr)
+	{
+		return static_cast<uint32>(Ptr[0]) | (static_cast<uint32>(Ptr[1]) << 8) | (static_cast<uint32>(Ptr[2]) << 16) | (static_cast<uint32>(Ptr[3]) << 24);
+	}
+}
+
 void FglTFRuntimeArchiveZip::SetPassword(const FString& EncryptionKey)
 {
 	Password.Empty();
@@ -5251,92 +5892,128 @@ void FglTFRuntimeArchiveZip::SetPassword(const FString& EncryptionKey)
 	Password.Append(reinterpret_cast<const uint8*>(UTF8Conversion.Get()), UTF8Conversion.Length());
 }
 
+void FglTFRuntimeArchiveZip::ApplyLoaderConfig(const FglTFRuntimeConfig& LoaderConfig)
+{
+	if (!LoaderConfig.EncryptionKey.IsEmpty())
+	{
+		SetPassword(LoaderConfig.EncryptionKey);
+	}
+
+	if (LoaderConfig.PasswordPromptHook.IsBound())
+	{
+		PromptHook = LoaderConfig.PasswordPromptHook;
+	}
+
+	if (LoaderConfig.AESDecrypterHook.IsBound())
+	{
+		AESDecrypterHook = LoaderConfig.AESDecrypterHook;
+	}
+}
+
 bool FglTFRuntimeArchiveZip::FromData(const uint8* DataPtr, const int64 DataNum)
 {
 	Data.Append(DataPtr, DataNum);
 
-	// step0: retrieve the trailer magic
-	TArray<uint8> Magic;
-	bool bIndexFound = false;
-	uint64 Index = 0;
-	for (Index = Data.Num() - 1; Index >= 0; Index--)
+	return ParseCentralDirectory();
+}
+
+int64 FglTFRuntimeArchiveZip::GetArchiveSize() const
+{
+	return Data.Num();
+}
+
+bool FglTFRuntimeArchiveZip::ReadArchive(const int64 Offset, const int64 Size, TArray64<uint8>& Storage, const uint8*& OutPtr)
+{
+	if (Offset < 0 || Size < 0 || Offset + Size > Data.Num())
 	{
-		Magic.Insert(Data[Index], 0);
-		if (Magic.Num() == 4)
-		{
-			if (Magic[0] == 0x50 && Magic[1] == 0x4b && Magic[2] == 0x05 && Magic[3] == 0x06)
-			{
-				bIndexFound = true;
-				break;
-			}
-			Magic.Pop();
-		}
+		return false;
 	}
 
-	if (!bIndexFound)
+	// zero-copy, the whole archive is already in memory
+	OutPtr = Data.GetData() + Offset;
+	return true;
+}
+
+bool FglTFRuntimeArchiveZip::ParseCentralDirectory()
+{
+	constexpr int64 TrailerMinSize = 22;
+	constexpr int64 CentralDirectoryMinSize = 46;
+
+	const int64 ArchiveSize = GetArchiveSize();
+	if (ArchiveSize < TrailerMinSize)
 	{
 		return false;
 	}
 
-	uint16 DiskEntries = 0;
-	uint16 TotalEntries = 0;
-	uint32 CentralDirectorySize = 0;
-	uint32 CentralDirectoryOffset = 0;
-	uint16 CommentLen = 0;
+	// step0: retrieve the trailer magic (it can only be followed by the archive comment)
+	const int64 TailSize = FMath::Min<int64>(ArchiveSize, TrailerMinSize + MAX_uint16);
+	TArray64<uint8> TailStorage;
+	const uint8* Tail = nullptr;
+	if (!ReadArchive(ArchiveSize - TailSize, TailSize, TailStorage, Tail))
+	{
+		return false;
+	}
 
-	constexpr uint64 TrailerMinSize = 22;
-	constexpr uint64 CentralDirectoryMinSize = 46;
+	int64 TrailerIndex = INDEX_NONE;
+	for (int64 Index = TailSize - TrailerMinSize; Index >= 0; Index--)
+	{
+		if (Tail[Index] == 0x50 && Tail[Index + 1] == 0x4b && Tail[Index + 2] == 0x05 && Tail[Index + 3] == 0x06)
+		{
+			TrailerIndex = Index;
+			break;
+		}
+	}
 
-	if (Index + TrailerMinSize > Data.Num())
+	if (TrailerIndex == INDEX_NONE)
 	{
 		return false;
 	}
 
 	// skip signature and disk data
-	Data.Seek(Index + 8);
-	Data << DiskEntries;
-	Data << TotalEntries;
-	Data << CentralDirectorySize;
-	Data << CentralDirectoryOffset;
-	Data << CommentLen;
+	const uint16 DiskEntries = glTFRuntime::ZipReadUInt16(Tail + TrailerIndex + 8);
+	const uint16 TotalEntries = glTFRuntime::ZipReadUInt16(Tail + TrailerIndex + 10);
+	const uint32 CentralDirectorySize = glTFRuntime::ZipReadUInt32(Tail + TrailerIndex + 12);
+	const uint32 CentralDirectoryOffset = glTFRuntime::ZipReadUInt32(Tail + TrailerIndex + 16);
+
+	if (static_cast<int64>(CentralDirectoryOffset) + CentralDirectorySize > ArchiveSize)
+	{
+		return false;
+	}
+
+	// the central directory is read in a single shot
+	TArray64<uint8> DirectoryStorage;
+	const uint8* Directory = nullptr;
+	if (!ReadArchive(CentralDirectoryOffset, CentralDirectorySize, DirectoryStorage, Directory))
+	{
+		return false;
+	}
 
 	uint16 DirectoryEntries = FMath::Min(DiskEntries, TotalEntries);
 
+	int64 DirectoryOffset = 0;
 	for (uint16 DirectoryIndex = 0; DirectoryIndex < DirectoryEntries; DirectoryIndex++)
 	{
-		if (CentralDirectoryOffset + CentralDirectoryMinSize > Data.Num())
+		if (DirectoryOffset + CentralDirectoryMinSize > CentralDirectorySize)
 		{
 			return false;
 		}
 
-		uint32 GlobalCompressedSize = 0;
-		uint32 GlobalUncompressedSize = 0;
-		uint16 FilenameLen = 0;
-		uint16 ExtraFieldLen = 0;
-		uint16 EntryCommentLen = 0;
-		uint32 EntryOffset = 0;
+		const uint8* DirectoryEntry = Directory + DirectoryOffset;
 
-		// seek to CompressedSize
-		Data.Seek(CentralDirectoryOffset + 20);
-		Data << GlobalCompressedSize;
-		Data << GlobalUncompressedSize;
+		const uint32 GlobalCompressedSize = glTFRuntime::ZipReadUInt32(DirectoryEntry + 20);
+		const uint32 GlobalUncompressedSize = glTFRuntime::ZipReadUInt32(DirectoryEntry + 24);
+		const uint16 FilenameLen = glTFRuntime::ZipReadUInt16(DirectoryEntry + 28);
+		const uint16 ExtraFieldLen = glTFRuntime::ZipReadUInt16(DirectoryEntry + 30);
+		const uint16 EntryCommentLen = glTFRuntime::ZipReadUInt16(DirectoryEntry + 32);
+		const uint32 EntryOffset = glTFRuntime::ZipReadUInt32(DirectoryEntry + 42);
 
-		// seek to FilenameLen
-		Data.Seek(CentralDirectoryOffset + 28);
-		Data << FilenameLen;
-		Data << ExtraFieldLen;
-		Data << EntryCommentLen;
-		// seek to EntryOffset
-		Data.Seek(CentralDirectoryOffset + 42);
-		Data << EntryOffset;
-
-		if (CentralDirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > Data.Num())
+		if (DirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > CentralDirectorySize)
 		{
 			return false;
 		}
 
 		TArray64<uint8> FilenameBytes;
-		FilenameBytes.Append(Data.GetData() + CentralDirectoryOffset + CentralDirectoryMinSize, FilenameLen);
+		FilenameBytes.Append(DirectoryEntry + CentralDirectoryMinSize, FilenameLen);
 		FilenameBytes.Add(0);
 
 		FString Filename = FString(UTF8_TO_TCHAR(FilenameBytes.GetData()));
@@ -5344,9 +6021,63 @@ bool FglTFRuntimeArchiveZip::FromData(const uint8* DataPtr, const int64 DataNum)
 		OffsetsMap.Add(Filename, EntryOffset);
 		GlobalSizeMap.Add(Filename, TPair<uint32, uint32>(GlobalCompressedSize, GlobalUncompressedSize));
 
-		CentralDirectoryOffset += CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen;
+		DirectoryOffset += CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen;
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeArchiveZipFile::FromFilename(const FString& Filename)
+{
+	FileReader = TUniquePtr<FArchive>(IFileManager::Get().CreateFileReader(*Filename));
+	if (!FileReader)
+	{
+		return false;
+	}
+
+	FileSize = FileReader->TotalSize();
+
+	TArray64<uint8> MagicStorage;
+	const uint8* Magic = nullptr;
+	if (!ReadArchive(0, 4, MagicStorage, Magic))
+	{
+		return false;
+	}
+
+	if (Magic[0] != 0x50 || Magic[1] != 0x4b || Magic[2] != 0x03 || Magic[3] != 0x04)
+	{
+		return false;
+	}
+
+	return ParseCentralDirectory();
+}
+
+int64 FglTFRuntimeArchiveZipFile::GetArchiveSize() const
+{
+	return FileSize;
+}
+
+bool FglTFRuntimeArchiveZipFile::ReadArchive(const int64 Offset, const int64 Size, TArray64<uint8>& Storage, const uint8*& OutPtr)
+{
+	if (!FileReader || Offset < 0 || Size < 0 || Offset + Size > FileSize)
+	{
+		return false;
+	}
+
+	Storage.SetNumUninitialized(Size);
+
+	{
+		FScopeLock Lock(&FileReaderLock);
+		FileReader->Seek(Offset);
+		FileReader->Serialize(Storage.GetData(), Size);
+		if (FileReader->IsError())
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to read %lld bytes at offset %lld from Zip archive"), Size, Offset);
+			return false;
+		}
 	}
 
+	OutPtr = Storage.GetData();
 	return true;
 }
 
@@ -5358,37 +6089,28 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 		return false;
 	}
 
-	constexpr uint64 LocalEntryMinSize = 30;
+	constexpr int64 LocalEntryMinSize = 30;
+
+	const int64 ArchiveSize = GetArchiveSize();
 
-	if (*Offset + LocalEntryMinSize > Data.Num())
+	if (*Offset + LocalEntryMinSize > ArchiveSize)
 	{
 		return false;
 	}
 
-	uint16 Flags = 0;
-	uint16 Compression = 0;
-	uint32 CompressedSize;
-	uint32 UncompressedSize = 0;
-	uint16 FilenameLen = 0;
-	uint16 ExtraFieldLen = 0;
-
-	// seek to Compression
-	Data.Seek(*Offset + 6);
-	Data << Flags;
-	Data << Compression;
-	// seek to CompressedSize
-	Data.Seek(*Offset + 18);
-	Data << CompressedSize;
-	Data << UncompressedSize;
-	Data << FilenameLen;
-	Data << ExtraFieldLen;
-
-	if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize > Data.Num())
+	TArray64<uint8> LocalEntryStorage;
+	const uint8* LocalEntry = nullptr;
+	if (!ReadArchive(*Offset, LocalEntryMinSize, LocalEntryStorage, LocalEntry))
 	{
 		return false;
 	}
 
-	const uint8* CompressedData = Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen;
+	const uint16 Flags = glTFRuntime::ZipReadUInt16(LocalEntry + 6);
+	uint16 Compression = glTFRuntime::ZipReadUInt16(LocalEntry + 8);
+	uint32 CompressedSize = glTFRuntime::ZipReadUInt32(LocalEntry + 18);
+	uint32 UncompressedSize = glTFRuntime::ZipReadUInt32(LocalEntry + 22);
+	const uint16 FilenameLen = glTFRuntime::ZipReadUInt16(LocalEntry + 26);
+	const uint16 ExtraFieldLen = glTFRuntime::ZipReadUInt16(LocalEntry + 28);
 
 	// for streamed zips
 
@@ -5402,6 +6124,25 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 		UncompressedSize = GlobalSizeMap[Filename].Value;
 	}
 
+	// ZipCrypto entries have an additional 12 bytes header
+	const int64 EncryptionHeaderSize = ((Flags & 1) && Compression != 99) ? 12 : 0;
+	const int64 PayloadOffset = *Offset + LocalEntryMinSize + FilenameLen;
+	const int64 PayloadSize = ExtraFieldLen + static_cast<int64>(CompressedSize) + EncryptionHeaderSize;
+
+	if (PayloadOffset + PayloadSize > ArchiveSize)
+	{
+		return false;
+	}
+
+	TArray64<uint8> PayloadStorage;
+	const uint8* Payload = nullptr;
+	if (!ReadArchive(PayloadOffset, PayloadSize, PayloadStorage, Payload))
+	{
+		return false;
+	}
+
+	const uint8* CompressedData = Payload + ExtraFieldLen;
+
 	// encrypted ?
 
 	// first check for password prompt
@@ -5456,7 +6197,7 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 
 			// TODO, probably I should generalize it to allow custom fields to be managed by the user
 			TArray64<uint8> ExtraField;
-			ExtraField.Append(Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen, ExtraFieldLen);
+			ExtraField.Append(Payload, ExtraFieldLen);
 			uint32 ExtraFieldsOffset = 0;
 			// 0 is not a valid AES strength so it acts as a marker
 			uint8 AESEncryptionStrength = 0;
@@ -5535,10 +6276,6 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 		}
 		else // ZipCrypto?
 		{
-			if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize + 12 > Data.Num())
-			{
-				return false;
-			}
 			DecryptedData.AddUninitialized(CompressedSize + 12);
 
 			uint32 Key0 = 305419896;
@@ -5606,6 +6343,11 @@ bool FglTFRuntimeArchive::FileExists(const FString& Filename) const
 	return OffsetsMap.Contains(Filename);
 }
 
+bool FglTFRuntimeArchiveZip::SupportsConcurrentReads() const
+{
+	return !PromptHook.IsBound() && !AESDecrypterHook.IsBound();
+}
+
 FString FglTFRuntimeArchive::GetFirstFilenameByExtension(const FString& Extension) const
 {
 	for (const TPair<FString, uint32>& Pair : OffsetsMap)
@@ -5789,738 +6531,190 @@ TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectExtension(TSharedRef<FJ
 		{
 			return *RequestedExtensionObject;
 		}
-	}
-	return nullptr;
-}
-
-int64 FglTFRuntimeParser::GetJsonObjectIndex(TSharedRef<FJsonObject> JsonObject, const FString& Name) const
-{
-	int64 Index;
-	if (JsonObject->TryGetNumberField(Name, Index))
-	{
-		return Index;
-	}
-	return INDEX_NONE;
-}
-
-const FglTFRuntimeBlob* FglTFRuntimeParser::GetAdditionalBufferView(const int64 Index, const FString& Name) const
-{
-	if (Index <= INDEX_NONE)
-	{
-		return nullptr;
-	}
-
-	const TMap<FString, FglTFRuntimeBlob>* Value = AdditionalBufferViewsCache.Find(Index);
-	if (!Value)
-	{
-		return nullptr;
-	}
-
-	if (!Value->Contains(Name))
-	{
-		return nullptr;
-	}
-
-	const FglTFRuntimeBlob& Blob = (*Value)[Name];
-
-	return &Blob;
-}
-
-void FglTFRuntimeParser::AddAdditionalBufferView(const int64 Index, const FString& Name, const FglTFRuntimeBlob& Blob)
-{
-	if (Index <= INDEX_NONE)
-	{
-		return;
-	}
-
-	if (!AdditionalBufferViewsCache.Contains(Index))
-	{
-		AdditionalBufferViewsCache.Add(Index);
-	}
-
-	if (!AdditionalBufferViewsCache[Index].Contains(Name))
-	{
-		AdditionalBufferViewsCache[Index].Add(Name, Blob);
-	}
-	else
-	{
-		AdditionalBufferViewsCache[Index][Name] = Blob;
-	}
-
-}
-
-bool FglTFRuntimeParser::GetNumberFromExtras(const FString& Key, float& Value) const
-{
-	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
-	if (!JsonExtras)
-	{
-		return false;
-	}
-
-	double DoubleValue = 0;
-
-	if (JsonExtras->TryGetNumberField(Key, DoubleValue))
-	{
-		Value = DoubleValue;
-		return true;
-	}
-
-	return false;
-}
-
-bool FglTFRuntimeParser::GetStringFromExtras(const FString& Key, FString& Value) const
-{
-	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
-	if (!JsonExtras)
-	{
-		return false;
-	}
-
-	return JsonExtras->TryGetStringField(Key, Value);
-}
-
-bool FglTFRuntimeParser::GetBooleanFromExtras(const FString& Key, bool& Value) const
-{
-	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
-	if (!JsonExtras)
-	{
-		return false;
-	}
-
-	return JsonExtras->TryGetBoolField(Key, Value);
-}
-
-bool FglTFRuntimeParser::GetStringMapFromExtras(const FString& Key, TMap<FString, FString>& StringMap) const
-{
-	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
-	if (!JsonExtras)
-	{
-		return false;
-	}
-
-	const TSharedPtr<FJsonObject>* JsonExtraObject = nullptr;
-	if (!JsonExtras->TryGetObjectField(Key, JsonExtraObject))
-	{
-		return false;
-	}
-
-	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*JsonExtraObject)->Values)
-	{
-		if (!Pair.Value.IsValid())
-		{
-			continue;
-		}
-
-		FString Value;
-		if (!Pair.Value->TryGetString(Value))
-		{
-			continue;
-		}
-
-		StringMap.Add(Pair.Key, Value);
-	}
-
-	return true;
-}
-
-bool FglTFRuntimeParser::GetStringArrayFromExtras(const FString& Key, TArray<FString>& StringArray) const
-{
-	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
-	if (!JsonExtras)
-	{
-		return false;
-	}
-
-	return JsonExtras->TryGetStringArrayField(Key, StringArray);
-}
-
-bool FglTFRuntimeParser::GetNumberArrayFromExtras(const FString& Key, TArray<float>& NumberArray) const
-{
-	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
-	if (!JsonExtras)
-	{
-		return false;
-	}
-
-	const TArray<TSharedPtr<FJsonValue>>* JsonArray = nullptr;
-	if (!JsonExtras->TryGetArrayField(Key, JsonArray))
-	{
-		return false;
-	}
-
-	for (const TSharedPtr<FJsonValue>& JsonItem : *JsonArray)
-	{
-		double Value = 0;
-		if (!JsonItem->TryGetNumber(Value))
-		{
-			return false;
-		}
-		NumberArray.Add(Value);
-	}
-
-	return true;
-}
-
-TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeExtensionObject(const int32 NodeIndex, const FString& ExtensionName)
-{
-	TSharedPtr<FJsonObject> JsonNodeObject = GetJsonObjectFromRootIndex("nodes", NodeIndex);
-	if (!JsonNodeObject)
-	{
-		return nullptr;
-	}
-
-	return GetJsonObjectExtension(JsonNodeObject.ToSharedRef(), ExtensionName);
-}
-
-TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeObject(const int32 NodeIndex)
-{
-	return GetJsonObjectFromRootIndex("nodes", NodeIndex);
-}
-
-bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes)
-{
-	auto DecodeZigZag = [](const uint8 V)
-		{
-			return ((V & 1) != 0) ? ~(V >> 1) : (V >> 1);
-		};
-
-	// refactored in april 2024 to be more compliant with https://www.npmjs.com/package/meshoptimize
-	if (Mode == "ATTRIBUTES" && Blob.Num > 32 && Blob.Data[0] == 0xa0)
-	{
-		const int64 MaxBlockElements = FMath::Min<int64>((8192 / Stride) & ~15, 256);
-		TArray<uint8, TInlineAllocator<16>> Deltas;
-		Deltas.AddZeroed(16);
-
-		TArray<uint8> TempData;
-		TempData.Append(Blob.Data + Blob.Num - Stride, Stride);
-
-		int64 Offset = 1;
-		const int64 Limit = Blob.Num - Stride;
-
-		// preallocated output
-		UncompressedBytes.AddUninitialized(Elements * Stride);
-
-		for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex += MaxBlockElements)
-		{
-			const int64 BlockElements = FMath::Min<int64>(Elements - ElementIndex, MaxBlockElements);
-
-			const int64 GroupCount = ((BlockElements + 0x0F) & ~0x0F) >> 4;
-
-			const int64 NumberOfHeaderBytes = ((GroupCount + 0x03) & ~0x03) >> 2;
-
-			for (int64 ElementByteIndex = 0; ElementByteIndex < Stride; ElementByteIndex++)
-			{
-
-				if (Offset + NumberOfHeaderBytes > Limit)
-				{
-					return false;
-				}
-
-				int64 HeaderOffset = Offset;
-				Offset += NumberOfHeaderBytes;
-
-				for (int64 GroupIndex = 0; GroupIndex < GroupCount; GroupIndex++)
-				{
-					const uint8 ModeValue = (Blob.Data[HeaderOffset] >> ((GroupIndex & 0x03) << 1)) & 0x03;
-					if ((GroupIndex & 0x03) == 0x03)
-					{
-						HeaderOffset++;
-					}
-
-					if (ModeValue == 0)
-					{
-						FMemory::Memset(Deltas.GetData(), 0, 16);
-					}
-					else if (ModeValue == 1)
-					{
-						if (Offset + 4 > Limit)
-						{
-							return false;
-						}
-
-						const int64 BaseOffset = Offset;
-						Offset += 4;
-
-						for (int64 Index = 0; Index < 16; Index++)
-						{
-							const int64 Shift = (6 - ((Index & 0x03) << 1));
-							uint8 Delta = (Blob.Data[BaseOffset + (Index >> 2)] >> Shift) & 0x03;
-							if (Delta == 3)
-							{
-								if (Offset + 1 > Limit)
-								{
-									return false;
-								}
-								Delta = Blob.Data[Offset++];
-							}
-							Deltas[Index] = Delta;
-						}
-					}
-					else if (ModeValue == 2)
-					{
-						if (Offset + 8 > Limit)
-						{
-							return false;
-						}
-
-						const int64 BaseOffset = Offset;
-						Offset += 8;
-
-						for (int64 Index = 0; Index < 16; Index++)
-						{
-							const int64 Shift = (Index & 0x01) ? 0 : 4;
-							uint8 Delta = (Blob.Data[BaseOffset + (Index >> 1)] >> Shift) & 0x0f;
-							if (Delta == 0xf)
-							{
-								if (Offset + 1 > Limit)
-								{
-									return false;
-								}
-								Delta = Blob.Data[Offset++];
-							}
-							Deltas[Index] = Delta;
-						}
-					}
-					else if (ModeValue == 3)
-					{
-						if (Offset + 16 > Limit)
-						{
-							return false;
-						}
-						FMemory::Memcpy(Deltas.GetData(), Blob.Data + Offset, 16);
-						Offset += 16;
-					}
-
-					const int64 DestinationElementGroup = ElementIndex + (GroupIndex << 4);
-
-					for (int64 Index = 0; Index < 16; Index++)
-					{
-						const int64 DestinationElementIndex = DestinationElementGroup + Index;
-						if (DestinationElementIndex >= Elements)
-						{
-							break;
-						}
-
-						const uint8 Delta = DecodeZigZag(Deltas[Index]);
-						TempData[ElementByteIndex] += Delta;
-						UncompressedBytes[DestinationElementIndex * Stride + ElementByteIndex] = TempData[ElementByteIndex];
-					}
-
-				}
-			}
-		}
-	}
-	else if (Mode == "TRIANGLES" && Blob.Num >= 17 && Blob.Data[0] == 0xe1 && (Stride == 2 || Stride == 4) && ((Elements % 3) == 0))
-	{
-		TArray<uint8> CodeAux;
-		const int64 Limit = Blob.Num - 16;
-		CodeAux.Append(Blob.Data + Limit, 16);
-
-		uint32 Next = 0;
-		uint32 Last = 0;
-		TArray<TPair<uint32, uint32>> EdgeFifo;
-		TArray<uint32> VertexFifo;
-
-		int64 Offset = 1;
-		const uint32 TrianglesNum = Elements / 3;
-		int64 DataOffset = Offset + TrianglesNum;
-		int64 TriangleOffset = 0;
-
-		UncompressedBytes.AddUninitialized(Elements * Stride);
-
-		auto EmitTriangle = [Stride, &TriangleOffset, &UncompressedBytes](const uint32 A, const uint32 B, const uint32 C)
-			{
-				if (Stride == 2)
-				{
-					const uint16 AShort = A;
-					const uint16 BShort = B;
-					const uint16 CShort = C;
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&AShort)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&AShort)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&BShort)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&BShort)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&CShort)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&CShort)[1];
-				}
-				else
-				{
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&A)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&A)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&A)[2];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&A)[3];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&B)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&B)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&B)[2];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&B)[3];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&C)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&C)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&C)[2];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&C)[3];
-				}
-			};
-
-		auto DecodeIndex = [&Blob, &DataOffset, &Last, Limit]() -> bool
-			{
-				uint32 V = 0;
-				for (int32 Shift = 0; ; Shift += 7)
-				{
-					if (DataOffset >= Limit)
-					{
-						return false;
-					}
-
-					const uint32 Byte = Blob.Data[DataOffset++];
-					V |= (Byte & 0x7F) << Shift;
-
-					if (Byte < 0x80)
-					{
-						break;
-					}
-				}
-
-				int32 Delta = ((V & 1) != 0) ? ~(V >> 1) : (V >> 1);
-
-				Last += Delta;
-				return true;
-			};
-
-		for (uint32 TriangleIndex = 0; TriangleIndex < TrianglesNum; TriangleIndex++)
-		{
-			if (Offset >= Limit)
-			{
-				return false;
-			}
-			uint8 Code = Blob.Data[Offset++];
-			uint8 NibbleLeft = Code >> 4;
-			uint8 NibbleRight = Code & 0x0f;
-
-			if (NibbleLeft < 0xf && NibbleRight == 0) // 0xX0
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
-				{
-					return false;
-				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
-				const uint32 C = Next++;
-
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-				VertexFifo.Insert(C, 0);
-
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft < 0xf && NibbleRight > 0 && NibbleRight < 0x0d) // 0xXY
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
-				{
-					return false;
-				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
-
-				if (NibbleRight >= VertexFifo.Num())
-				{
-					return false;
-				}
-
-				const uint32 C = VertexFifo[NibbleRight];
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft < 0xf && NibbleRight == 0x0d) // 0xXd
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
-				{
-					return false;
-				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
-
-				const uint32 C = Last - 1;
-				Last = C;
-
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-				VertexFifo.Insert(C, 0);
-
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft < 0xf && NibbleRight == 0x0e) // 0xXe
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
-				{
-					return false;
-				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
+	}
+	return nullptr;
+}
 
-				const uint32 C = Last + 1;
-				Last = C;
+int64 FglTFRuntimeParser::GetJsonObjectIndex(TSharedRef<FJsonObject> JsonObject, const FString& Name) const
+{
+	int64 Index;
+	if (JsonObject->TryGetNumberField(Name, Index))
+	{
+		return Index;
+	}
+	return INDEX_NONE;
+}
 
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-				VertexFifo.Insert(C, 0);
+const FglTFRuntimeBlob* FglTFRuntimeParser::GetAdditionalBufferView(const int64 Index, const FString& Name) const
+{
+	if (Index <= INDEX_NONE)
+	{
+		return nullptr;
+	}
 
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft < 0xf && NibbleRight == 0x0f) // 0xXf
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
-				{
-					return false;
-				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
+	FReadScopeLock ReadLock(AdditionalBufferViewsLock);
 
-				if (!DecodeIndex())
-				{
-					return false;
-				}
+	const TMap<FString, TUniquePtr<FglTFRuntimeBlob>>* Value = AdditionalBufferViewsCache.Find(Index);
+	if (!Value)
+	{
+		return nullptr;
+	}
 
-				const uint32 C = Last;
+	const TUniquePtr<FglTFRuntimeBlob>* Blob = Value->Find(Name);
+	if (!Blob)
+	{
+		return nullptr;
+	}
 
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-				VertexFifo.Insert(C, 0);
+	// blobs are heap allocated, so the pointer is still valid after the lock is released
+	return Blob->Get();
+}
 
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft == 0xf && NibbleRight < 0xe) // 0xfY
-			{
-				const uint8 ZW = CodeAux[NibbleRight];
-				const uint8 Z = ZW >> 4;
-				const uint8 W = ZW & 0x0f;
+void FglTFRuntimeParser::AddAdditionalBufferView(const int64 Index, const FString& Name, const FglTFRuntimeBlob& Blob)
+{
+	if (Index <= INDEX_NONE)
+	{
+		return;
+	}
 
-				const uint32 A = Next++;
-				uint32 B = 0;
-				uint32 C = 0;
+	FWriteScopeLock WriteLock(AdditionalBufferViewsLock);
 
-				if (Z == 0)
-				{
-					B = Next++;
-				}
-				else
-				{
-					if (Z - 1 >= VertexFifo.Num())
-					{
-						return false;
-					}
-					B = VertexFifo[Z - 1];
-				}
+	TUniquePtr<FglTFRuntimeBlob>& CachedBlob = AdditionalBufferViewsCache.FindOrAdd(Index).FindOrAdd(Name);
+	if (!CachedBlob)
+	{
+		CachedBlob = MakeUnique<FglTFRuntimeBlob>();
+	}
+	*CachedBlob = Blob;
+}
 
-				if (W == 0)
-				{
-					C = Next++;
-				}
-				else
-				{
-					if (W - 1 >= VertexFifo.Num())
-					{
-						return false;
-					}
-					C = VertexFifo[W - 1];
-				}
+bool FglTFRuntimeParser::GetNumberFromExtras(const FString& Key, float& Value) const
+{
+	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
+	if (!JsonExtras)
+	{
+		return false;
+	}
 
-				EdgeFifo.Insert(TPair<uint32, uint32>(B, A), 0); // push BA
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, B), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(A, C), 0); // push AC
-				VertexFifo.Insert(A, 0);
-				if (Z == 0)
-				{
-					VertexFifo.Insert(B, 0);
-				}
-				if (W == 0)
-				{
-					VertexFifo.Insert(C, 0);
-				}
+	double DoubleValue = 0;
 
-				EmitTriangle(A, B, C);
-			}
-			else if (Code == 0xfe || Code == 0xff) // 0xfe - 0xff
-			{
-				if (DataOffset >= Limit)
-				{
-					return false;
-				}
+	if (JsonExtras->TryGetNumberField(Key, DoubleValue))
+	{
+		Value = DoubleValue;
+		return true;
+	}
 
-				uint8 ZW = Blob.Data[DataOffset++];
-				uint8 Z = ZW >> 4;
-				uint8 W = ZW & 0x0f;
-				if (ZW == 0)
-				{
-					Next = 0;
-				}
+	return false;
+}
 
-				uint32 A = 0;
-				if (Code == 0xfe)
-				{
-					A = Next++;
-				}
-				else
-				{
-					if (!DecodeIndex())
-					{
-						return false;
-					}
-					A = Last;
-				}
+bool FglTFRuntimeParser::GetStringFromExtras(const FString& Key, FString& Value) const
+{
+	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
+	if (!JsonExtras)
+	{
+		return false;
+	}
 
-				uint32 B = 0;
-				if (Z == 0)
-				{
-					B = Next++;
-				}
-				else if (Z < 0xf)
-				{
-					if (Z - 1 >= VertexFifo.Num())
-					{
-						return false;
-					}
-					B = VertexFifo[Z - 1];
-				}
-				else
-				{
-					if (!DecodeIndex())
-					{
-						return false;
-					}
-					B = Last;
-				}
+	return JsonExtras->TryGetStringField(Key, Value);
+}
 
-				uint32 C = 0;
-				if (W == 0)
-				{
-					C = Next++;
-				}
-				else if (W < 0xf)
-				{
-					if (W - 1 >= VertexFifo.Num())
-					{
-						return false;
-					}
-					C = VertexFifo[W - 1];
-				}
-				else
-				{
-					if (!DecodeIndex())
-					{
-						return false;
-					}
-					C = Last;
-				}
+bool FglTFRuntimeParser::GetBooleanFromExtras(const FString& Key, bool& Value) const
+{
+	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
+	if (!JsonExtras)
+	{
+		return false;
+	}
 
-				EdgeFifo.Insert(TPair<uint32, uint32>(B, A), 0); // push BA
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, B), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(A, C), 0); // push AC
-				VertexFifo.Insert(A, 0);
-				if (Z == 0 || Z == 0xf)
-				{
-					VertexFifo.Insert(B, 0);
-				}
-				if (W == 0 || W == 0xf)
-				{
-					VertexFifo.Insert(C, 0);
-				}
+	return JsonExtras->TryGetBoolField(Key, Value);
+}
 
-				EmitTriangle(A, B, C);
-			}
-		}
+bool FglTFRuntimeParser::GetStringMapFromExtras(const FString& Key, TMap<FString, FString>& StringMap) const
+{
+	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
+	if (!JsonExtras)
+	{
+		return false;
 	}
-	else
+
+	const TSharedPtr<FJsonObject>* JsonExtraObject = nullptr;
+	if (!JsonExtras->TryGetObjectField(Key, JsonExtraObject))
 	{
 		return false;
 	}
 
-	if (UncompressedBytes.Num() > 0)
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*JsonExtraObject)->Values)
 	{
-		if (Filter == "OCTAHEDRAL" && (Stride == 4 || Stride == 8))
+		if (!Pair.Value.IsValid())
 		{
-			if (Stride == 4)
-			{
-				int8* Data = reinterpret_cast<int8*>(UncompressedBytes.GetData());
-				const int64 MaxInt = 127;
-				for (int64 Index = 0; Index < 4 * Elements; Index += 4)
-				{
-					float X = Data[Index];
-					float Y = Data[Index + 1];
-					float One = Data[Index + 2];
-					X /= One;
-					Y /= One;
-					const float Z = 1.0 - FMath::Abs(X) - FMath::Abs(Y);
-					const float T = FMath::Max(-Z, 0.0f);
-					X -= (X >= 0) ? T : -T;
-					Y -= (Y >= 0) ? T : -T;
-					const float H = MaxInt / FMath::Sqrt(X * X + Y * Y + Z * Z);
-					Data[Index + 0] = FMath::RoundToInt(X * H);
-					Data[Index + 1] = FMath::RoundToInt(Y * H);
-					Data[Index + 2] = FMath::RoundToInt(Z * H);
-				}
-			}
-			else
-			{
-				int16* Data = reinterpret_cast<int16*>(UncompressedBytes.GetData());
-				const int64 MaxInt = 32767;
-				for (int64 Index = 0; Index < 4 * Elements; Index += 4)
-				{
-					float X = Data[Index];
-					float Y = Data[Index + 1];
-					float One = Data[Index + 2];
-					X /= One;
-					Y /= One;
-					const float Z = 1.0 - FMath::Abs(X) - FMath::Abs(Y);
-					const float T = FMath::Max(-Z, 0.0f);
-					X -= (X >= 0) ? T : -T;
-					Y -= (Y >= 0) ? T : -T;
-					const float H = MaxInt / FMath::Sqrt(X * X + Y * Y + Z * Z);
-					Data[Index + 0] = FMath::RoundToInt(X * H);
-					Data[Index + 1] = FMath::RoundToInt(Y * H);
-					Data[Index + 2] = FMath::RoundToInt(Z * H);
-				}
-			}
+			continue;
 		}
-		else if (Filter == "QUATERNION" && Stride == 8)
+
+		FString Value;
+		if (!Pair.Value->TryGetString(Value))
 		{
-			int16* Data = reinterpret_cast<int16*>(UncompressedBytes.GetData());
+			continue;
+		}
 
-			const float Range = 1.0f / FMath::Sqrt(2.0f);
+		StringMap.Add(Pair.Key, Value);
+	}
 
-			for (int64 Offset = 0; Offset < Elements * 4; Offset += 4)
-			{
-				float One = Data[Offset + 3] | 3;
+	return true;
+}
+
+bool FglTFRuntimeParser::GetStringArrayFromExtras(const FString& Key, TArray<FString>& StringArray) const
+{
+	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
+	if (!JsonExtras)
+	{
+		return false;
+	}
 
-				float X = Data[Offset] / One * Range;
-				float Y = Data[Offset + 1] / One * Range;
-				float Z = Data[Offset + 2] / One * Range;
+	return JsonExtras->TryGetStringArrayField(Key, StringArray);
+}
 
-				float W = FMath::Sqrt(FMath::Max(0.0, 1.0 - X * X - Y * Y - Z * Z));
+bool FglTFRuntimeParser::GetNumberArrayFromExtras(const FString& Key, TArray<float>& NumberArray) const
+{
+	TSharedPtr<FJsonObject> JsonExtras = GetJsonObjectExtras(Root);
+	if (!JsonExtras)
+	{
+		return false;
+	}
 
-				int32 MaxComp = Data[Offset + 3] & 3;
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray = nullptr;
+	if (!JsonExtras->TryGetArrayField(Key, JsonArray))
+	{
+		return false;
+	}
 
-				Data[Offset + ((MaxComp + 1) % 4)] = FMath::RoundToInt(X * 32767.0);
-				Data[Offset + ((MaxComp + 2) % 4)] = FMath::RoundToInt(Y * 32767.0);
-				Data[Offset + ((MaxComp + 3) % 4)] = FMath::RoundToInt(Z * 32767.0);
-				Data[Offset + ((MaxComp + 0) % 4)] = FMath::RoundToInt(W * 32767.0);
-			}
-		}
-		else if (Filter == "EXPONENTIAL" && (Stride % 4) == 0)
-		{
-			int32* Data = reinterpret_cast<int32*>(UncompressedBytes.GetData());
-			float* Dest = reinterpret_cast<float*>(UncompressedBytes.GetData());
-			for (int64 Offset = 0; Offset < UncompressedBytes.Num() / 4; Offset++)
-			{
-				int32 E = Data[Offset] >> 24;
-				int32 M = (Data[Offset] << 8) >> 8;
-				Dest[Offset] = FMath::Pow(2.0f, E) * M;
-			}
-		}
-		else if (Filter != "" && Filter != "NONE")
+	for (const TSharedPtr<FJsonValue>& JsonItem : *JsonArray)
+	{
+		double Value = 0;
+		if (!JsonItem->TryGetNumber(Value))
 		{
-			AddError("DecompressMeshOptimizer()", "Unsupported Filter");
 			return false;
 		}
+		NumberArray.Add(Value);
 	}
 
 	return true;
 }
 
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeExtensionObject(const int32 NodeIndex, const FString& ExtensionName)
+{
+	TSharedPtr<FJsonObject> JsonNodeObject = GetJsonObjectFromRootIndex("nodes", NodeIndex);
+	if (!JsonNodeObject)
+	{
+		return nullptr;
+	}
+
+	return GetJsonObjectExtension(JsonNodeObject.ToSharedRef(), ExtensionName);
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeObject(const int32 NodeIndex)
+{
+	return GetJsonObjectFromRootIndex("nodes", NodeIndex);
+}
+
 FTransform FglTFRuntimeParser::GetParentNodeWorldTransform(const FglTFRuntimeNode& Node)
 {
 	FTransform WorldTransform = FTransform::Identity;
@@ -6634,20 +6828,24 @@ void FglTFRuntimeParser::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const
 	if (!JsonMeshObject)
 	{
 		AsyncCallback.ExecuteIfBound(false, FglTFRuntimeMeshLOD());
+		return;
 	}
 
-	Async(EAsyncExecution::Thread, [this, JsonMeshObject, MaterialsConfig, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(MaterialsConfig.AsyncPriority, UglTFRuntimeCancellationToken::GetTokenFlag(MaterialsConfig.CancellationToken), [this, JsonMeshObject, MaterialsConfig, AsyncCallback]()
 		{
 			FglTFRuntimeMeshLOD* LOD;
 			bool bSuccess = LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig);
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD, AsyncCallback]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD, AsyncCallback]()
 				{
 					AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? *LOD : FglTFRuntimeMeshLOD());
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		}
-
-	);
+		}, [AsyncCallback]()
+		{
+			FFunctionGraphTask::CreateAndDispatchWhenReady([AsyncCallback]()
+				{
+					AsyncCallback.ExecuteIfBound(false, FglTFRuntimeMeshLOD());
+				}, TStatId(), nullptr, ENamedThreads::GameThread);
+		});
 }
 
 bool FglTFRuntimeParser::LoadPathToBlob(const FString& Path, TArray64<uint8>& Blob)
@@ -6719,6 +6917,49 @@ TArray<FString> FglTFRuntimeParser::GetAnimationsNames(const bool bIncludeUnname
 	return Names;
 }
 
+TSharedPtr<FglTFRuntimeMappedFile> FglTFRuntimeMappedFile::Open(const FString& Filename)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	TSharedPtr<FglTFRuntimeMappedFile> NewMappedFile = MakeShared<FglTFRuntimeMappedFile>();
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	FOpenMappedResult OpenResult = PlatformFile.OpenMappedEx(*Filename);
+	if (OpenResult.HasError())
+	{
+		return nullptr;
+	}
+	NewMappedFile->Handle = OpenResult.StealValue();
+#else
+	NewMappedFile->Handle = TUniquePtr<IMappedFileHandle>(PlatformFile.OpenMapped(*Filename));
+#endif
+
+	if (!NewMappedFile->Handle || NewMappedFile->Handle->GetFileSize() <= 0)
+	{
+		return nullptr;
+	}
+
+	NewMappedFile->Region = TUniquePtr<IMappedFileRegion>(NewMappedFile->Handle->MapRegion(0, NewMappedFile->Handle->GetFileSize()));
+	if (!NewMappedFile->Region)
+	{
+		return nullptr;
+	}
+
+	NewMappedFile->Data = NewMappedFile->Region->GetMappedPtr();
+	NewMappedFile->DataNum = NewMappedFile->Region->GetMappedSize();
+
+	return NewMappedFile;
+}
+
+FglTFRuntimeBlob FglTFRuntimeMappedFile::GetBlob() const
+{
+	FglTFRuntimeBlob Blob;
+	// blobs are read-only, so we can safely reference the mapping
+	Blob.Data = const_cast<uint8*>(Data);
+	Blob.Num = DataNum;
+	return Blob;
+}
+
 void FglTFRuntimeArchiveMap::FromMap(const TMap<FString, TArray64<uint8>> InMap)
 {
 	for (const TPair<FString, TArray64<uint8>>& Pair : InMap)
@@ -18,6 +18,105 @@
 #include "Modules/ModuleManager.h"
 #include "TextureResource.h"
 
+namespace glTFRuntime
+{
+	struct FSRGBMipsTables
+	{
+		float ToLinear[256];
+		uint8 ToSRGB[4096];
+
+		FSRGBMipsTables()
+		{
+			for (int32 Index = 0; Index < 256; Index++)
+			{
+				ToLinear[Index] = FLinearColor::FromSRGBColor(FColor(Index, 0, 0)).R;
+			}
+			for (int32 Index = 0; Index < 4096; Index++)
+			{
+				ToSRGB[Index] = FLinearColor(Index / 4095.0f, 0, 0).ToFColor(true).R;
+			}
+		}
+	};
+
+	const FSRGBMipsTables& GetSRGBMipsTables()
+	{
+		static FSRGBMipsTables Tables;
+		return Tables;
+	}
+
+	// box filter a 4 bytes per pixel image into the next mip level (non power of two sizes get a 2 or 3 pixels wide footprint)
+	void DownsampleMip(const uint8* Source, const int32 SourceWidth, const int32 SourceHeight, uint8* Destination, const int32 DestinationWidth, const int32 DestinationHeight, const bool sRGB)
+	{
+		const FSRGBMipsTables& Tables = GetSRGBMipsTables();
+		const bool bExactHalfWidth = SourceWidth == DestinationWidth * 2;
+		const bool bExactHalfHeight = SourceHeight == DestinationHeight * 2;
+
+		ParallelFor(DestinationHeight, [&](const int32 Y)
+			{
+				const int32 Y0 = static_cast<int32>(static_cast<int64>(Y) * SourceHeight / DestinationHeight);
+				const int32 Y1 = FMath::Max(static_cast<int32>(static_cast<int64>(Y + 1) * SourceHeight / DestinationHeight), Y0 + 1);
+				uint8* DestinationRow = Destination + static_cast<int64>(Y) * DestinationWidth * 4;
+
+				// fast path: plain 2x2 box on linear data, simple enough for the compiler to vectorize
+				if (!sRGB && bExactHalfWidth && bExactHalfHeight)
+				{
+					const uint8* SourceRow0 = Source + static_cast<int64>(Y0) * SourceWidth * 4;
+					const uint8* SourceRow1 = SourceRow0 + static_cast<int64>(SourceWidth) * 4;
+					for (int32 X = 0; X < DestinationWidth; X++)
+					{
+						for (int32 Channel = 0; Channel < 4; Channel++)
+						{
+							DestinationRow[X * 4 + Channel] = static_cast<uint8>((SourceRow0[X * 8 + Channel] + SourceRow0[X * 8 + 4 + Channel] + SourceRow1[X * 8 + Channel] + SourceRow1[X * 8 + 4 + Channel] + 2) >> 2);
+						}
+					}
+					return;
+				}
+
+				for (int32 X = 0; X < DestinationWidth; X++)
+				{
+					const int32 X0 = static_cast<int32>(static_cast<int64>(X) * SourceWidth / DestinationWidth);
+					const int32 X1 = FMath::Max(static_cast<int32>(static_cast<int64>(X + 1) * SourceWidth / DestinationWidth), X0 + 1);
+
+					float Sum[4] = { 0, 0, 0, 0 };
+					for (int32 SourceY = Y0; SourceY < Y1; SourceY++)
+					{
+						const uint8* SourcePixel = Source + (static_cast<int64>(SourceY) * SourceWidth + X0) * 4;
+						for (int32 SourceX = X0; SourceX < X1; SourceX++, SourcePixel += 4)
+						{
+							if (sRGB)
+							{
+								// color channels are averaged in linear space, alpha is always linear
+								Sum[0] += Tables.ToLinear[SourcePixel[0]];
+								Sum[1] += Tables.ToLinear[SourcePixel[1]];
+								Sum[2] += Tables.ToLinear[SourcePixel[2]];
+							}
+							else
+							{
+								Sum[0] += SourcePixel[0];
+								Sum[1] += SourcePixel[1];
+								Sum[2] += SourcePixel[2];
+							}
+							Sum[3] += SourcePixel[3];
+						}
+					}
+
+					const float Scale = 1.0f / ((X1 - X0) * (Y1 - Y0));
+					for (int32 Channel = 0; Channel < 4; Channel++)
+					{
+						if (sRGB && Channel < 3)
+						{
+							DestinationRow[X * 4 + Channel] = Tables.ToSRGB[FMath::Clamp(FMath::RoundToInt(Sum[Channel] * Scale * 4095.0f), 0, 4095)];
+						}
+						else
+						{
+							DestinationRow[X * 4 + Channel] = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Sum[Channel] * Scale), 0, 255));
+						}
+					}
+				}
+			});
+	}
+}
+
 
 UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index, const FString& MaterialName, TSharedRef<FJsonObject> JsonMaterialObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors, UMaterialInterface* ForceBaseMaterial)
 {
@@ -131,7 +230,21 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 			JsonMaterialObject->TryGetNumberField(*ParamName, Value);
 		};
 
-	auto GetMaterialTexture = [this, MaterialsConfig](const TSharedRef<FJsonObject> JsonMaterialObject, const FString& ParamName, const bool sRGB, UTexture2D*& ParamTextureCache, TArray<FglTFRuntimeMipMap>& ParamMips, FglTFRuntimeTextureTransform& ParamTransform, FglTFRuntimeTextureSampler& Sampler, const bool bForceNormalMapCompression) -> const TSharedPtr<FJsonObject>
+	// textures are only collected while parsing the material, so that they can be decoded all at once
+	struct FMaterialTextureToLoad
+	{
+		int32 TextureIndex;
+		bool sRGB;
+		bool bNormalMapCompression;
+		UTexture2D** ParamTextureCache;
+		TArray<FglTFRuntimeMipMap>* ParamMips;
+		FglTFRuntimeTextureSampler* Sampler;
+		int32 SourceIndex;
+	};
+	TArray<FMaterialTextureToLoad> TexturesToLoad;
+	bool bNormalMapCompression = false;
+
+	auto GetMaterialTexture = [this, &TexturesToLoad, &bNormalMapCompression](const TSharedRef<FJsonObject> JsonMaterialObject, const FString& ParamName, const bool sRGB, UTexture2D*& ParamTextureCache, TArray<FglTFRuntimeMipMap>& ParamMips, FglTFRuntimeTextureTransform& ParamTransform, FglTFRuntimeTextureSampler& Sampler, const bool bForceNormalMapCompression) -> const TSharedPtr<FJsonObject>
 		{
 			const TSharedPtr<FJsonObject>* JsonTextureObject;
 			if (JsonMaterialObject->TryGetObjectField(ParamName, JsonTextureObject))
@@ -166,14 +279,13 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 					return nullptr;
 				}
 
-				// hack for allowing BC5 compression for plugins
+				// hack for allowing BC5 compression for plugins (and for the runtime block compression)
 				if (bForceNormalMapCompression)
 				{
-					FglTFRuntimeImagesConfig& ImagesConfig = const_cast<FglTFRuntimeImagesConfig&>(MaterialsConfig.ImagesConfig);
-					ImagesConfig.Compression = TextureCompressionSettings::TC_Normalmap;
+					bNormalMapCompression = true;
 				}
 
-				ParamTextureCache = LoadTexture(TextureIndex, ParamMips, sRGB, MaterialsConfig, Sampler);
+				TexturesToLoad.Add({ static_cast<int32>(TextureIndex), sRGB, bForceNormalMapCompression, &ParamTextureCache, &ParamMips, &Sampler, INDEX_NONE });
 
 				return *JsonTextureObject;
 			}
@@ -331,6 +443,63 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 		}
 	}
 
+	if (TexturesToLoad.Num() > 0)
+	{
+		SCOPED_NAMED_EVENT(FglTFRuntimeParser_LoadMaterial_Internal_DecodeTextures, FColor::Magenta);
+
+		FglTFRuntimeMaterialsConfig NormalMapMaterialsConfig;
+		if (bNormalMapCompression)
+		{
+			NormalMapMaterialsConfig = MaterialsConfig;
+			NormalMapMaterialsConfig.ImagesConfig.Compression = TextureCompressionSettings::TC_Normalmap;
+		}
+
+		// the same texture is often referenced by multiple params (e.g. metallicRoughness and occlusion), decode it only once
+		TArray<int32> TexturesToDecode;
+		for (int32 TextureToLoadIndex = 0; TextureToLoadIndex < TexturesToLoad.Num(); TextureToLoadIndex++)
+		{
+			FMaterialTextureToLoad& TextureToLoad = TexturesToLoad[TextureToLoadIndex];
+			for (const int32 TextureToDecodeIndex : TexturesToDecode)
+			{
+				const FMaterialTextureToLoad& TextureToDecode = TexturesToLoad[TextureToDecodeIndex];
+				if (TextureToDecode.TextureIndex == TextureToLoad.TextureIndex && TextureToDecode.sRGB == TextureToLoad.sRGB && TextureToDecode.bNormalMapCompression == TextureToLoad.bNormalMapCompression)
+				{
+					TextureToLoad.SourceIndex = TextureToDecodeIndex;
+					break;
+				}
+			}
+
+			if (TextureToLoad.SourceIndex == INDEX_NONE)
+			{
+				TexturesToDecode.Add(TextureToLoadIndex);
+			}
+		}
+
+		// ensure the image decoders are loaded before hitting them from the worker threads
+		FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+
+		// texture hooks are not required to be thread safe
+		const bool bHasTextureHooks = OnTextureImageIndex.IsBound() || OnTextureMips.IsBound() || OnTextureFilterMips.IsBound() || OnTexturePixels.IsBound() || OnLoadedTexturePixels.IsBound();
+
+		// image decoding and mips generation are fully independent between textures, only the UTexture2D creation (in BuildMaterial) needs to be serialized
+		ParallelFor(TexturesToDecode.Num(), [&](const int32 TextureToDecodeIndex)
+			{
+				FMaterialTextureToLoad& TextureToLoad = TexturesToLoad[TexturesToDecode[TextureToDecodeIndex]];
+				*TextureToLoad.ParamTextureCache = LoadTexture(TextureToLoad.TextureIndex, *TextureToLoad.ParamMips, TextureToLoad.sRGB, TextureToLoad.bNormalMapCompression ? NormalMapMaterialsConfig : MaterialsConfig, *TextureToLoad.Sampler);
+			}, TexturesToDecode.Num() < 2 || !MaterialsConfig.bDecodeTexturesInParallel || bHasTextureHooks);
+
+		for (FMaterialTextureToLoad& TextureToLoad : TexturesToLoad)
+		{
+			if (TextureToLoad.SourceIndex != INDEX_NONE)
+			{
+				const FMaterialTextureToLoad& SourceTexture = TexturesToLoad[TextureToLoad.SourceIndex];
+				*TextureToLoad.ParamTextureCache = *SourceTexture.ParamTextureCache;
+				*TextureToLoad.ParamMips = *SourceTexture.ParamMips;
+				*TextureToLoad.Sampler = *SourceTexture.Sampler;
+			}
+		}
+	}
+
 	if (IsInGameThread())
 	{
 		return BuildMaterial(Index, MaterialName, RuntimeMaterial, MaterialsConfig, bUseVertexColors, ForceBaseMaterial);
@@ -415,7 +584,7 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 		uint8* Data = reinterpret_cast<uint8*>(Mip->BulkData.Realloc(MipMap.Pixels.Num()));
 		// ETargetPlatformFeatures::NormalmapLAEncodingMode has been added in 5.3 for mobile platforms
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3 && (PLATFORM_ANDROID || PLATFORM_IOS)
-		if (ImagesConfig.Compression == TC_Normalmap)
+		if (ImagesConfig.Compression == TC_Normalmap && MipMap.PixelFormat == EPixelFormat::PF_B8G8R8A8)
 		{
 			for (int32 PIndex = 0; PIndex < MipMap.Pixels.Num(); PIndex += 4)
 			{
@@ -457,6 +626,7 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 
 	if (Mips[0].TextureIndex >= 0)
 	{
+		FScopeLock Lock(&MaterialsCacheLock);
 		TexturesCache.Add(Mips[0].TextureIndex, Texture);
 	}
 
@@ -1108,9 +1278,12 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 	}
 
 	// first check cache
-	if (TexturesCache.Contains(TextureIndex))
 	{
-		return TexturesCache[TextureIndex];
+		FScopeLock Lock(&MaterialsCacheLock);
+		if (TexturesCache.Contains(TextureIndex))
+		{
+			return TexturesCache[TextureIndex];
+		}
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonTextures;
@@ -1279,61 +1452,35 @@ bool FglTFRuntimeParser::LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJs
 
 			int32 NumOfMips = 1;
 
-			TArray64<FColor> UncompressedColors;
-
-			if (MaterialsConfig.bGeneratesMipMaps && GPixelFormats[PixelFormat].BlockSizeX == 1 && GPixelFormats[PixelFormat].BlockSizeY == 1 && FMath::IsPowerOfTwo(Width) && FMath::IsPowerOfTwo(Height))
+			if (MaterialsConfig.bGeneratesMipMaps && GPixelFormats[PixelFormat].BlockSizeX == 1 && (PixelFormat == EPixelFormat::PF_B8G8R8A8 || PixelFormat == EPixelFormat::PF_R8G8B8A8))
 			{
 				NumOfMips = FMath::FloorLog2(FMath::Max(Width, Height)) + 1;
-
-				for (int32 MipY = 0; MipY < Height; MipY++)
-				{
-					for (int32 MipX = 0; MipX < Width; MipX++)
-					{
-						int64 MipColorIndex = ((MipY * Width) + MipX) * 4;
-						uint8 MipColorB = UncompressedBytes[MipColorIndex];
-						uint8 MipColorG = UncompressedBytes[MipColorIndex + 1];
-						uint8 MipColorR = UncompressedBytes[MipColorIndex + 2];
-						uint8 MipColorA = UncompressedBytes[MipColorIndex + 3];
-						UncompressedColors.Add(FColor(MipColorR, MipColorG, MipColorB, MipColorA));
-					}
-				}
 			}
 
+			Mips.Reserve(Mips.Num() + NumOfMips);
+
 			int32 MipWidth = Width;
 			int32 MipHeight = Height;
 
 			for (int32 MipIndex = 0; MipIndex < NumOfMips; MipIndex++)
 			{
-				FglTFRuntimeMipMap MipMap(TextureIndex);
+				FglTFRuntimeMipMap& MipMap = Mips.Emplace_GetRef(TextureIndex);
 				MipMap.Width = MipWidth;
 				MipMap.Height = MipHeight;
 				MipMap.PixelFormat = PixelFormat;
 
-				// Resize Image
+				// each level is downsampled from the previous one
 				if (MipIndex > 0)
 				{
-					TArray64<FColor> ResizedMipData;
-					ResizedMipData.AddUninitialized(MipWidth * MipHeight);
-#if ENGINE_MAJOR_VERSION >= 5
-					FImageUtils::ImageResize(Width, Height, UncompressedColors, MipWidth, MipHeight, ResizedMipData, sRGB, false);
-#else
-					FImageUtils::ImageResize(Width, Height, UncompressedColors, MipWidth, MipHeight, ResizedMipData, sRGB);
-#endif
-					for (FColor& Color : ResizedMipData)
-					{
-						MipMap.Pixels.Add(Color.B);
-						MipMap.Pixels.Add(Color.G);
-						MipMap.Pixels.Add(Color.R);
-						MipMap.Pixels.Add(Color.A);
-					}
+					const FglTFRuntimeMipMap& PreviousMipMap = Mips[Mips.Num() - 2];
+					MipMap.Pixels.AddUninitialized(static_cast<int64>(MipWidth) * MipHeight * 4);
+					glTFRuntime::DownsampleMip(PreviousMipMap.Pixels.GetData(), PreviousMipMap.Width, PreviousMipMap.Height, MipMap.Pixels.GetData(), MipWidth, MipHeight, sRGB);
 				}
 				else
 				{
-					MipMap.Pixels = UncompressedBytes;
+					MipMap.Pixels = MoveTemp(UncompressedBytes);
 				}
 
-				Mips.Add(MipMap);
-
 				MipWidth = FMath::Max(MipWidth / 2, 1);
 				MipHeight = FMath::Max(MipHeight / 2, 1);
 			}
@@ -1342,6 +1489,11 @@ bool FglTFRuntimeParser::LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJs
 
 	OnTextureFilterMips.Broadcast(AsShared(), Mips, MaterialsConfig.ImagesConfig);
 
+	if (MaterialsConfig.ImagesConfig.bCompressMips)
+	{
+		CompressMips(Mips, MaterialsConfig.ImagesConfig);
+	}
+
 	return true;
 }
 
@@ -1358,13 +1510,17 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 	}
 
 	// first check cache
-	if (CanReadFromCache(MaterialsConfig.CacheMode) && MaterialsCache.Contains(Index))
+	if (CanReadFromCache(MaterialsConfig.CacheMode))
 	{
-		if (MaterialsNameCache.Contains(MaterialsCache[Index]))
+		FScopeLock Lock(&MaterialsCacheLock);
+		if (MaterialsCache.Contains(Index))
 		{
-			MaterialName = MaterialsNameCache[MaterialsCache[Index]];
+			if (MaterialsNameCache.Contains(MaterialsCache[Index]))
+			{
+				MaterialName = MaterialsNameCache[MaterialsCache[Index]];
+			}
+			return MaterialsCache[Index];
 		}
-		return MaterialsCache[Index];
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonMaterials;
@@ -1411,6 +1567,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 
 	if (CanWriteToCache(MaterialsConfig.CacheMode))
 	{
+		FScopeLock Lock(&MaterialsCacheLock);
 		MaterialsNameCache.Add(Material, MaterialName);
 		MaterialsCache.Add(Index, Material);
 	}
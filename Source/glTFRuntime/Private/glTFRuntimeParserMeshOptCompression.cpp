@@ -0,0 +1,1220 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+#define GLTFRUNTIME_MESHOPT_SSE 1
+#define GLTFRUNTIME_MESHOPT_NEON 0
+#include <emmintrin.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_64BITS
+#define GLTFRUNTIME_MESHOPT_SSE 0
+#define GLTFRUNTIME_MESHOPT_NEON 1
+#include <arm_neon.h>
+#else
+#define GLTFRUNTIME_MESHOPT_SSE 0
+#define GLTFRUNTIME_MESHOPT_NEON 0
+#endif
+
+static TAutoConsoleVariable<int32> CVarglTFRuntimeMeshOptSIMD(
+	TEXT("glTFRuntime.MeshOptSIMD"),
+	1,
+	TEXT("Use the SSE/NEON kernels for decoding EXT_meshopt_compression buffer views (0 forces the scalar path, useful for comparing them)."),
+	ECVF_Default);
+
+namespace glTFRuntime
+{
+	// filters are applied in batches of elements, each one on a different task
+	const int64 MeshOptFilterBatchElements = 16384;
+
+	FORCEINLINE uint8 DecodeMeshOptZigZag(const uint8 V)
+	{
+		return ((V & 1) != 0) ? ~(V >> 1) : (V >> 1);
+	}
+
+	// floor(V + 0.5), the same rounding of FMath::RoundToInt
+	FORCEINLINE int32 RoundMeshOptFilterValue(const float V)
+	{
+		return FMath::FloorToInt(V + 0.5f);
+	}
+
+#if GLTFRUNTIME_MESHOPT_SSE
+	FORCEINLINE __m128i RoundMeshOptFilterValueSSE(const __m128 V)
+	{
+		const __m128 T = _mm_add_ps(V, _mm_set1_ps(0.5f));
+		const __m128i Truncated = _mm_cvttps_epi32(T);
+		// truncation goes toward zero, so negative non-integer values need to be decremented
+		return _mm_add_epi32(Truncated, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(Truncated), T)));
+	}
+
+	FORCEINLINE __m128i SelectSSE(const __m128i Mask, const __m128i A, const __m128i B)
+	{
+		return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B));
+	}
+
+	// sign-extend the four int16 values of the low (or high) half of V to int32
+	FORCEINLINE __m128i UnpackLowInt16SSE(const __m128i V)
+	{
+		return _mm_srai_epi32(_mm_unpacklo_epi16(V, V), 16);
+	}
+
+	FORCEINLINE __m128i UnpackHighInt16SSE(const __m128i V)
+	{
+		return _mm_srai_epi32(_mm_unpackhi_epi16(V, V), 16);
+	}
+
+	// A and B contain 4 elements of 4 int16 components, they are transposed to X, Y, Z and W lanes
+	FORCEINLINE void TransposeInt16x4SSE(const __m128i A, const __m128i B, __m128i& X, __m128i& Y, __m128i& Z, __m128i& W)
+	{
+		const __m128i T0 = _mm_unpacklo_epi16(A, B);
+		const __m128i T1 = _mm_unpackhi_epi16(A, B);
+		const __m128i XY = _mm_unpacklo_epi16(T0, T1);
+		const __m128i ZW = _mm_unpackhi_epi16(T0, T1);
+		X = UnpackLowInt16SSE(XY);
+		Y = UnpackHighInt16SSE(XY);
+		Z = UnpackLowInt16SSE(ZW);
+		W = UnpackHighInt16SSE(ZW);
+	}
+
+	FORCEINLINE void InterleaveInt16x4SSE(const __m128i X, const __m128i Y, const __m128i Z, const __m128i W, __m128i& A, __m128i& B)
+	{
+		const __m128i XY = _mm_packs_epi32(X, Y);
+		const __m128i ZW = _mm_packs_epi32(Z, W);
+		const __m128i T0 = _mm_unpacklo_epi16(XY, ZW);
+		const __m128i T1 = _mm_unpackhi_epi16(XY, ZW);
+		A = _mm_unpacklo_epi16(T0, T1);
+		B = _mm_unpackhi_epi16(T0, T1);
+	}
+
+	void DecodeMeshOptOctahedralSSE(__m128i& A, __m128i& B, const float MaxInt)
+	{
+		__m128i IX, IY, IOne, IW;
+		TransposeInt16x4SSE(A, B, IX, IY, IOne, IW);
+
+		const __m128 SignMask = _mm_set1_ps(-0.0f);
+		const __m128 Zero = _mm_setzero_ps();
+
+		const __m128 One = _mm_cvtepi32_ps(IOne);
+		__m128 X = _mm_div_ps(_mm_cvtepi32_ps(IX), One);
+		__m128 Y = _mm_div_ps(_mm_cvtepi32_ps(IY), One);
+		const __m128 Z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_andnot_ps(SignMask, X)), _mm_andnot_ps(SignMask, Y));
+		const __m128 T = _mm_max_ps(_mm_xor_ps(Z, SignMask), Zero);
+		const __m128 NegativeT = _mm_xor_ps(T, SignMask);
+		X = _mm_sub_ps(X, _mm_castsi128_ps(SelectSSE(_mm_castps_si128(_mm_cmpge_ps(X, Zero)), _mm_castps_si128(T), _mm_castps_si128(NegativeT))));
+		Y = _mm_sub_ps(Y, _mm_castsi128_ps(SelectSSE(_mm_castps_si128(_mm_cmpge_ps(Y, Zero)), _mm_castps_si128(T), _mm_castps_si128(NegativeT))));
+		const __m128 H = _mm_div_ps(_mm_set1_ps(MaxInt), _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y)), _mm_mul_ps(Z, Z))));
+
+		InterleaveInt16x4SSE(RoundMeshOptFilterValueSSE(_mm_mul_ps(X, H)), RoundMeshOptFilterValueSSE(_mm_mul_ps(Y, H)), RoundMeshOptFilterValueSSE(_mm_mul_ps(Z, H)), IW, A, B);
+	}
+#endif
+
+#if GLTFRUNTIME_MESHOPT_NEON
+	FORCEINLINE int32x4_t RoundMeshOptFilterValueNEON(const float32x4_t V)
+	{
+		return vcvtq_s32_f32(vrndmq_f32(vaddq_f32(V, vdupq_n_f32(0.5f))));
+	}
+
+	void DecodeMeshOptOctahedralNEON(const int32x4_t IX, const int32x4_t IY, const int32x4_t IOne, const float MaxInt, int32x4_t& OutX, int32x4_t& OutY, int32x4_t& OutZ)
+	{
+		const float32x4_t Zero = vdupq_n_f32(0);
+
+		const float32x4_t One = vcvtq_f32_s32(IOne);
+		float32x4_t X = vdivq_f32(vcvtq_f32_s32(IX), One);
+		float32x4_t Y = vdivq_f32(vcvtq_f32_s32(IY), One);
+		const float32x4_t Z = vsubq_f32(vsubq_f32(vdupq_n_f32(1.0f), vabsq_f32(X)), vabsq_f32(Y));
+		const float32x4_t T = vmaxq_f32(vnegq_f32(Z), Zero);
+		X = vsubq_f32(X, vbslq_f32(vcgeq_f32(X, Zero), T, vnegq_f32(T)));
+		Y = vsubq_f32(Y, vbslq_f32(vcgeq_f32(Y, Zero), T, vnegq_f32(T)));
+		const float32x4_t H = vdivq_f32(vdupq_n_f32(MaxInt), vsqrtq_f32(vaddq_f32(vaddq_f32(vmulq_f32(X, X), vmulq_f32(Y, Y)), vmulq_f32(Z, Z))));
+
+		OutX = RoundMeshOptFilterValueNEON(vmulq_f32(X, H));
+		OutY = RoundMeshOptFilterValueNEON(vmulq_f32(Y, H));
+		OutZ = RoundMeshOptFilterValueNEON(vmulq_f32(Z, H));
+	}
+#endif
+
+	// unpacks the 16 (2 bits, 4 bits or raw) deltas of a group of elements
+	bool DecodeMeshOptGroupDeltas(const uint8 Mode, const uint8* Data, int64& Offset, const int64 Limit, uint8* Deltas, const bool bUseSIMD)
+	{
+		if (Mode == 0)
+		{
+			FMemory::Memset(Deltas, 0, 16);
+			return true;
+		}
+
+		if (Mode == 3)
+		{
+			if (Offset + 16 > Limit)
+			{
+				return false;
+			}
+			FMemory::Memcpy(Deltas, Data + Offset, 16);
+			Offset += 16;
+			return true;
+		}
+
+		const int64 HeaderSize = Mode == 1 ? 4 : 8;
+		if (Offset + HeaderSize > Limit)
+		{
+			return false;
+		}
+
+		const uint8* Header = Data + Offset;
+		Offset += HeaderSize;
+
+		const uint8 Escape = Mode == 1 ? 0x03 : 0x0f;
+
+		bool bHasEscapes = true;
+		bool bUnpacked = false;
+		if (bUseSIMD)
+		{
+#if GLTFRUNTIME_MESHOPT_SSE
+			__m128i Values;
+			if (Mode == 1)
+			{
+				int32 Packed;
+				FMemory::Memcpy(&Packed, Header, 4);
+				// every byte is repeated 4 times, then each lane extracts its own couple of bits (most significant first)
+				__m128i Bytes = _mm_cvtsi32_si128(Packed);
+				Bytes = _mm_unpacklo_epi8(Bytes, Bytes);
+				Bytes = _mm_unpacklo_epi16(Bytes, Bytes);
+				Values = _mm_or_si128(
+					_mm_or_si128(_mm_and_si128(_mm_srli_epi16(Bytes, 6), _mm_set1_epi32(0x00000003)), _mm_and_si128(_mm_srli_epi16(Bytes, 4), _mm_set1_epi32(0x00000300))),
+					_mm_or_si128(_mm_and_si128(_mm_srli_epi16(Bytes, 2), _mm_set1_epi32(0x00030000)), _mm_and_si128(Bytes, _mm_set1_epi32(0x03000000))));
+			}
+			else
+			{
+				// high nibble first
+				const __m128i Bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Header));
+				const __m128i NibbleMask = _mm_set1_epi8(0x0f);
+				Values = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(Bytes, 4), NibbleMask), _mm_and_si128(Bytes, NibbleMask));
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Deltas), Values);
+			bHasEscapes = _mm_movemask_epi8(_mm_cmpeq_epi8(Values, _mm_set1_epi8(Escape))) != 0;
+			bUnpacked = true;
+#elif GLTFRUNTIME_MESHOPT_NEON
+			uint8x16_t Values;
+			if (Mode == 1)
+			{
+				uint32 Packed;
+				FMemory::Memcpy(&Packed, Header, 4);
+				const uint8x8_t Bytes = vcreate_u8(Packed);
+				const uint8x8_t Bytes2 = vzip_u8(Bytes, Bytes).val[0];
+				const uint8x8x2_t Bytes4 = vzip_u8(Bytes2, Bytes2);
+				static const int8 Shifts[16] = { -6, -4, -2, 0, -6, -4, -2, 0, -6, -4, -2, 0, -6, -4, -2, 0 };
+				Values = vandq_u8(vshlq_u8(vcombine_u8(Bytes4.val[0], Bytes4.val[1]), vld1q_s8(Shifts)), vdupq_n_u8(0x03));
+			}
+			else
+			{
+				const uint8x8_t Bytes = vld1_u8(Header);
+				const uint8x8x2_t Nibbles = vzip_u8(vshr_n_u8(Bytes, 4), vand_u8(Bytes, vdup_n_u8(0x0f)));
+				Values = vcombine_u8(Nibbles.val[0], Nibbles.val[1]);
+			}
+			vst1q_u8(Deltas, Values);
+			bHasEscapes = vmaxvq_u8(vceqq_u8(Values, vdupq_n_u8(Escape))) != 0;
+			bUnpacked = true;
+#endif
+		}
+
+		if (!bUnpacked)
+		{
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				if (Mode == 1)
+				{
+					Deltas[Index] = (Header[Index >> 2] >> (6 - ((Index & 0x03) << 1))) & 0x03;
+				}
+				else
+				{
+					Deltas[Index] = (Header[Index >> 1] >> ((Index & 0x01) ? 0 : 4)) & 0x0f;
+				}
+			}
+		}
+
+		if (bHasEscapes)
+		{
+			// escaped deltas are stored as raw bytes after the header
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				if (Deltas[Index] == Escape)
+				{
+					if (Offset + 1 > Limit)
+					{
+						return false;
+					}
+					Deltas[Index] = Data[Offset++];
+				}
+			}
+		}
+
+		return true;
+	}
+
+	// zigzag decode the deltas and accumulate them over Last, Output must have room for 16 values
+	void AccumulateMeshOptDeltas(const uint8* Deltas, const int64 Num, uint8& Last, uint8* Output, const bool bUseSIMD)
+	{
+		if (bUseSIMD)
+		{
+#if GLTFRUNTIME_MESHOPT_SSE
+			const __m128i V = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Deltas));
+			const __m128i Half = _mm_and_si128(_mm_srli_epi16(V, 1), _mm_set1_epi8(0x7f));
+			const __m128i Sign = _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(V, _mm_set1_epi8(1)));
+			__m128i Sum = _mm_xor_si128(Half, Sign);
+			// inclusive prefix sum in log2(16) steps
+			Sum = _mm_add_epi8(Sum, _mm_slli_si128(Sum, 1));
+			Sum = _mm_add_epi8(Sum, _mm_slli_si128(Sum, 2));
+			Sum = _mm_add_epi8(Sum, _mm_slli_si128(Sum, 4));
+			Sum = _mm_add_epi8(Sum, _mm_slli_si128(Sum, 8));
+			Sum = _mm_add_epi8(Sum, _mm_set1_epi8(static_cast<char>(Last)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Output), Sum);
+			Last = Output[Num - 1];
+			return;
+#elif GLTFRUNTIME_MESHOPT_NEON
+			const uint8x16_t V = vld1q_u8(Deltas);
+			const uint8x16_t Zero = vdupq_n_u8(0);
+			uint8x16_t Sum = veorq_u8(vshrq_n_u8(V, 1), vreinterpretq_u8_s8(vnegq_s8(vreinterpretq_s8_u8(vandq_u8(V, vdupq_n_u8(1))))));
+			// inclusive prefix sum in log2(16) steps
+			Sum = vaddq_u8(Sum, vextq_u8(Zero, Sum, 15));
+			Sum = vaddq_u8(Sum, vextq_u8(Zero, Sum, 14));
+			Sum = vaddq_u8(Sum, vextq_u8(Zero, Sum, 12));
+			Sum = vaddq_u8(Sum, vextq_u8(Zero, Sum, 8));
+			Sum = vaddq_u8(Sum, vdupq_n_u8(Last));
+			vst1q_u8(Output, Sum);
+			Last = Output[Num - 1];
+			return;
+#endif
+		}
+
+		for (int64 Index = 0; Index < Num; Index++)
+		{
+			Last += DecodeMeshOptZigZag(Deltas[Index]);
+			Output[Index] = Last;
+		}
+	}
+
+	// https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/EXT_meshopt_compression#mode-0-attributes
+	bool DecodeMeshOptAttributes(const uint8* Data, const int64 Num, const int64 Stride, const int64 Elements, uint8* Output, const bool bUseSIMD)
+	{
+		if (Stride <= 0 || Stride > 256 || Num <= Stride)
+		{
+			return false;
+		}
+
+		const int64 MaxBlockElements = FMath::Min<int64>((8192 / Stride) & ~15, 256);
+
+		// the last Stride bytes are the baseline of each byte channel
+		TArray<uint8, TInlineAllocator<256>> LastValues;
+		LastValues.Append(Data + Num - Stride, Stride);
+
+		// the block is decoded channel by channel (so groups are contiguous) and then transposed to the output
+		TArray<uint8> BlockData;
+		BlockData.AddUninitialized(Stride * MaxBlockElements);
+
+		uint8 Deltas[16];
+
+		int64 Offset = 1;
+		const int64 Limit = Num - Stride;
+
+		for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex += MaxBlockElements)
+		{
+			const int64 BlockElements = FMath::Min<int64>(Elements - ElementIndex, MaxBlockElements);
+			const int64 GroupCount = ((BlockElements + 0x0F) & ~0x0F) >> 4;
+			const int64 NumberOfHeaderBytes = ((GroupCount + 0x03) & ~0x03) >> 2;
+
+			for (int64 ElementByteIndex = 0; ElementByteIndex < Stride; ElementByteIndex++)
+			{
+				if (Offset + NumberOfHeaderBytes > Limit)
+				{
+					return false;
+				}
+
+				int64 HeaderOffset = Offset;
+				Offset += NumberOfHeaderBytes;
+
+				uint8* Channel = BlockData.GetData() + ElementByteIndex * MaxBlockElements;
+
+				for (int64 GroupIndex = 0; GroupIndex < GroupCount; GroupIndex++)
+				{
+					const uint8 ModeValue = (Data[HeaderOffset] >> ((GroupIndex & 0x03) << 1)) & 0x03;
+					if ((GroupIndex & 0x03) == 0x03)
+					{
+						HeaderOffset++;
+					}
+
+					if (!DecodeMeshOptGroupDeltas(ModeValue, Data, Offset, Limit, Deltas, bUseSIMD))
+					{
+						return false;
+					}
+
+					const int64 GroupElements = FMath::Min<int64>(BlockElements - (GroupIndex << 4), 16);
+					AccumulateMeshOptDeltas(Deltas, GroupElements, LastValues[ElementByteIndex], Channel + (GroupIndex << 4), bUseSIMD);
+				}
+			}
+
+			for (int64 BlockElementIndex = 0; BlockElementIndex < BlockElements; BlockElementIndex++)
+			{
+				uint8* Element = Output + (ElementIndex + BlockElementIndex) * Stride;
+				for (int64 ElementByteIndex = 0; ElementByteIndex < Stride; ElementByteIndex++)
+				{
+					Element[ElementByteIndex] = BlockData[ElementByteIndex * MaxBlockElements + BlockElementIndex];
+				}
+			}
+		}
+
+		return true;
+	}
+
+	// https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/EXT_meshopt_compression#mode-1-triangles
+	bool DecodeMeshOptTriangles(const uint8* Data, const int64 Num, const int64 Stride, const int64 Elements, uint8* Output)
+	{
+		const int64 Limit = Num - 16;
+		const uint8* CodeAux = Data + Limit;
+
+		// both fifos are only accessed with 4 bits indices, so a 16 slots ring buffer is enough
+		uint32 EdgeFifo[16][2];
+		uint32 EdgeFifoOffset = 0;
+		int32 EdgeFifoNum = 0;
+		uint32 VertexFifo[16];
+		uint32 VertexFifoOffset = 0;
+		int32 VertexFifoNum = 0;
+
+		auto PushEdge = [&](const uint32 A, const uint32 B)
+			{
+				EdgeFifo[EdgeFifoOffset][0] = A;
+				EdgeFifo[EdgeFifoOffset][1] = B;
+				EdgeFifoOffset = (EdgeFifoOffset + 1) & 15;
+				EdgeFifoNum = FMath::Min(EdgeFifoNum + 1, 16);
+			};
+
+		auto PushVertex = [&](const uint32 V)
+			{
+				VertexFifo[VertexFifoOffset] = V;
+				VertexFifoOffset = (VertexFifoOffset + 1) & 15;
+				VertexFifoNum = FMath::Min(VertexFifoNum + 1, 16);
+			};
+
+		// 0 is the most recent entry
+		auto GetEdge = [&](const uint32 Index, uint32& A, uint32& B) -> bool
+			{
+				if (static_cast<int32>(Index) >= EdgeFifoNum)
+				{
+					return false;
+				}
+				const uint32* Edge = EdgeFifo[(EdgeFifoOffset - 1 - Index) & 15];
+				A = Edge[0];
+				B = Edge[1];
+				return true;
+			};
+
+		auto GetVertex = [&](const uint32 Index, uint32& V) -> bool
+			{
+				if (static_cast<int32>(Index) >= VertexFifoNum)
+				{
+					return false;
+				}
+				V = VertexFifo[(VertexFifoOffset - 1 - Index) & 15];
+				return true;
+			};
+
+		uint32 Next = 0;
+		uint32 Last = 0;
+
+		int64 Offset = 1;
+		const uint32 TrianglesNum = Elements / 3;
+		int64 DataOffset = Offset + TrianglesNum;
+
+		uint8* OutputPtr = Output;
+
+		auto EmitTriangle = [Stride, &OutputPtr](const uint32 A, const uint32 B, const uint32 C)
+			{
+				if (Stride == 2)
+				{
+					const uint16 Triangle[3] = { static_cast<uint16>(A), static_cast<uint16>(B), static_cast<uint16>(C) };
+					FMemory::Memcpy(OutputPtr, Triangle, sizeof(Triangle));
+					OutputPtr += sizeof(Triangle);
+				}
+				else
+				{
+					const uint32 Triangle[3] = { A, B, C };
+					FMemory::Memcpy(OutputPtr, Triangle, sizeof(Triangle));
+					OutputPtr += sizeof(Triangle);
+				}
+			};
+
+		auto DecodeIndex = [Data, &DataOffset, &Last, Limit]() -> bool
+			{
+				uint32 V = 0;
+				for (int32 Shift = 0; ; Shift += 7)
+				{
+					if (DataOffset >= Limit)
+					{
+						return false;
+					}
+
+					const uint32 Byte = Data[DataOffset++];
+					V |= (Byte & 0x7F) << Shift;
+
+					if (Byte < 0x80)
+					{
+						break;
+					}
+				}
+
+				int32 Delta = ((V & 1) != 0) ? ~(V >> 1) : (V >> 1);
+
+				Last += Delta;
+				return true;
+			};
+
+		for (uint32 TriangleIndex = 0; TriangleIndex < TrianglesNum; TriangleIndex++)
+		{
+			if (Offset >= Limit)
+			{
+				return false;
+			}
+			const uint8 Code = Data[Offset++];
+			const uint8 NibbleLeft = Code >> 4;
+			const uint8 NibbleRight = Code & 0x0f;
+
+			if (NibbleLeft < 0xf)
+			{
+				uint32 A = 0;
+				uint32 B = 0;
+				if (!GetEdge(NibbleLeft, A, B))
+				{
+					return false;
+				}
+
+				uint32 C = 0;
+				if (NibbleRight == 0) // 0xX0
+				{
+					C = Next++;
+					PushVertex(C);
+				}
+				else if (NibbleRight < 0x0d) // 0xXY
+				{
+					if (!GetVertex(NibbleRight, C))
+					{
+						return false;
+					}
+				}
+				else if (NibbleRight == 0x0d) // 0xXd
+				{
+					C = --Last;
+					PushVertex(C);
+				}
+				else if (NibbleRight == 0x0e) // 0xXe
+				{
+					C = ++Last;
+					PushVertex(C);
+				}
+				else // 0xXf
+				{
+					if (!DecodeIndex())
+					{
+						return false;
+					}
+					C = Last;
+					PushVertex(C);
+				}
+
+				PushEdge(C, B); // push CB
+				PushEdge(A, C); // push AC
+
+				EmitTriangle(A, B, C);
+			}
+			else if (NibbleRight < 0xe) // 0xfY
+			{
+				const uint8 ZW = CodeAux[NibbleRight];
+				const uint8 Z = ZW >> 4;
+				const uint8 W = ZW & 0x0f;
+
+				const uint32 A = Next++;
+				uint32 B = 0;
+				uint32 C = 0;
+
+				if (Z == 0)
+				{
+					B = Next++;
+				}
+				else if (!GetVertex(Z - 1, B))
+				{
+					return false;
+				}
+
+				if (W == 0)
+				{
+					C = Next++;
+				}
+				else if (!GetVertex(W - 1, C))
+				{
+					return false;
+				}
+
+				PushEdge(B, A); // push BA
+				PushEdge(C, B); // push CB
+				PushEdge(A, C); // push AC
+				PushVertex(A);
+				if (Z == 0)
+				{
+					PushVertex(B);
+				}
+				if (W == 0)
+				{
+					PushVertex(C);
+				}
+
+				EmitTriangle(A, B, C);
+			}
+			else // 0xfe - 0xff
+			{
+				if (DataOffset >= Limit)
+				{
+					return false;
+				}
+
+				const uint8 ZW = Data[DataOffset++];
+				const uint8 Z = ZW >> 4;
+				const uint8 W = ZW & 0x0f;
+				if (ZW == 0)
+				{
+					Next = 0;
+				}
+
+				uint32 A = 0;
+				if (Code == 0xfe)
+				{
+					A = Next++;
+				}
+				else
+				{
+					if (!DecodeIndex())
+					{
+						return false;
+					}
+					A = Last;
+				}
+
+				uint32 B = 0;
+				if (Z == 0)
+				{
+					B = Next++;
+				}
+				else if (Z < 0xf)
+				{
+					if (!GetVertex(Z - 1, B))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					if (!DecodeIndex())
+					{
+						return false;
+					}
+					B = Last;
+				}
+
+				uint32 C = 0;
+				if (W == 0)
+				{
+					C = Next++;
+				}
+				else if (W < 0xf)
+				{
+					if (!GetVertex(W - 1, C))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					if (!DecodeIndex())
+					{
+						return false;
+					}
+					C = Last;
+				}
+
+				PushEdge(B, A); // push BA
+				PushEdge(C, B); // push CB
+				PushEdge(A, C); // push AC
+				PushVertex(A);
+				if (Z == 0 || Z == 0xf)
+				{
+					PushVertex(B);
+				}
+				if (W == 0 || W == 0xf)
+				{
+					PushVertex(C);
+				}
+
+				EmitTriangle(A, B, C);
+			}
+		}
+
+		return true;
+	}
+
+	template<typename ComponentType>
+	void DecodeMeshOptOctahedralScalar(ComponentType* Data, const int64 First, const int64 Num, const float MaxInt)
+	{
+		for (int64 Index = First * 4; Index < (First + Num) * 4; Index += 4)
+		{
+			float X = Data[Index];
+			float Y = Data[Index + 1];
+			const float One = Data[Index + 2];
+			X /= One;
+			Y /= One;
+			const float Z = 1.0f - FMath::Abs(X) - FMath::Abs(Y);
+			const float T = FMath::Max(-Z, 0.0f);
+			X -= (X >= 0) ? T : -T;
+			Y -= (Y >= 0) ? T : -T;
+			const float H = MaxInt / FMath::Sqrt(X * X + Y * Y + Z * Z);
+			Data[Index + 0] = RoundMeshOptFilterValue(X * H);
+			Data[Index + 1] = RoundMeshOptFilterValue(Y * H);
+			Data[Index + 2] = RoundMeshOptFilterValue(Z * H);
+		}
+	}
+
+	void DecodeMeshOptOctahedral8(int8* Data, const int64 First, const int64 Num, const bool bUseSIMD)
+	{
+		int64 Done = 0;
+		if (bUseSIMD)
+		{
+#if GLTFRUNTIME_MESHOPT_SSE
+			for (; Done + 4 <= Num; Done += 4)
+			{
+				__m128i* Elements = reinterpret_cast<__m128i*>(Data + (First + Done) * 4);
+				const __m128i V = _mm_loadu_si128(Elements);
+				__m128i A = _mm_srai_epi16(_mm_unpacklo_epi8(V, V), 8);
+				__m128i B = _mm_srai_epi16(_mm_unpackhi_epi8(V, V), 8);
+				DecodeMeshOptOctahedralSSE(A, B, 127.0f);
+				_mm_storeu_si128(Elements, _mm_packs_epi16(A, B));
+			}
+#elif GLTFRUNTIME_MESHOPT_NEON
+			for (; Done + 8 <= Num; Done += 8)
+			{
+				int8* Elements = Data + (First + Done) * 4;
+				int8x8x4_t V = vld4_s8(Elements);
+				const int16x8_t X = vmovl_s8(V.val[0]);
+				const int16x8_t Y = vmovl_s8(V.val[1]);
+				const int16x8_t One = vmovl_s8(V.val[2]);
+				int32x4_t X0, Y0, Z0, X1, Y1, Z1;
+				DecodeMeshOptOctahedralNEON(vmovl_s16(vget_low_s16(X)), vmovl_s16(vget_low_s16(Y)), vmovl_s16(vget_low_s16(One)), 127.0f, X0, Y0, Z0);
+				DecodeMeshOptOctahedralNEON(vmovl_s16(vget_high_s16(X)), vmovl_s16(vget_high_s16(Y)), vmovl_s16(vget_high_s16(One)), 127.0f, X1, Y1, Z1);
+				V.val[0] = vmovn_s16(vcombine_s16(vmovn_s32(X0), vmovn_s32(X1)));
+				V.val[1] = vmovn_s16(vcombine_s16(vmovn_s32(Y0), vmovn_s32(Y1)));
+				V.val[2] = vmovn_s16(vcombine_s16(vmovn_s32(Z0), vmovn_s32(Z1)));
+				vst4_s8(Elements, V);
+			}
+#endif
+		}
+		DecodeMeshOptOctahedralScalar(Data, First + Done, Num - Done, 127.0f);
+	}
+
+	void DecodeMeshOptOctahedral16(int16* Data, const int64 First, const int64 Num, const bool bUseSIMD)
+	{
+		int64 Done = 0;
+		if (bUseSIMD)
+		{
+#if GLTFRUNTIME_MESHOPT_SSE
+			for (; Done + 4 <= Num; Done += 4)
+			{
+				__m128i* Elements = reinterpret_cast<__m128i*>(Data + (First + Done) * 4);
+				__m128i A = _mm_loadu_si128(Elements);
+				__m128i B = _mm_loadu_si128(Elements + 1);
+				DecodeMeshOptOctahedralSSE(A, B, 32767.0f);
+				_mm_storeu_si128(Elements, A);
+				_mm_storeu_si128(Elements + 1, B);
+			}
+#elif GLTFRUNTIME_MESHOPT_NEON
+			for (; Done + 4 <= Num; Done += 4)
+			{
+				int16* Elements = Data + (First + Done) * 4;
+				int16x4x4_t V = vld4_s16(Elements);
+				int32x4_t X, Y, Z;
+				DecodeMeshOptOctahedralNEON(vmovl_s16(V.val[0]), vmovl_s16(V.val[1]), vmovl_s16(V.val[2]), 32767.0f, X, Y, Z);
+				V.val[0] = vmovn_s32(X);
+				V.val[1] = vmovn_s32(Y);
+				V.val[2] = vmovn_s32(Z);
+				vst4_s16(Elements, V);
+			}
+#endif
+		}
+		DecodeMeshOptOctahedralScalar(Data, First + Done, Num - Done, 32767.0f);
+	}
+
+	void DecodeMeshOptQuaternion(int16* Data, const int64 First, const int64 Num, const bool bUseSIMD)
+	{
+		const float Range = 1.0f / FMath::Sqrt(2.0f);
+
+		int64 Done = 0;
+		if (bUseSIMD)
+		{
+#if GLTFRUNTIME_MESHOPT_SSE
+			const __m128 RangeV = _mm_set1_ps(Range);
+			const __m128 ScaleV = _mm_set1_ps(32767.0f);
+			const __m128i Three = _mm_set1_epi32(3);
+			for (; Done + 4 <= Num; Done += 4)
+			{
+				__m128i* Elements = reinterpret_cast<__m128i*>(Data + (First + Done) * 4);
+				__m128i IX, IY, IZ, IW;
+				TransposeInt16x4SSE(_mm_loadu_si128(Elements), _mm_loadu_si128(Elements + 1), IX, IY, IZ, IW);
+
+				const __m128 One = _mm_cvtepi32_ps(_mm_or_si128(IW, Three));
+				const __m128 X = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(IX), One), RangeV);
+				const __m128 Y = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(IY), One), RangeV);
+				const __m128 Z = _mm_mul_ps(_mm_div_ps(_mm_cvtepi32_ps(IZ), One), RangeV);
+				const __m128 W = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(X, X)), _mm_mul_ps(Y, Y)), _mm_mul_ps(Z, Z))));
+
+				const __m128i RX = RoundMeshOptFilterValueSSE(_mm_mul_ps(X, ScaleV));
+				const __m128i RY = RoundMeshOptFilterValueSSE(_mm_mul_ps(Y, ScaleV));
+				const __m128i RZ = RoundMeshOptFilterValueSSE(_mm_mul_ps(Z, ScaleV));
+				const __m128i RW = RoundMeshOptFilterValueSSE(_mm_mul_ps(W, ScaleV));
+
+				// component c receives W, X, Y or Z when (c - MaxComp) & 3 is respectively 0, 1, 2 or 3
+				const __m128i MaxComp = _mm_and_si128(IW, Three);
+				__m128i Components[4];
+				for (int32 Component = 0; Component < 4; Component++)
+				{
+					const __m128i Source = _mm_and_si128(_mm_sub_epi32(_mm_set1_epi32(Component), MaxComp), Three);
+					Components[Component] = SelectSSE(_mm_cmpeq_epi32(Source, _mm_setzero_si128()), RW,
+						SelectSSE(_mm_cmpeq_epi32(Source, _mm_set1_epi32(1)), RX,
+							SelectSSE(_mm_cmpeq_epi32(Source, _mm_set1_epi32(2)), RY, RZ)));
+				}
+
+				__m128i A, B;
+				InterleaveInt16x4SSE(Components[0], Components[1], Components[2], Components[3], A, B);
+				_mm_storeu_si128(Elements, A);
+				_mm_storeu_si128(Elements + 1, B);
+			}
+#elif GLTFRUNTIME_MESHOPT_NEON
+			const int32x4_t Three = vdupq_n_s32(3);
+			for (; Done + 4 <= Num; Done += 4)
+			{
+				int16* Elements = Data + (First + Done) * 4;
+				int16x4x4_t V = vld4_s16(Elements);
+				const int32x4_t IW = vmovl_s16(V.val[3]);
+
+				const float32x4_t One = vcvtq_f32_s32(vorrq_s32(IW, Three));
+				const float32x4_t X = vmulq_n_f32(vdivq_f32(vcvtq_f32_s32(vmovl_s16(V.val[0])), One), Range);
+				const float32x4_t Y = vmulq_n_f32(vdivq_f32(vcvtq_f32_s32(vmovl_s16(V.val[1])), One), Range);
+				const float32x4_t Z = vmulq_n_f32(vdivq_f32(vcvtq_f32_s32(vmovl_s16(V.val[2])), One), Range);
+				const float32x4_t W = vsqrtq_f32(vmaxq_f32(vdupq_n_f32(0), vsubq_f32(vsubq_f32(vsubq_f32(vdupq_n_f32(1.0f), vmulq_f32(X, X)), vmulq_f32(Y, Y)), vmulq_f32(Z, Z))));
+
+				const int32x4_t RX = RoundMeshOptFilterValueNEON(vmulq_n_f32(X, 32767.0f));
+				const int32x4_t RY = RoundMeshOptFilterValueNEON(vmulq_n_f32(Y, 32767.0f));
+				const int32x4_t RZ = RoundMeshOptFilterValueNEON(vmulq_n_f32(Z, 32767.0f));
+				const int32x4_t RW = RoundMeshOptFilterValueNEON(vmulq_n_f32(W, 32767.0f));
+
+				// component c receives W, X, Y or Z when (c - MaxComp) & 3 is respectively 0, 1, 2 or 3
+				const int32x4_t MaxComp = vandq_s32(IW, Three);
+				for (int32 Component = 0; Component < 4; Component++)
+				{
+					const int32x4_t Source = vandq_s32(vsubq_s32(vdupq_n_s32(Component), MaxComp), Three);
+					const int32x4_t Value = vbslq_s32(vceqq_s32(Source, vdupq_n_s32(0)), RW,
+						vbslq_s32(vceqq_s32(Source, vdupq_n_s32(1)), RX,
+							vbslq_s32(vceqq_s32(Source, vdupq_n_s32(2)), RY, RZ)));
+					V.val[Component] = vmovn_s32(Value);
+				}
+
+				vst4_s16(Elements, V);
+			}
+#endif
+		}
+
+		for (int64 Offset = (First + Done) * 4; Offset < (First + Num) * 4; Offset += 4)
+		{
+			const float One = Data[Offset + 3] | 3;
+
+			const float X = Data[Offset] / One * Range;
+			const float Y = Data[Offset + 1] / One * Range;
+			const float Z = Data[Offset + 2] / One * Range;
+
+			const float W = FMath::Sqrt(FMath::Max(0.0f, 1.0f - X * X - Y * Y - Z * Z));
+
+			const int32 MaxComp = Data[Offset + 3] & 3;
+
+			Data[Offset + ((MaxComp + 1) % 4)] = RoundMeshOptFilterValue(X * 32767.0f);
+			Data[Offset + ((MaxComp + 2) % 4)] = RoundMeshOptFilterValue(Y * 32767.0f);
+			Data[Offset + ((MaxComp + 3) % 4)] = RoundMeshOptFilterValue(Z * 32767.0f);
+			Data[Offset + ((MaxComp + 0) % 4)] = RoundMeshOptFilterValue(W * 32767.0f);
+		}
+	}
+
+	// Num is the number of 32 bits values (not elements)
+	void DecodeMeshOptExponential(int32* Data, const int64 First, const int64 Num, const bool bUseSIMD)
+	{
+		// 2^E is built as 2^(E/2) * 2^(E - E/2) to avoid denormals, the product is still exact before the final rounding
+		int64 Done = 0;
+		if (bUseSIMD)
+		{
+#if GLTFRUNTIME_MESHOPT_SSE
+			const __m128i Bias = _mm_set1_epi32(127);
+			for (; Done + 4 <= Num; Done += 4)
+			{
+				__m128i* Values = reinterpret_cast<__m128i*>(Data + First + Done);
+				const __m128i V = _mm_loadu_si128(Values);
+				const __m128i E = _mm_srai_epi32(V, 24);
+				const __m128i M = _mm_srai_epi32(_mm_slli_epi32(V, 8), 8);
+				const __m128i E0 = _mm_srai_epi32(E, 1);
+				const __m128i E1 = _mm_sub_epi32(E, E0);
+				const __m128 Scale0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(E0, Bias), 23));
+				const __m128 Scale1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(E1, Bias), 23));
+				_mm_storeu_ps(reinterpret_cast<float*>(Values), _mm_mul_ps(_mm_mul_ps(_mm_cvtepi32_ps(M), Scale0), Scale1));
+			}
+#elif GLTFRUNTIME_MESHOPT_NEON
+			const int32x4_t Bias = vdupq_n_s32(127);
+			for (; Done + 4 <= Num; Done += 4)
+			{
+				int32* Values = Data + First + Done;
+				const int32x4_t V = vld1q_s32(Values);
+				const int32x4_t E = vshrq_n_s32(V, 24);
+				const int32x4_t M = vshrq_n_s32(vshlq_n_s32(V, 8), 8);
+				const int32x4_t E0 = vshrq_n_s32(E, 1);
+				const int32x4_t E1 = vsubq_s32(E, E0);
+				const float32x4_t Scale0 = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(E0, Bias), 23));
+				const float32x4_t Scale1 = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(E1, Bias), 23));
+				vst1q_f32(reinterpret_cast<float*>(Values), vmulq_f32(vmulq_f32(vcvtq_f32_s32(M), Scale0), Scale1));
+			}
+#endif
+		}
+
+		auto PowerOfTwo = [](const int32 Exponent)
+			{
+				const uint32 Bits = static_cast<uint32>(Exponent + 127) << 23;
+				float Value;
+				FMemory::Memcpy(&Value, &Bits, sizeof(float));
+				return Value;
+			};
+
+		float* Dest = reinterpret_cast<float*>(Data);
+		for (int64 Offset = First + Done; Offset < First + Num; Offset++)
+		{
+			const int32 E = Data[Offset] >> 24;
+			const int32 M = (Data[Offset] << 8) >> 8;
+			const int32 E0 = E >> 1;
+			Dest[Offset] = static_cast<float>(M) * PowerOfTwo(E0) * PowerOfTwo(E - E0);
+		}
+	}
+
+	bool ApplyMeshOptFilter(const FString& Filter, const int64 Stride, const int64 Elements, TArray64<uint8>& Bytes, const bool bUseSIMD)
+	{
+		TFunction<void(const int64, const int64)> FilterFunction;
+		int64 FilterElements = Elements;
+
+		if (Filter == "OCTAHEDRAL" && Stride == 4)
+		{
+			FilterFunction = [&](const int64 First, const int64 Num) { DecodeMeshOptOctahedral8(reinterpret_cast<int8*>(Bytes.GetData()), First, Num, bUseSIMD); };
+		}
+		else if (Filter == "OCTAHEDRAL" && Stride == 8)
+		{
+			FilterFunction = [&](const int64 First, const int64 Num) { DecodeMeshOptOctahedral16(reinterpret_cast<int16*>(Bytes.GetData()), First, Num, bUseSIMD); };
+		}
+		else if (Filter == "QUATERNION" && Stride == 8)
+		{
+			FilterFunction = [&](const int64 First, const int64 Num) { DecodeMeshOptQuaternion(reinterpret_cast<int16*>(Bytes.GetData()), First, Num, bUseSIMD); };
+		}
+		else if (Filter == "EXPONENTIAL" && (Stride % 4) == 0)
+		{
+			FilterElements = Bytes.Num() / 4;
+			FilterFunction = [&](const int64 First, const int64 Num) { DecodeMeshOptExponential(reinterpret_cast<int32*>(Bytes.GetData()), First, Num, bUseSIMD); };
+		}
+		else if (Filter == "" || Filter == "NONE")
+		{
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+
+		// every element is filtered independently
+		const int32 NumBatches = static_cast<int32>((FilterElements + MeshOptFilterBatchElements - 1) / MeshOptFilterBatchElements);
+		ParallelFor(NumBatches, [&](const int32 BatchIndex)
+			{
+				const int64 First = BatchIndex * MeshOptFilterBatchElements;
+				FilterFunction(First, FMath::Min(FilterElements - First, MeshOptFilterBatchElements));
+			}, NumBatches < 2);
+
+		return true;
+	}
+
+	bool UseMeshOptSIMD()
+	{
+		return (GLTFRUNTIME_MESHOPT_SSE || GLTFRUNTIME_MESHOPT_NEON) && CVarglTFRuntimeMeshOptSIMD.GetValueOnAnyThread() != 0;
+	}
+}
+
+bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecompressMeshOptimizer, FColor::Magenta);
+
+	const bool bUseSIMD = glTFRuntime::UseMeshOptSIMD();
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// refactored in april 2024 to be more compliant with https://www.npmjs.com/package/meshoptimize
+	if (Mode == "ATTRIBUTES" && Blob.Num > 32 && Blob.Data[0] == 0xa0)
+	{
+		UncompressedBytes.SetNumUninitialized(Elements * Stride);
+		if (!glTFRuntime::DecodeMeshOptAttributes(Blob.Data, Blob.Num, Stride, Elements, UncompressedBytes.GetData(), bUseSIMD))
+		{
+			return false;
+		}
+	}
+	else if (Mode == "TRIANGLES" && Blob.Num >= 17 && Blob.Data[0] == 0xe1 && (Stride == 2 || Stride == 4) && ((Elements % 3) == 0))
+	{
+		UncompressedBytes.SetNumUninitialized(Elements * Stride);
+		if (!glTFRuntime::DecodeMeshOptTriangles(Blob.Data, Blob.Num, Stride, Elements, UncompressedBytes.GetData()))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	if (UncompressedBytes.Num() > 0)
+	{
+		if (!glTFRuntime::ApplyMeshOptFilter(Filter, Stride, Elements, UncompressedBytes, bUseSIMD))
+		{
+			AddError("DecompressMeshOptimizer()", "Unsupported Filter");
+			return false;
+		}
+	}
+
+	UE_LOG(LogGLTFRuntime, Verbose, TEXT("Decoded %lld bytes of meshopt %s data (filter: %s, SIMD: %s) in %f ms"), UncompressedBytes.Num(), *Mode, *Filter, bUseSIMD ? TEXT("on") : TEXT("off"), (FPlatformTime::Seconds() - StartTime) * 1000);
+
+	return true;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntime
+{
+	// minimal attributes encoder (the smallest mode is chosen for each group), used only for building the benchmark streams
+	void EncodeMeshOptAttributes(const uint8* Input, const int64 Stride, const int64 Elements, TArray64<uint8>& Output)
+	{
+		Output.Reset();
+		Output.Add(0xa0);
+
+		const int64 MaxBlockElements = FMath::Min<int64>((8192 / Stride) & ~15, 256);
+
+		// the first element is the baseline, so its deltas are 0
+		TArray<uint8> Baseline;
+		Baseline.Append(Input, Stride);
+		TArray<uint8> LastValues = Baseline;
+
+		for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex += MaxBlockElements)
+		{
+			const int64 BlockElements = FMath::Min<int64>(Elements - ElementIndex, MaxBlockElements);
+			const int64 GroupCount = ((BlockElements + 0x0F) & ~0x0F) >> 4;
+			const int64 NumberOfHeaderBytes = ((GroupCount + 0x03) & ~0x03) >> 2;
+
+			for (int64 ElementByteIndex = 0; ElementByteIndex < Stride; ElementByteIndex++)
+			{
+				const int64 HeaderOffset = Output.Num();
+				Output.AddZeroed(NumberOfHeaderBytes);
+
+				for (int64 GroupIndex = 0; GroupIndex < GroupCount; GroupIndex++)
+				{
+					uint8 Deltas[16] = {};
+					bool bAllZeros = true;
+					int32 Escapes2Bits = 0;
+					int32 Escapes4Bits = 0;
+					for (int32 Index = 0; Index < 16; Index++)
+					{
+						const int64 BlockElementIndex = (GroupIndex << 4) + Index;
+						if (BlockElementIndex < BlockElements)
+						{
+							const uint8 Value = Input[(ElementIndex + BlockElementIndex) * Stride + ElementByteIndex];
+							const uint8 Delta = Value - LastValues[ElementByteIndex];
+							Deltas[Index] = static_cast<uint8>((Delta << 1) ^ static_cast<uint8>(static_cast<int8>(Delta) >> 7));
+							LastValues[ElementByteIndex] = Value;
+						}
+						bAllZeros &= Deltas[Index] == 0;
+						Escapes2Bits += Deltas[Index] >= 0x03 ? 1 : 0;
+						Escapes4Bits += Deltas[Index] >= 0x0f ? 1 : 0;
+					}
+
+					uint8 Mode = 3;
+					if (bAllZeros)
+					{
+						Mode = 0;
+					}
+					else if (4 + Escapes2Bits <= FMath::Min(8 + Escapes4Bits, 16))
+					{
+						Mode = 1;
+					}
+					else if (8 + Escapes4Bits <= 16)
+					{
+						Mode = 2;
+					}
+
+					Output[HeaderOffset + (GroupIndex >> 2)] |= Mode << ((GroupIndex & 0x03) << 1);
+
+					if (Mode == 3)
+					{
+						Output.Append(Deltas, 16);
+					}
+					else if (Mode != 0)
+					{
+						const uint8 Escape = Mode == 1 ? 0x03 : 0x0f;
+						const int64 GroupHeaderOffset = Output.Num();
+						Output.AddZeroed(Mode == 1 ? 4 : 8);
+						for (int32 Index = 0; Index < 16; Index++)
+						{
+							const uint8 Value = FMath::Min(Deltas[Index], Escape);
+							if (Mode == 1)
+							{
+								Output[GroupHeaderOffset + (Index >> 2)] |= Value << (6 - ((Index & 0x03) << 1));
+							}
+							else
+							{
+								Output[GroupHeaderOffset + (Index >> 1)] |= Value << ((Index & 0x01) ? 0 : 4);
+							}
+						}
+
+						for (int32 Index = 0; Index < 16; Index++)
+						{
+							if (Deltas[Index] >= Escape)
+							{
+								Output.Add(Deltas[Index]);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// the baseline tail is padded to at least 32 bytes
+		Output.AddZeroed(FMath::Max<int64>(32 - Stride, 0));
+		Output.Append(Baseline.GetData(), Stride);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeMeshOptSIMDBenchmark, "glTFRuntime.MeshOpt.SIMDBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeMeshOptSIMDBenchmark::RunTest(const FString& Parameters)
+{
+	const int64 Elements = 1024 * 1024;
+	const int32 Iterations = 5;
+
+	struct FMeshOptBenchmarkStream
+	{
+		FString Filter;
+		int64 Stride;
+		TArray64<uint8> Compressed;
+	};
+
+	// mesh-like (smooth with some noise) streams for every filter
+	FRandomStream RandomStream(17);
+	TArray<FMeshOptBenchmarkStream> Streams;
+	auto AddStream = [&](const FString& Filter, const int64 Stride, TFunctionRef<void(const int64, uint8*)> Generator)
+		{
+			TArray64<uint8> Raw;
+			Raw.AddZeroed(Elements * Stride);
+			for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex++)
+			{
+				Generator(ElementIndex, Raw.GetData() + ElementIndex * Stride);
+			}
+
+			FMeshOptBenchmarkStream& Stream = Streams.AddDefaulted_GetRef();
+			Stream.Filter = Filter;
+			Stream.Stride = Stride;
+			glTFRuntime::EncodeMeshOptAttributes(Raw.GetData(), Stride, Elements, Stream.Compressed);
+		};
+
+	AddStream("NONE", 8, [&](const int64 ElementIndex, uint8* Element)
+		{
+			uint16* Position = reinterpret_cast<uint16*>(Element);
+			Position[0] = static_cast<uint16>(ElementIndex * 7 + RandomStream.RandRange(0, 3));
+			Position[1] = static_cast<uint16>(32768 + FMath::Sin(ElementIndex * 0.001f) * 30000 + RandomStream.RandRange(0, 15));
+			Position[2] = static_cast<uint16>((ElementIndex >> 4) + RandomStream.RandRange(0, 255));
+		});
+
+	AddStream("OCTAHEDRAL", 8, [&](const int64 ElementIndex, uint8* Element)
+		{
+			int16* Normal = reinterpret_cast<int16*>(Element);
+			Normal[0] = static_cast<int16>(FMath::Cos(ElementIndex * 0.01f) * 20000 + RandomStream.RandRange(-64, 64));
+			Normal[1] = static_cast<int16>(FMath::Sin(ElementIndex * 0.003f) * 20000 + RandomStream.RandRange(-64, 64));
+			Normal[2] = 32767;
+			Normal[3] = static_cast<int16>(RandomStream.RandRange(0, 1) ? 1 : -1);
+		});
+
+	AddStream("QUATERNION", 8, [&](const int64 ElementIndex, uint8* Element)
+		{
+			int16* Rotation = reinterpret_cast<int16*>(Element);
+			Rotation[0] = static_cast<int16>(FMath::Cos(ElementIndex * 0.002f) * 8000 + RandomStream.RandRange(-32, 32));
+			Rotation[1] = static_cast<int16>(FMath::Sin(ElementIndex * 0.005f) * 8000 + RandomStream.RandRange(-32, 32));
+			Rotation[2] = static_cast<int16>(RandomStream.RandRange(-4096, 4096));
+			// 14 bits scale and the index of the largest component
+			Rotation[3] = static_cast<int16>((4095 << 2) | RandomStream.RandRange(0, 3));
+		});
+
+	AddStream("EXPONENTIAL", 12, [&](const int64 ElementIndex, uint8* Element)
+		{
+			int32* Values = reinterpret_cast<int32*>(Element);
+			for (int32 Component = 0; Component < 3; Component++)
+			{
+				const int32 Mantissa = static_cast<int32>(FMath::Sin(ElementIndex * 0.0001f * (Component + 1)) * 4000000) + RandomStream.RandRange(-8, 8);
+				Values[Component] = static_cast<int32>((static_cast<uint32>(-15) << 24) | (static_cast<uint32>(Mantissa) & 0x00ffffff));
+			}
+		});
+
+	IConsoleVariable* SIMDConsoleVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("glTFRuntime.MeshOptSIMD"));
+	if (!TestNotNull(TEXT("glTFRuntime.MeshOptSIMD"), SIMDConsoleVariable))
+	{
+		return false;
+	}
+
+	const int32 OriginalSIMDValue = SIMDConsoleVariable->GetInt();
+
+	if (!GLTFRUNTIME_MESHOPT_SSE && !GLTFRUNTIME_MESHOPT_NEON)
+	{
+		AddInfo(TEXT("No SIMD kernels available on this platform, both runs use the scalar path"));
+	}
+
+	for (const FMeshOptBenchmarkStream& Stream : Streams)
+	{
+		TArray64<uint8> Decoded[2];
+		double BestTime[2] = { MAX_dbl, MAX_dbl };
+
+		for (int32 SIMDValue = 0; SIMDValue < 2; SIMDValue++)
+		{
+			SIMDConsoleVariable->Set(SIMDValue, ECVF_SetByConsole);
+			const bool bUseSIMD = glTFRuntime::UseMeshOptSIMD();
+
+			for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+			{
+				const double StartTime = FPlatformTime::Seconds();
+				Decoded[SIMDValue].SetNumUninitialized(Elements * Stream.Stride);
+				const bool bSuccess = glTFRuntime::DecodeMeshOptAttributes(Stream.Compressed.GetData(), Stream.Compressed.Num(), Stream.Stride, Elements, Decoded[SIMDValue].GetData(), bUseSIMD) &&
+					glTFRuntime::ApplyMeshOptFilter(Stream.Filter, Stream.Stride, Elements, Decoded[SIMDValue], bUseSIMD);
+				BestTime[SIMDValue] = FMath::Min(BestTime[SIMDValue], FPlatformTime::Seconds() - StartTime);
+
+				if (!TestTrue(FString::Printf(TEXT("Decoding %s stream (glTFRuntime.MeshOptSIMD %d)"), *Stream.Filter, SIMDValue), bSuccess))
+				{
+					SIMDConsoleVariable->Set(OriginalSIMDValue, ECVF_SetByConsole);
+					return false;
+				}
+			}
+		}
+
+		TestTrue(FString::Printf(TEXT("Scalar and SIMD %s streams match"), *Stream.Filter), Decoded[0] == Decoded[1]);
+
+		AddInfo(FString::Printf(TEXT("%s: %lld elements (%lld compressed bytes), glTFRuntime.MeshOptSIMD 0: %f ms, glTFRuntime.MeshOptSIMD 1: %f ms (best of %d)"),
+			*Stream.Filter, Elements, Stream.Compressed.Num(), BestTime[0] * 1000, BestTime[1] * 1000, Iterations));
+	}
+
+	SIMDConsoleVariable->Set(OriginalSIMDValue, ECVF_SetByConsole);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,408 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+
+namespace glTFRuntime
+{
+	// parameters of the linear-speed vertex cache optimization (Tom Forsyth)
+	const int32 VertexCacheOptimizerCacheSize = 32;
+	const float VertexCacheOptimizerDecayPower = 1.5f;
+	const float VertexCacheOptimizerLastTriangleScore = 0.75f;
+	const float VertexCacheOptimizerValenceBoostScale = 2.0f;
+	const float VertexCacheOptimizerValenceBoostPower = 0.5f;
+
+	// the FIFO size used for simulating the post-transform cache when computing stats and overdraw clusters
+	const int32 VertexCacheSimulationSize = 16;
+
+	float GetVertexCacheScore(const int32 CachePosition, const int32 NumActiveTriangles)
+	{
+		if (NumActiveTriangles == 0)
+		{
+			// no more triangles to emit for this vertex
+			return -1.0f;
+		}
+
+		float Score = 0.0f;
+		if (CachePosition >= 0)
+		{
+			if (CachePosition < 3)
+			{
+				// used by the last triangle, fixed score to avoid rewarding the immediate reuse of the same edge
+				Score = VertexCacheOptimizerLastTriangleScore;
+			}
+			else
+			{
+				const float Scaler = 1.0f / (VertexCacheOptimizerCacheSize - 3);
+				Score = FMath::Pow(1.0f - (CachePosition - 3) * Scaler, VertexCacheOptimizerDecayPower);
+			}
+		}
+
+		// bonus for vertices with few remaining triangles (avoids leaving lonely triangles around)
+		Score += VertexCacheOptimizerValenceBoostScale * FMath::Pow(static_cast<float>(NumActiveTriangles), -VertexCacheOptimizerValenceBoostPower);
+
+		return Score;
+	}
+
+	// simulate a FIFO cache, returns the number of misses of each triangle
+	void SimulateVertexCache(const uint32* Indices, const int32 NumTriangles, const int32 NumVertices, TArray<uint8>& TriangleMisses)
+	{
+		TArray<int32> VertexTimestamps;
+		VertexTimestamps.AddZeroed(NumVertices);
+		int32 Timestamp = VertexCacheSimulationSize + 1;
+
+		TriangleMisses.SetNumUninitialized(NumTriangles);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			uint8 Misses = 0;
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const uint32 VertexIndex = Indices[TriangleIndex * 3 + Corner];
+				if (Timestamp - VertexTimestamps[VertexIndex] > VertexCacheSimulationSize)
+				{
+					VertexTimestamps[VertexIndex] = Timestamp++;
+					Misses++;
+				}
+			}
+			TriangleMisses[TriangleIndex] = Misses;
+		}
+	}
+}
+
+FglTFRuntimeVertexCacheStats FglTFRuntimeParser::AnalyzeVertexCache(const uint32* Indices, const int32 NumIndices, const int32 NumVertices)
+{
+	FglTFRuntimeVertexCacheStats Stats;
+
+	const int32 NumTriangles = NumIndices / 3;
+	if (NumTriangles <= 0 || NumVertices <= 0)
+	{
+		return Stats;
+	}
+
+	TArray<uint8> TriangleMisses;
+	glTFRuntime::SimulateVertexCache(Indices, NumTriangles, NumVertices, TriangleMisses);
+
+	TBitArray<> ReferencedVertices(false, NumVertices);
+	for (int32 Index = 0; Index < NumTriangles * 3; Index++)
+	{
+		if (!ReferencedVertices[Indices[Index]])
+		{
+			ReferencedVertices[Indices[Index]] = true;
+			Stats.NumVertices++;
+		}
+	}
+
+	Stats.NumTriangles = NumTriangles;
+	for (const uint8 Misses : TriangleMisses)
+	{
+		Stats.NumTransformedVertices += Misses;
+	}
+
+	return Stats;
+}
+
+void FglTFRuntimeParser::OptimizeVertexCache(uint32* Indices, const int32 NumIndices, const int32 NumVertices)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_OptimizeVertexCache, FColor::Magenta);
+
+	const int32 NumTriangles = NumIndices / 3;
+	if (NumTriangles <= 1 || NumVertices <= 0)
+	{
+		return;
+	}
+
+	// build vertex -> triangles adjacency
+	TArray<int32> NumActiveTriangles;
+	NumActiveTriangles.AddZeroed(NumVertices);
+	for (int32 Index = 0; Index < NumTriangles * 3; Index++)
+	{
+		NumActiveTriangles[Indices[Index]]++;
+	}
+
+	TArray<int32> AdjacencyOffsets;
+	AdjacencyOffsets.AddUninitialized(NumVertices + 1);
+	AdjacencyOffsets[0] = 0;
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		AdjacencyOffsets[VertexIndex + 1] = AdjacencyOffsets[VertexIndex] + NumActiveTriangles[VertexIndex];
+	}
+
+	TArray<int32> Adjacency;
+	Adjacency.AddUninitialized(NumTriangles * 3);
+	{
+		TArray<int32> AdjacencyCursors = AdjacencyOffsets;
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				Adjacency[AdjacencyCursors[Indices[TriangleIndex * 3 + Corner]]++] = TriangleIndex;
+			}
+		}
+	}
+
+	TArray<int32> CachePositions;
+	CachePositions.Init(INDEX_NONE, NumVertices);
+
+	TArray<float> VertexScores;
+	VertexScores.AddUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		VertexScores[VertexIndex] = glTFRuntime::GetVertexCacheScore(INDEX_NONE, NumActiveTriangles[VertexIndex]);
+	}
+
+	TBitArray<> EmittedTriangles(false, NumTriangles);
+
+	TArray<uint32> OptimizedIndices;
+	OptimizedIndices.Reserve(NumTriangles * 3);
+
+	// three additional slots for the vertices pushed by the new triangle
+	int32 Cache[glTFRuntime::VertexCacheOptimizerCacheSize + 3];
+	int32 NewCache[glTFRuntime::VertexCacheOptimizerCacheSize + 3];
+	int32 CacheNum = 0;
+
+	int32 InputCursor = 0;
+	int32 BestTriangle = INDEX_NONE;
+
+	for (int32 EmittedIndex = 0; EmittedIndex < NumTriangles; EmittedIndex++)
+	{
+		// dead end, pick the next triangle in input order
+		if (BestTriangle == INDEX_NONE)
+		{
+			while (EmittedTriangles[InputCursor])
+			{
+				InputCursor++;
+			}
+			BestTriangle = InputCursor;
+		}
+
+		EmittedTriangles[BestTriangle] = true;
+
+		int32 NewCacheNum = 0;
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			const uint32 VertexIndex = Indices[BestTriangle * 3 + Corner];
+			OptimizedIndices.Add(VertexIndex);
+			NewCache[NewCacheNum++] = VertexIndex;
+
+			// remove the emitted triangle from the vertex adjacency
+			int32* VertexAdjacency = Adjacency.GetData() + AdjacencyOffsets[VertexIndex];
+			const int32 VertexNumActiveTriangles = NumActiveTriangles[VertexIndex];
+			for (int32 AdjacencyIndex = 0; AdjacencyIndex < VertexNumActiveTriangles; AdjacencyIndex++)
+			{
+				if (VertexAdjacency[AdjacencyIndex] == BestTriangle)
+				{
+					VertexAdjacency[AdjacencyIndex] = VertexAdjacency[VertexNumActiveTriangles - 1];
+					break;
+				}
+			}
+			NumActiveTriangles[VertexIndex]--;
+		}
+
+		for (int32 CacheIndex = 0; CacheIndex < CacheNum; CacheIndex++)
+		{
+			const int32 VertexIndex = Cache[CacheIndex];
+			if (VertexIndex != static_cast<int32>(Indices[BestTriangle * 3]) && VertexIndex != static_cast<int32>(Indices[BestTriangle * 3 + 1]) && VertexIndex != static_cast<int32>(Indices[BestTriangle * 3 + 2]))
+			{
+				NewCache[NewCacheNum++] = VertexIndex;
+			}
+		}
+
+		// update the scores of the vertices in the cache (and of the ones that have been pushed out)
+		for (int32 CacheIndex = 0; CacheIndex < NewCacheNum; CacheIndex++)
+		{
+			const int32 VertexIndex = NewCache[CacheIndex];
+			CachePositions[VertexIndex] = CacheIndex < glTFRuntime::VertexCacheOptimizerCacheSize ? CacheIndex : INDEX_NONE;
+			VertexScores[VertexIndex] = glTFRuntime::GetVertexCacheScore(CachePositions[VertexIndex], NumActiveTriangles[VertexIndex]);
+		}
+
+		// rescore the triangles touched by the cache, and find the best candidate among them
+		BestTriangle = INDEX_NONE;
+		float BestScore = -1.0f;
+		for (int32 CacheIndex = 0; CacheIndex < NewCacheNum; CacheIndex++)
+		{
+			const int32 VertexIndex = NewCache[CacheIndex];
+			const int32* VertexAdjacency = Adjacency.GetData() + AdjacencyOffsets[VertexIndex];
+			for (int32 AdjacencyIndex = 0; AdjacencyIndex < NumActiveTriangles[VertexIndex]; AdjacencyIndex++)
+			{
+				const int32 TriangleIndex = VertexAdjacency[AdjacencyIndex];
+				const float Score = VertexScores[Indices[TriangleIndex * 3]] + VertexScores[Indices[TriangleIndex * 3 + 1]] + VertexScores[Indices[TriangleIndex * 3 + 2]];
+				if (Score > BestScore)
+				{
+					BestScore = Score;
+					BestTriangle = TriangleIndex;
+				}
+			}
+		}
+
+		CacheNum = FMath::Min(NewCacheNum, glTFRuntime::VertexCacheOptimizerCacheSize);
+		FMemory::Memcpy(Cache, NewCache, CacheNum * sizeof(int32));
+	}
+
+	FMemory::Memcpy(Indices, OptimizedIndices.GetData(), NumTriangles * 3 * sizeof(uint32));
+}
+
+void FglTFRuntimeParser::OptimizeOverdraw(uint32* Indices, const int32 NumIndices, const int32 NumVertices, TFunctionRef<FVector(const uint32)> GetPosition, const float Threshold)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_OptimizeOverdraw, FColor::Magenta);
+
+	const int32 NumTriangles = NumIndices / 3;
+	if (NumTriangles <= 1 || NumVertices <= 0)
+	{
+		return;
+	}
+
+	TArray<uint8> TriangleMisses;
+	glTFRuntime::SimulateVertexCache(Indices, NumTriangles, NumVertices, TriangleMisses);
+
+	// hard boundaries: the cache is completely flushed, so clusters can be moved around without losing efficiency
+	TArray<int32> HardClusters;
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		if (TriangleIndex == 0 || TriangleMisses[TriangleIndex] == 3)
+		{
+			HardClusters.Add(TriangleIndex);
+		}
+	}
+	HardClusters.Add(NumTriangles);
+
+	// soft boundaries: split the hard clusters wherever the local ACMR stays within Threshold of the cluster one
+	TArray<int32> Clusters;
+	TArray<int32> VertexTimestamps;
+	VertexTimestamps.AddZeroed(NumVertices);
+	int32 Timestamp = glTFRuntime::VertexCacheSimulationSize + 1;
+	for (int32 HardClusterIndex = 0; HardClusterIndex < HardClusters.Num() - 1; HardClusterIndex++)
+	{
+		const int32 FirstTriangle = HardClusters[HardClusterIndex];
+		const int32 LastTriangle = HardClusters[HardClusterIndex + 1];
+
+		int32 ClusterMisses = 0;
+		for (int32 TriangleIndex = FirstTriangle; TriangleIndex < LastTriangle; TriangleIndex++)
+		{
+			ClusterMisses += TriangleMisses[TriangleIndex];
+		}
+		const float ClusterACMR = static_cast<float>(ClusterMisses) / (LastTriangle - FirstTriangle);
+
+		Clusters.Add(FirstTriangle);
+
+		if (Threshold <= 0)
+		{
+			continue;
+		}
+
+		// every soft cluster starts with a flushed cache
+		Timestamp += glTFRuntime::VertexCacheSimulationSize + 1;
+
+		int32 SoftClusterStart = FirstTriangle;
+		int32 SoftClusterMisses = 0;
+		for (int32 TriangleIndex = FirstTriangle; TriangleIndex < LastTriangle; TriangleIndex++)
+		{
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const uint32 VertexIndex = Indices[TriangleIndex * 3 + Corner];
+				if (Timestamp - VertexTimestamps[VertexIndex] > glTFRuntime::VertexCacheSimulationSize)
+				{
+					VertexTimestamps[VertexIndex] = Timestamp++;
+					SoftClusterMisses++;
+				}
+			}
+
+			const int32 SoftClusterTriangles = TriangleIndex - SoftClusterStart + 1;
+			if (TriangleIndex + 1 < LastTriangle && static_cast<float>(SoftClusterMisses) / SoftClusterTriangles <= ClusterACMR * Threshold)
+			{
+				SoftClusterStart = TriangleIndex + 1;
+				SoftClusterMisses = 0;
+				Timestamp += glTFRuntime::VertexCacheSimulationSize + 1;
+				Clusters.Add(SoftClusterStart);
+			}
+		}
+	}
+	Clusters.Add(NumTriangles);
+
+	const int32 NumClusters = Clusters.Num() - 1;
+	if (NumClusters <= 1)
+	{
+		return;
+	}
+
+	// area weighted centroids and normals of the clusters
+	TArray<FVector> ClustersCentroids;
+	TArray<FVector> ClustersNormals;
+	ClustersCentroids.AddZeroed(NumClusters);
+	ClustersNormals.AddZeroed(NumClusters);
+
+	ParallelFor(NumClusters, [&](const int32 ClusterIndex)
+		{
+			FVector Centroid = FVector::ZeroVector;
+			FVector Normal = FVector::ZeroVector;
+			double TotalArea = 0;
+			for (int32 TriangleIndex = Clusters[ClusterIndex]; TriangleIndex < Clusters[ClusterIndex + 1]; TriangleIndex++)
+			{
+				const FVector Position0 = GetPosition(Indices[TriangleIndex * 3]);
+				const FVector Position1 = GetPosition(Indices[TriangleIndex * 3 + 1]);
+				const FVector Position2 = GetPosition(Indices[TriangleIndex * 3 + 2]);
+				const FVector Cross = FVector::CrossProduct(Position1 - Position0, Position2 - Position0);
+				const double Area = Cross.Size();
+				Centroid += (Position0 + Position1 + Position2) * (Area / 3);
+				Normal += Cross;
+				TotalArea += Area;
+			}
+			ClustersCentroids[ClusterIndex] = TotalArea > 0 ? Centroid / TotalArea : FVector::ZeroVector;
+			ClustersNormals[ClusterIndex] = Normal.GetSafeNormal();
+		});
+
+	FVector MeshCentroid = FVector::ZeroVector;
+	for (const FVector& Centroid : ClustersCentroids)
+	{
+		MeshCentroid += Centroid;
+	}
+	MeshCentroid /= NumClusters;
+
+	// clusters facing outwards are more likely to occlude the others, so draw them first
+	TArray<float> ClustersSortKeys;
+	ClustersSortKeys.AddUninitialized(NumClusters);
+	TArray<int32> SortedClusters;
+	SortedClusters.AddUninitialized(NumClusters);
+	for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ClusterIndex++)
+	{
+		ClustersSortKeys[ClusterIndex] = FVector::DotProduct(ClustersCentroids[ClusterIndex] - MeshCentroid, ClustersNormals[ClusterIndex]);
+		SortedClusters[ClusterIndex] = ClusterIndex;
+	}
+
+	SortedClusters.StableSort([&ClustersSortKeys](const int32 A, const int32 B) { return ClustersSortKeys[A] > ClustersSortKeys[B]; });
+
+	TArray<uint32> SortedIndices;
+	SortedIndices.Reserve(NumTriangles * 3);
+	for (const int32 ClusterIndex : SortedClusters)
+	{
+		SortedIndices.Append(Indices + Clusters[ClusterIndex] * 3, (Clusters[ClusterIndex + 1] - Clusters[ClusterIndex]) * 3);
+	}
+
+	FMemory::Memcpy(Indices, SortedIndices.GetData(), NumTriangles * 3 * sizeof(uint32));
+}
+
+void FglTFRuntimeParser::OptimizeVertexFetch(uint32* Indices, const int32 NumIndices, const int32 NumVertices, TArray<uint32>& Remap)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_OptimizeVertexFetch, FColor::Magenta);
+
+	Remap.Init(MAX_uint32, NumVertices);
+
+	// vertices are renumbered in order of first use
+	uint32 NextVertexIndex = 0;
+	for (int32 Index = 0; Index < NumIndices; Index++)
+	{
+		uint32& NewVertexIndex = Remap[Indices[Index]];
+		if (NewVertexIndex == MAX_uint32)
+		{
+			NewVertexIndex = NextVertexIndex++;
+		}
+		Indices[Index] = NewVertexIndex;
+	}
+
+	// unreferenced vertices are moved at the end
+	for (uint32& NewVertexIndex : Remap)
+	{
+		if (NewVertexIndex == MAX_uint32)
+		{
+			NewVertexIndex = NextVertexIndex++;
+		}
+	}
+}
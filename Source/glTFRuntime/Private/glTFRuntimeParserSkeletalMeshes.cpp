@@ -16,6 +16,7 @@
 #include "Rendering/SkeletalMeshRenderData.h"
 #include "Rendering/SkeletalMeshLODRenderData.h"
 #include "Rendering/SkeletalMeshVertexBuffer.h"
+#include "StaticMeshResources.h"
 #if WITH_EDITOR
 #include "IMeshBuilderModule.h"
 #include "LODUtilities.h"
@@ -34,6 +35,7 @@
 #endif
 #include "glTFAnimBoneCompressionCodec.h"
 #include "glTFAnimCurveCompressionCodec.h"
+#include "glTFAnimQuantizedBoneCompressionCodec.h"
 #include "Model.h"
 #include "Animation/MorphTarget.h"
 #include "Animation/AnimCurveTypes.h"
@@ -55,6 +57,33 @@
 #define MAX_BONE_INFLUENCE_WEIGHT 0xff
 #endif
 
+namespace glTFRuntime
+{
+	UglTFAnimBoneCompressionCodec* CreateBoneCompressionCodec(const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig)
+	{
+		if (SkeletalAnimationConfig.bQuantizeBoneTracks)
+		{
+			return NewObject<UglTFAnimQuantizedBoneCompressionCodec>();
+		}
+		return NewObject<UglTFAnimBoneCompressionCodec>();
+	}
+
+	void CompressBoneTracks(UglTFAnimBoneCompressionCodec* CompressionCodec, const int32 NumFrames, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig)
+	{
+		UglTFAnimQuantizedBoneCompressionCodec* QuantizedCompressionCodec = Cast<UglTFAnimQuantizedBoneCompressionCodec>(CompressionCodec);
+		if (!QuantizedCompressionCodec)
+		{
+			return;
+		}
+
+		const int32 NumTracks = QuantizedCompressionCodec->Tracks.Num();
+		const FglTFAnimQuantizedCompressionStats Stats = QuantizedCompressionCodec->Compress(SkeletalAnimationConfig.QuantizeTranslationTolerance, SkeletalAnimationConfig.QuantizeRotationTolerance, SkeletalAnimationConfig.QuantizeScaleTolerance);
+		UE_LOG(LogGLTFRuntime, Log, TEXT("Quantized %d bone tracks (%d frames): %lld -> %lld bytes (%.2fx), %d/%d keys, %d constant channels, max error: translation %f rotation %f scale %f"),
+			NumTracks, NumFrames, Stats.RawSize, Stats.CompressedSize, Stats.GetCompressionRatio(), Stats.NumKeys, Stats.NumSourceKeys, Stats.NumConstantChannels,
+			Stats.MaxTranslationError, Stats.MaxRotationError, Stats.MaxScaleError);
+	}
+}
+
 struct FglTFRuntimeSkeletalMeshContextFinalizer
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext;
@@ -68,19 +97,28 @@ struct FglTFRuntimeSkeletalMeshContextFinalizer
 
 	~FglTFRuntimeSkeletalMeshContextFinalizer()
 	{
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+		// a cancelled load still triggers the callback, but without a SkeletalMesh
+		if (FglTFRuntimeTaskQueue::IsCancelled(SkeletalMeshContext->CancellationFlag))
+		{
+			SkeletalMeshContext->SkeletalMesh = nullptr;
+		}
+
+		TArray<FglTFRuntimeFinalizationStep> Steps;
+		if (SkeletalMeshContext->SkeletalMesh)
+		{
+			Steps = SkeletalMeshContext->Parser->GetSkeletalMeshFinalizationSteps(SkeletalMeshContext);
+		}
+
+		Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeSkeletalMeshAsync"), [SkeletalMeshContext = SkeletalMeshContext, AsyncCallback = AsyncCallback]()
 			{
-				if (SkeletalMeshContext->SkeletalMesh)
-				{
-					SkeletalMeshContext->SkeletalMesh = SkeletalMeshContext->Parser->FinalizeSkeletalMeshWithLODs(SkeletalMeshContext);
-				}
 				AsyncCallback.ExecuteIfBound(SkeletalMeshContext->SkeletalMesh);
 #if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
 				// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
 				SkeletalMeshContext->UnregisterGCObject();
 #endif
-			}, TStatId(), nullptr, ENamedThreads::GameThread);
-		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+			});
+
+		FglTFRuntimeFinalizationQueue::Get().Enqueue(MoveTemp(Steps));
 	}
 };
 
@@ -219,6 +257,9 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		return nullptr;
 	}
 
+	// the LODs flags, the bones caches and the indices are updated below
+	SkeletalMeshContext->CopyLODsToContext();
+
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
 	SkeletalMeshContext->SkeletalMesh->SetEnablePerPolyCollision(SkeletalMeshContext->SkeletalMeshConfig.bPerPolyCollision);
 #else
@@ -372,6 +413,75 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		LOD->bHasNormals = true;
 		LOD->bHasVertexColors = false;
 
+		if (SkeletalMeshContext->SkeletalMeshConfig.bOptimizeVertexCache)
+		{
+			TArray<FglTFRuntimeVertexCacheStats> PrimitivesStatsBefore;
+			TArray<FglTFRuntimeVertexCacheStats> PrimitivesStatsAfter;
+			PrimitivesStatsBefore.AddDefaulted(LOD->Primitives.Num());
+			PrimitivesStatsAfter.AddDefaulted(LOD->Primitives.Num());
+
+			// only the triangles order of the context owned LOD is changed, the vertices keep their glTF order
+			ParallelFor(LOD->Primitives.Num(), [&](const int32 PrimitiveIndex)
+				{
+					FglTFRuntimePrimitive& Primitive = LOD->Primitives[PrimitiveIndex];
+					// merged primitives map their bones by index position
+					if (Primitive.OverrideBoneMap.Num() > 0)
+					{
+						return;
+					}
+
+					const int32 NumIndices = (Primitive.Indices.Num() / 3) * 3;
+					const int32 NumVertices = Primitive.Positions.Num();
+					for (int32 Index = 0; Index < NumIndices; Index++)
+					{
+						if (Primitive.Indices[Index] >= static_cast<uint32>(NumVertices))
+						{
+							return;
+						}
+					}
+
+					PrimitivesStatsBefore[PrimitiveIndex] = AnalyzeVertexCache(Primitive.Indices.GetData(), NumIndices, NumVertices);
+
+					OptimizeVertexCache(Primitive.Indices.GetData(), NumIndices, NumVertices);
+					if (SkeletalMeshContext->SkeletalMeshConfig.OverdrawOptimizationThreshold > 0)
+					{
+						OptimizeOverdraw(Primitive.Indices.GetData(), NumIndices, NumVertices, [&Primitive](const uint32 VertexIndex) -> FVector
+							{
+								return Primitive.Positions[VertexIndex];
+							}, SkeletalMeshContext->SkeletalMeshConfig.OverdrawOptimizationThreshold);
+					}
+
+					PrimitivesStatsAfter[PrimitiveIndex] = AnalyzeVertexCache(Primitive.Indices.GetData(), NumIndices, NumVertices);
+				});
+
+			FglTFRuntimeVertexCacheStats LODStatsBefore;
+			FglTFRuntimeVertexCacheStats LODStatsAfter;
+			for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
+			{
+				LODStatsBefore.Append(PrimitivesStatsBefore[PrimitiveIndex]);
+				LODStatsAfter.Append(PrimitivesStatsAfter[PrimitiveIndex]);
+			}
+
+			SkeletalMeshContext->VertexCacheStatsBefore.Append(LODStatsBefore);
+			SkeletalMeshContext->VertexCacheStatsAfter.Append(LODStatsAfter);
+
+			UE_LOG(LogGLTFRuntime, Log, TEXT("Optimized LOD vertex cache: ACMR %f -> %f ATVR %f -> %f"), LODStatsBefore.GetACMR(), LODStatsAfter.GetACMR(), LODStatsBefore.GetATVR(), LODStatsAfter.GetATVR());
+		}
+
+		// glTF requires flat normals when NORMAL is missing, so those triangles get their own vertices before generating them
+		if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy != EglTFRuntimeNormalsGenerationStrategy::Never)
+		{
+			ParallelFor(LOD->Primitives.Num(), [&](const int32 PrimitiveIndex)
+				{
+					FglTFRuntimePrimitive& Primitive = LOD->Primitives[PrimitiveIndex];
+					if (Primitive.Normals.Num() < Primitive.Positions.Num() && (Primitive.Indices.Num() % 3) == 0)
+					{
+						// out of range indices are reported below
+						UnweldPrimitive(Primitive);
+					}
+				});
+		}
+
 		FSkeletalMeshLODRenderData* LodRenderData = new FSkeletalMeshLODRenderData();
 		int32 LODIndex = SkeletalMeshContext->SkeletalMesh->GetResourceForRendering()->LODRenderData.Add(LodRenderData);
 
@@ -381,30 +491,37 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		bool bUseHighPrecisionWeights = false;
 
 		int32 NumIndices = 0;
-		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
-		{
-			NumIndices += LOD->Primitives[PrimitiveIndex].Indices.Num();
-			if (LOD->Primitives[PrimitiveIndex].bHighPrecisionUVs)
+		int32 NumVerticesToBuild = 0;
+		int32 NumUVs = 1;
+		LOD->bHasUV = LOD->Primitives.Num() > 0;
+		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
+		{
+			NumIndices += Primitive.Indices.Num();
+			NumVerticesToBuild += Primitive.Positions.Num();
+			const int32 NumPrimitiveUVs = FMath::Min<int32>(Primitive.UVs.Num(), MAX_TEXCOORDS);
+			if (NumPrimitiveUVs > NumUVs)
 			{
-				bUseHighPrecisionUVs = true;
+				NumUVs = NumPrimitiveUVs;
 			}
-			if (LOD->Primitives[PrimitiveIndex].bHighPrecisionWeights)
+			for (int32 UVIndex = 0; UVIndex < NumPrimitiveUVs; UVIndex++)
+			{
+				if (Primitive.IsHighPrecisionUVChannel(UVIndex) && (SkeletalMeshContext->SkeletalMeshConfig.HighPrecisionUVChannels.Num() == 0 || SkeletalMeshContext->SkeletalMeshConfig.HighPrecisionUVChannels.Contains(UVIndex)))
+				{
+					bUseHighPrecisionUVs = true;
+				}
+			}
+			if (Primitive.bHighPrecisionWeights)
 			{
 				bUseHighPrecisionWeights = true;
 			}
-			if (LOD->Primitives[PrimitiveIndex].Colors.Num() > 0)
+			if (Primitive.Colors.Num() > 0)
 			{
 				LOD->bHasVertexColors = true;
 			}
-		}
-
-		LodRenderData->StaticVertexBuffers.PositionVertexBuffer.Init(NumIndices);
-		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(bUseHighPrecisionUVs || SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionUVs);
-		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseHighPrecisionTangentBasis(SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionTangentBasis);
-		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumIndices, 1);
-		if (LOD->bHasVertexColors)
-		{
-			LodRenderData->StaticVertexBuffers.ColorVertexBuffer.Init(NumIndices);
+			if (Primitive.UVs.Num() == 0)
+			{
+				LOD->bHasUV = false;
+			}
 		}
 
 		int32 NumBones = RefSkeleton.GetNum();
@@ -415,23 +532,34 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			LodRenderData->ActiveBoneIndices.Add(BoneIndex);
 		}
 
+		// the glTF vertices are shared between triangles (like in the index buffer), every section owns a contiguous range of them
+		TArray<FStaticMeshBuildVertex> BuildVertices;
+		BuildVertices.AddUninitialized(NumVerticesToBuild);
+
 		TArray<FSkinWeightInfo> InWeights;
-		InWeights.AddZeroed(NumIndices);
+		InWeights.AddZeroed(NumVerticesToBuild);
+
+		TArray<uint32> LODIndices;
+		LODIndices.AddUninitialized(NumIndices);
 
-		int32 TotalVertexIndex = 0;
+		int32 BaseIndex = 0;
 		int32 Base = 0;
 		int32 MaxBoneInfluences = 4;
 
+		const bool bHasSkin = (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin && SkeletalMeshContext->SkinIndex > INDEX_NONE) || LOD->Skeleton.Num() > 0;
+
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
 		{
 			FglTFRuntimePrimitive& Primitive = LOD->Primitives[PrimitiveIndex];
+			const int32 NumPrimitiveVertices = Primitive.Positions.Num();
+			const int32 NumPrimitiveIndices = Primitive.Indices.Num();
 
 			new(&LodRenderData->RenderSections[PrimitiveIndex]) FSkelMeshRenderSection();
 			FSkelMeshRenderSection& MeshSection = LodRenderData->RenderSections[PrimitiveIndex];
 
 			MeshSection.MaterialIndex = PrimitiveIndex;
-			MeshSection.BaseIndex = TotalVertexIndex;
-			MeshSection.NumTriangles = Primitive.Indices.Num() / 3;
+			MeshSection.BaseIndex = BaseIndex;
+			MeshSection.NumTriangles = NumPrimitiveIndices / 3;
 			MeshSection.BaseVertexIndex = Base;
 			MeshSection.MaxBoneInfluences = FMath::Min(Primitive.Joints.Num() * 4, MAX_TOTAL_INFLUENCES);
 
@@ -440,379 +568,238 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 				MaxBoneInfluences = MeshSection.MaxBoneInfluences;
 			}
 
-			MeshSection.NumVertices = Primitive.Indices.Num();
-
-			Base += MeshSection.NumVertices;
+			for (int32 Index = 0; Index < NumPrimitiveIndices; Index++)
+			{
+				const uint32 VertexIndex = Primitive.Indices[Index];
+				if (VertexIndex >= static_cast<uint32>(NumPrimitiveVertices))
+				{
+					AddError("CreateSkeletalMeshFromLODs()", FString::Printf(TEXT("Invalid vertex index %u for primitive %d"), VertexIndex, PrimitiveIndex));
+					return nullptr;
+				}
+				LODIndices[BaseIndex + Index] = Base + VertexIndex;
+			}
 
-			TMap<int32, TArray<int32>> OverlappingVertices;
-			MeshSection.DuplicatedVerticesBuffer.Init(MeshSection.NumVertices, OverlappingVertices);
+			const bool bMissingNormals = Primitive.Normals.Num() < NumPrimitiveVertices;
+			const bool bMissingTangents = Primitive.Tangents.Num() < NumPrimitiveVertices;
 
-			// this is used for non-skinned asset loaded as skinned ones
-			int32 OverrideIndexToCheck = 0;
+			if (bMissingNormals)
+			{
+				LOD->bHasNormals = false;
+			}
 
-			for (int32 VertexIndex = 0; VertexIndex < Primitive.Indices.Num(); VertexIndex++)
+			if (bMissingTangents)
 			{
-				int32 Index = Primitive.Indices[VertexIndex];
-				FModelVertex ModelVertex;
+				LOD->bHasTangents = false;
+			}
 
-				float TangentXW = 1;
+			TMap<int32, FName>& BoneMapInUse = Primitive.OverrideBoneMap.Num() > 0 ? Primitive.OverrideBoneMap : MainBoneMap;
+			TMap<int32, int32>& BonesCacheInUse = Primitive.OverrideBoneMap.Num() > 0 ? Primitive.BonesCache : MainBonesCache;
 
-#if ENGINE_MAJOR_VERSION > 4
-				ModelVertex.Position = FVector3f(Primitive.Positions[Index]);
-				SkeletalMeshContext->BoundingBox += FVector(ModelVertex.Position) * SkeletalMeshContext->SkeletalMeshConfig.BoundsScale;
-				ModelVertex.TangentX = FVector3f::ZeroVector;
-				ModelVertex.TangentZ = FVector3f::ZeroVector;
-#else
-				ModelVertex.Position = Primitive.Positions[Index];
-				SkeletalMeshContext->BoundingBox += ModelVertex.Position * SkeletalMeshContext->SkeletalMeshConfig.BoundsScale;
-				ModelVertex.TangentX = FVector::ZeroVector;
-				ModelVertex.TangentZ = FVector::ZeroVector;
-#endif
-				if (Index < Primitive.Normals.Num())
-				{
-#if ENGINE_MAJOR_VERSION > 4
-					ModelVertex.TangentZ = FVector3f(FVector(Primitive.Normals[Index]));
-#else
-					ModelVertex.TangentZ = Primitive.Normals[Index];
-#endif
-				}
-				else
+			// resolve the bones in advance, so that the cache can be safely read while building the vertices
+			for (const TPair<int32, FName>& Pair : BoneMapInUse)
+			{
+				if (!BonesCacheInUse.Contains(Pair.Key))
 				{
-					LOD->bHasNormals = false;
+					BonesCacheInUse.Add(Pair.Key, RefSkeleton.FindBoneIndex(Pair.Value));
 				}
+			}
 
-				if (Index < Primitive.Tangents.Num())
-				{
-#if ENGINE_MAJOR_VERSION > 4
-					TangentXW = Primitive.Tangents[Index].W;
-					ModelVertex.TangentX = FVector4f(Primitive.Tangents[Index]);
-#else
-					ModelVertex.TangentX = Primitive.Tangents[Index];
-#endif
-				}
-				else
-				{
-					LOD->bHasTangents = false;
-				}
+			const int32 JointsNum = FMath::Min(Primitive.Joints.Num(), MeshSection.MaxBoneInfluences / 4);
+			std::atomic<int32> MissingJoint{ INDEX_NONE };
 
-				if (Primitive.UVs.Num() > 0 && Index < Primitive.UVs[0].Num())
+			ParallelFor(NumPrimitiveVertices, [&](const int32 VertexIndex)
 				{
+					FStaticMeshBuildVertex& Vertex = BuildVertices[Base + VertexIndex];
+
+					const FVector4 TangentX = VertexIndex < Primitive.Tangents.Num() ? Primitive.Tangents[VertexIndex] : FVector4(0, 0, 0, 1);
 
 #if ENGINE_MAJOR_VERSION > 4
-					ModelVertex.TexCoord = FVector2f(Primitive.UVs[0][Index]);
+					Vertex.Position = FVector3f(Primitive.Positions[VertexIndex]);
+					Vertex.TangentX = FVector3f(FVector(TangentX));
+					Vertex.TangentZ = VertexIndex < Primitive.Normals.Num() ? FVector3f(Primitive.Normals[VertexIndex]) : FVector3f::ZeroVector;
+					Vertex.TangentY = FVector3f(ComputeTangentYWithW(FVector(Vertex.TangentZ), FVector(Vertex.TangentX), TangentX.W * TangentsDirection));
 #else
-					ModelVertex.TexCoord = Primitive.UVs[0][Index];
+					Vertex.Position = Primitive.Positions[VertexIndex];
+					Vertex.TangentX = FVector(TangentX);
+					Vertex.TangentZ = VertexIndex < Primitive.Normals.Num() ? Primitive.Normals[VertexIndex] : FVector::ZeroVector;
+					Vertex.TangentY = ComputeTangentYWithW(Vertex.TangentZ, Vertex.TangentX, TangentX.W * TangentsDirection);
 #endif
-					LOD->bHasUV = true;
-				}
-				else
-				{
+
+					for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
+					{
+						// no UVs specified, let's set them to 0
+						if (UVIndex < Primitive.UVs.Num() && VertexIndex < Primitive.UVs[UVIndex].Num())
+						{
 #if ENGINE_MAJOR_VERSION > 4
-					ModelVertex.TexCoord = FVector2f::ZeroVector;
+							Vertex.UVs[UVIndex] = FVector2f(Primitive.UVs[UVIndex][VertexIndex]);
 #else
-					ModelVertex.TexCoord = FVector2D::ZeroVector;
+							Vertex.UVs[UVIndex] = Primitive.UVs[UVIndex][VertexIndex];
 #endif
-					LOD->bHasUV = false;
-				}
-
+						}
+						else
+						{
 #if ENGINE_MAJOR_VERSION > 4
-				FVector3f TangentY = FVector3f(ComputeTangentYWithW(FVector(ModelVertex.TangentZ), FVector(ModelVertex.TangentX), TangentXW * TangentsDirection));
+							Vertex.UVs[UVIndex] = FVector2f::ZeroVector;
 #else
-				FVector TangentY = ComputeTangentYWithW(ModelVertex.TangentZ, ModelVertex.TangentX, TangentXW * TangentsDirection);
+							Vertex.UVs[UVIndex] = FVector2D::ZeroVector;
 #endif
-				FColor Color = FColor::White;
-				if (Index < Primitive.Colors.Num())
-				{
-					Color = FLinearColor(Primitive.Colors[Index]).ToFColor(true);
-				}
-
-				LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(TotalVertexIndex) = ModelVertex.Position;
-				LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(TotalVertexIndex, ModelVertex.TangentX, TangentY, ModelVertex.TangentZ);
-				LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexUV(TotalVertexIndex, 0, ModelVertex.TexCoord);
-				if (LOD->bHasVertexColors)
-				{
-					LodRenderData->StaticVertexBuffers.ColorVertexBuffer.VertexColor(TotalVertexIndex) = Color;
-				}
+						}
+					}
+					Vertex.Color = VertexIndex < Primitive.Colors.Num() ? FLinearColor(Primitive.Colors[VertexIndex]).ToFColor(true) : FColor::White;
 
-				TMap<int32, FName>& BoneMapInUse = Primitive.OverrideBoneMap.Num() > 0 ? Primitive.OverrideBoneMap : MainBoneMap;
-				TMap<int32, int32>& BonesCacheInUse = Primitive.OverrideBoneMap.Num() > 0 ? Primitive.BonesCache : MainBonesCache;
+					FSkinWeightInfo& SkinWeightInfo = InWeights[Base + VertexIndex];
 
-				if ((!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin && SkeletalMeshContext->SkinIndex > INDEX_NONE) || LOD->Skeleton.Num() > 0)
-				{
-					uint32 TotalWeight = 0;
-					const int32 JointsNum = FMath::Min(Primitive.Joints.Num(), MeshSection.MaxBoneInfluences / 4);
-					for (int32 JointsIndex = 0; JointsIndex < JointsNum; JointsIndex++)
+					if (bHasSkin)
 					{
-						const FglTFRuntimeUInt16Vector4& Joints = Primitive.Joints[JointsIndex][Index];
-						const FVector4& Weights = Primitive.Weights[JointsIndex][Index];
-						for (int32 j = 0; j < 4; j++)
+						uint32 TotalWeight = 0;
+						for (int32 JointsIndex = 0; JointsIndex < JointsNum; JointsIndex++)
 						{
-							if (BoneMapInUse.Contains(Joints[j]))
+							const FglTFRuntimeUInt16Vector4& Joints = Primitive.Joints[JointsIndex][VertexIndex];
+							const FVector4& Weights = Primitive.Weights[JointsIndex][VertexIndex];
+							for (int32 j = 0; j < 4; j++)
 							{
-								int32 BoneIndex = INDEX_NONE;
-								if (BonesCacheInUse.Contains(Joints[j]))
-								{
-									BoneIndex = BonesCacheInUse[Joints[j]];
-								}
-								else
+								if (const int32* BoneIndex = BonesCacheInUse.Find(Joints[j]))
 								{
-									BoneIndex = RefSkeleton.FindBoneIndex(BoneMapInUse[Joints[j]]);
-									BonesCacheInUse.Add(Joints[j], BoneIndex);
-								}
+									BONE_INFLUENCE_TYPE QuantizedWeight = FMath::Clamp((BONE_INFLUENCE_TYPE)(Weights[j] * ((double)MAX_BONE_INFLUENCE_WEIGHT)), (BONE_INFLUENCE_TYPE)0x00, (BONE_INFLUENCE_TYPE)MAX_BONE_INFLUENCE_WEIGHT);
+
+									if (QuantizedWeight + TotalWeight > MAX_BONE_INFLUENCE_WEIGHT)
+									{
+										QuantizedWeight = MAX_BONE_INFLUENCE_WEIGHT - TotalWeight;
+									}
 
-								BONE_INFLUENCE_TYPE QuantizedWeight = FMath::Clamp((BONE_INFLUENCE_TYPE)(Weights[j] * ((double)MAX_BONE_INFLUENCE_WEIGHT)), (BONE_INFLUENCE_TYPE)0x00, (BONE_INFLUENCE_TYPE)MAX_BONE_INFLUENCE_WEIGHT);
+									SkinWeightInfo.InfluenceWeights[JointsIndex * 4 + j] = QuantizedWeight;
+									SkinWeightInfo.InfluenceBones[JointsIndex * 4 + j] = *BoneIndex;
 
-								if (QuantizedWeight + TotalWeight > MAX_BONE_INFLUENCE_WEIGHT)
+									TotalWeight += QuantizedWeight;
+								}
+								else if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreMissingBones)
 								{
-									QuantizedWeight = MAX_BONE_INFLUENCE_WEIGHT - TotalWeight;
+									MissingJoint = Joints[j];
 								}
-
-								InWeights[TotalVertexIndex].InfluenceWeights[JointsIndex * 4 + j] = QuantizedWeight;
-								InWeights[TotalVertexIndex].InfluenceBones[JointsIndex * 4 + j] = BoneIndex;
-
-								TotalWeight += QuantizedWeight;
-							}
-							else if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreMissingBones)
-							{
-								AddError("LoadSkeletalMesh_Internal()", FString::Printf(TEXT("Unable to find map for bone %u"), Joints[j]));
-								return nullptr;
 							}
 						}
-					}
 
-					// fix weight
-					if (TotalWeight < MAX_BONE_INFLUENCE_WEIGHT)
-					{
-						InWeights[TotalVertexIndex].InfluenceWeights[0] += MAX_BONE_INFLUENCE_WEIGHT - TotalWeight;
+						// fix weight
+						if (TotalWeight < MAX_BONE_INFLUENCE_WEIGHT)
+						{
+							SkinWeightInfo.InfluenceWeights[0] += MAX_BONE_INFLUENCE_WEIGHT - TotalWeight;
+						}
 					}
-				}
-				else if (SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.bFallbackToNodesTree)
-				{
-					if (BoneMapInUse.Contains(VertexIndex))
+					else if (!SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.bFallbackToNodesTree)
 					{
-						OverrideIndexToCheck = VertexIndex;
+						SkinWeightInfo.InfluenceWeights[0] = MAX_BONE_INFLUENCE_WEIGHT;
 					}
-					if (BoneMapInUse.Contains(OverrideIndexToCheck))
+				});
+
+			if (MissingJoint != INDEX_NONE)
+			{
+				AddError("LoadSkeletalMesh_Internal()", FString::Printf(TEXT("Unable to find map for bone %d"), MissingJoint.load()));
+				return nullptr;
+			}
+
+			if (!bHasSkin)
+			{
+				// this is used for non-skinned asset loaded as skinned ones (the bone map keys are the first index of each merged primitive)
+				if (SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.bFallbackToNodesTree)
+				{
+					int32 OverrideIndexToCheck = 0;
+					for (int32 Index = 0; Index < NumPrimitiveIndices; Index++)
 					{
-						int32 BoneIndex = INDEX_NONE;
-						if (BonesCacheInUse.Contains(OverrideIndexToCheck))
+						if (BoneMapInUse.Contains(Index))
 						{
-							BoneIndex = BonesCacheInUse[OverrideIndexToCheck];
+							OverrideIndexToCheck = Index;
 						}
-						else
+						if (const int32* BoneIndex = BonesCacheInUse.Find(OverrideIndexToCheck))
 						{
-							BoneIndex = RefSkeleton.FindBoneIndex(BoneMapInUse[OverrideIndexToCheck]);
-							BonesCacheInUse.Add(OverrideIndexToCheck, BoneIndex);
+							FSkinWeightInfo& SkinWeightInfo = InWeights[LODIndices[BaseIndex + Index]];
+							SkinWeightInfo.InfluenceWeights[0] = MAX_BONE_INFLUENCE_WEIGHT;
+							SkinWeightInfo.InfluenceBones[0] = *BoneIndex;
+						}
+						else if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreMissingBones)
+						{
+							AddError("LoadSkeletalMesh_Internal()", "Unable to find map for node based bones");
+							return nullptr;
 						}
-						InWeights[TotalVertexIndex].InfluenceWeights[0] = MAX_BONE_INFLUENCE_WEIGHT;
-						InWeights[TotalVertexIndex].InfluenceBones[0] = BoneIndex;
-						InWeights[TotalVertexIndex].InfluenceWeights[1] = 0;
-						InWeights[TotalVertexIndex].InfluenceBones[1] = 0;
-						InWeights[TotalVertexIndex].InfluenceWeights[2] = 0;
-						InWeights[TotalVertexIndex].InfluenceBones[2] = 0;
-						InWeights[TotalVertexIndex].InfluenceWeights[3] = 0;
-						InWeights[TotalVertexIndex].InfluenceBones[3] = 0;
-
-						MeshSection.MaxBoneInfluences = 1;
-					}
-					else if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreMissingBones)
-					{
-						AddError("LoadSkeletalMesh_Internal()", "Unable to find map for node based bones");
-						return nullptr;
-					}
-				}
-				else
-				{
-					// reset it to be meaningful
-					MeshSection.MaxBoneInfluences = 1;
-					for (int32 j = 0; j < MeshSection.MaxBoneInfluences; j++)
-					{
-						InWeights[TotalVertexIndex].InfluenceWeights[j] = j == 0 ? MAX_BONE_INFLUENCE_WEIGHT : 0;
-						InWeights[TotalVertexIndex].InfluenceBones[j] = 0;
 					}
 				}
 
-				TotalVertexIndex++;
+				// reset it to be meaningful
+				MeshSection.MaxBoneInfluences = 1;
+			}
+
+			const EglTFRuntimeNormalsGenerationStrategy NormalsGenerationStrategy = SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy;
+			const EglTFRuntimeTangentsGenerationStrategy TangentsGenerationStrategy = SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy;
+			const bool bGenerateNormals = NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always || (bMissingNormals && NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing);
+			// without uvs the tangents are just built perpendicular to the normals
+			const bool bGenerateTangents = TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always || (bMissingTangents && TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::IfMissing);
+
+			if ((bGenerateNormals || bGenerateTangents) && (NumPrimitiveIndices % 3) == 0)
+			{
+				GenerateNormalsAndTangents(BuildVertices, Base, NumPrimitiveVertices, LODIndices, BaseIndex, NumPrimitiveIndices, bGenerateNormals, bGenerateTangents, TangentsDirection);
 			}
 
+			// welding runs on the final normals (like for static meshes), so the flat ones are preserved
+			int32 NumSectionVertices = NumPrimitiveVertices;
+			// morph target deltas are mapped to the glTF vertices, so those primitives are never welded
+			if (SkeletalMeshContext->SkeletalMeshConfig.bWeldVertices && (Primitive.MorphTargets.Num() == 0 || SkeletalMeshContext->SkeletalMeshConfig.bDisableMorphTargets))
+			{
+				NumSectionVertices = WeldVertices(BuildVertices, Base, NumPrimitiveVertices, LODIndices, BaseIndex, NumPrimitiveIndices, NumUVs, LOD->bHasVertexColors, SkeletalMeshContext->SkeletalMeshConfig.WeldVerticesTolerance, &InWeights);
+				SkeletalMeshContext->NumVerticesBeforeWelding += NumPrimitiveVertices;
+				SkeletalMeshContext->NumVerticesAfterWelding += NumSectionVertices;
+			}
+
+			MeshSection.NumVertices = NumSectionVertices;
+
+			TMap<int32, TArray<int32>> OverlappingVertices;
+			MeshSection.DuplicatedVerticesBuffer.Init(MeshSection.NumVertices, OverlappingVertices);
+
 			for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
 			{
 				MeshSection.BoneMap.Add(BoneIndex);
 			}
-		}
 
-		if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always)
-		{
-			LOD->bHasNormals = false;
-		}
-		else if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Never)
-		{
-			LOD->bHasNormals = true;
+			BaseIndex += NumPrimitiveIndices;
+			Base += NumSectionVertices;
 		}
 
-		if (SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always)
-		{
-			LOD->bHasTangents = false;
-		}
-		else if (SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Never)
+		const int32 NumVertices = Base;
+		if (NumVertices < NumVerticesToBuild)
 		{
-			LOD->bHasTangents = true;
+			UE_LOG(LogGLTFRuntime, Log, TEXT("Welded LOD %d vertices: %d -> %d"), LODIndex, NumVerticesToBuild, NumVertices);
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+			InWeights.RemoveAt(NumVertices, NumVerticesToBuild - NumVertices, EAllowShrinking::Yes);
+#else
+			InWeights.RemoveAt(NumVertices, NumVerticesToBuild - NumVertices, true);
+#endif
 		}
 
-		if ((!LOD->bHasTangents || !LOD->bHasNormals) && TotalVertexIndex % 3 == 0)
+		LodRenderData->StaticVertexBuffers.PositionVertexBuffer.Init(NumVertices);
+		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(bUseHighPrecisionUVs || SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionUVs);
+		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseHighPrecisionTangentBasis(SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionTangentBasis);
+		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumVertices, NumUVs);
+		if (LOD->bHasVertexColors)
 		{
+			LodRenderData->StaticVertexBuffers.ColorVertexBuffer.Init(NumVertices);
+		}
 
-			//normals with NaNs are incorrectly handled on Android
-			auto FixVectorIfNan = [](FVector& Tangent, int32 Index)
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				const FStaticMeshBuildVertex& Vertex = BuildVertices[VertexIndex];
+				LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex) = Vertex.Position;
+				LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, Vertex.TangentX, Vertex.TangentY, Vertex.TangentZ);
+				for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
 				{
-					if (Tangent.ContainsNaN() && Index >= 0 && Index < 3)
-					{
-						Tangent.Set(0.0, 0.0, 0.0);
-						Tangent[Index] = 1.0;
-					}
-				};
-
-			ParallelFor(TotalVertexIndex / 3, [&](const int32 VertexTriangleIndex)
+					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexUV(VertexIndex, UVIndex, Vertex.UVs[UVIndex]);
+				}
+				if (LOD->bHasVertexColors)
 				{
+					LodRenderData->StaticVertexBuffers.ColorVertexBuffer.VertexColor(VertexIndex) = Vertex.Color;
+				}
+			});
 
-					const int32 VertexIndex = VertexTriangleIndex * 3;
-
-#if ENGINE_MAJOR_VERSION > 4
-					FVector Position0 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex));
-					FVector4 TangentZ0 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex));
-#else
-					FVector Position0 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex);
-					FVector4 TangentZ0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex);
-#endif
-
-
-#if ENGINE_MAJOR_VERSION > 4
-					FVector Position1 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex + 1));
-					FVector4 TangentZ1 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex + 1));
-#else
-					FVector Position1 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex + 1);
-					FVector4 TangentZ1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex + 1);
-#endif
-
-
-#if ENGINE_MAJOR_VERSION > 4
-					FVector Position2 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex + 2));
-					FVector4 TangentZ2 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex + 2));
-#else
-					FVector Position2 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex + 2);
-					FVector4 TangentZ2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex + 2);
-#endif
-
-					if (!LOD->bHasNormals)
-					{
-						const FVector SideA = Position1 - Position0;
-						const FVector SideB = Position2 - Position0;
-
-						const FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-						TangentZ0 = NormalFromCross;
-						TangentZ1 = NormalFromCross;
-						TangentZ2 = NormalFromCross;
-					}
-
-					// if we do not have tangents but we have normals and a UV channel, we can compute them
-					if (!LOD->bHasTangents)
-					{
-						const FVector DeltaPosition0 = Position1 - Position0;
-						const FVector DeltaPosition1 = Position2 - Position0;
-
-						FVector TangentX0;
-						FVector TangentX1;
-						FVector TangentX2;
-
-						if (LOD->bHasUV)
-						{
-#if ENGINE_MAJOR_VERSION > 4
-							const FVector2f& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex, 0);
-							const FVector2f& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex + 1, 0);
-							const FVector2f& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex + 2, 0);
-							const FVector2f DeltaUV0 = UV1 - UV0;
-							const FVector2f DeltaUV1 = UV2 - UV0;
-#else
-							const FVector2D& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex, 0);
-							const FVector2D& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex + 1, 0);
-							const FVector2D& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex + 2, 0);
-							const FVector2D DeltaUV0 = UV1 - UV0;
-							const FVector2D DeltaUV1 = UV2 - UV0;
-#endif
-
-							const float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
-
-							const FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-							const FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
-
-							TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-							TangentX0.Normalize();
-
-							TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-							TangentX1.Normalize();
-
-							TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-							TangentX2.Normalize();
-						}
-						else
-						{
-							TangentX0 = FVector::CrossProduct(TangentZ0, FVector::UpVector);
-							TangentX1 = FVector::CrossProduct(TangentZ1, FVector::UpVector);
-							TangentX2 = FVector::CrossProduct(TangentZ2, FVector::UpVector);
-						}
-
-#if PLATFORM_ANDROID
-						FixVectorIfNan(TangentX0, 0);
-						FixVectorIfNan(TangentX1, 0);
-						FixVectorIfNan(TangentX2, 0);
-#endif
-
-						FVector TangentY0 = ComputeTangentY(TangentZ0, TangentX0) * TangentsDirection;
-						FVector TangentY1 = ComputeTangentY(TangentZ1, TangentX1) * TangentsDirection;
-						FVector TangentY2 = ComputeTangentY(TangentZ2, TangentX2) * TangentsDirection;
-#if PLATFORM_ANDROID
-						FixVectorIfNan(TangentY0, 1);
-						FixVectorIfNan(TangentY1, 1);
-						FixVectorIfNan(TangentY2, 1);
-#endif
-
-
-#if ENGINE_MAJOR_VERSION > 4
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, FVector3f(TangentX0), FVector3f(TangentY0), FVector3f(FVector(TangentZ0)));
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 1, FVector3f(TangentX1), FVector3f(TangentY1), FVector3f(FVector(TangentZ1)));
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, FVector3f(TangentX2), FVector3f(TangentY2), FVector3f(FVector(TangentZ2)));
-#else
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX0, TangentY0, TangentZ0);
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 1, TangentX1, TangentY1, TangentZ1);
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, TangentX2, TangentY2, TangentZ2);
-#endif
-					}
-					else if (!LOD->bHasNormals) // if we are here we need to reapply normals
-					{
-#if ENGINE_MAJOR_VERSION > 4
-						FVector4f TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
-						FVector4f TangentX1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex + 1);
-						FVector4f TangentX2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex + 2);
-						FVector3f TangentY0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex);
-						FVector3f TangentY1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex + 1);
-						FVector3f TangentY2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex + 2);
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX0, TangentY0, FVector4f(TangentZ0));
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 1, TangentX1, TangentY1, FVector4f(TangentZ1));
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, TangentX2, TangentY2, FVector4f(TangentZ2));
-#else
-						FVector4 TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
-						FVector4 TangentX1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex + 1);
-						FVector4 TangentX2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex + 2);
-						FVector TangentY0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex);
-						FVector TangentY1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex + 1);
-						FVector TangentY2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex + 2);
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX0, TangentY0, TangentZ0);
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 1, TangentX1, TangentY1, TangentZ1);
-						LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, TangentX2, TangentY2, TangentZ2);
-#endif
-					}
-				});
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			SkeletalMeshContext->BoundingBox += FVector(BuildVertices[VertexIndex].Position) * SkeletalMeshContext->SkeletalMeshConfig.BoundsScale;
 		}
 
 		LodRenderData->SkinWeightVertexBuffer.SetNeedsCPUAccess(SkeletalMeshContext->SkeletalMeshConfig.bPerPolyCollision || SkeletalMeshContext->SkeletalMeshConfig.bAllowCPUAccess);
@@ -836,12 +823,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 		LodRenderData->SkinWeightVertexBuffer = InWeights;
 #endif
-		LodRenderData->MultiSizeIndexContainer.CreateIndexBuffer(NumIndices > MAX_uint16 ? sizeof(uint32) : sizeof(uint16));
-
-		for (int32 Index = 0; Index < NumIndices; Index++)
-		{
-			LodRenderData->MultiSizeIndexContainer.GetIndexBuffer()->AddItem(Index);
-		}
+		LodRenderData->MultiSizeIndexContainer.RebuildIndexBuffer(NumVertices > MAX_uint16 ? sizeof(uint32) : sizeof(uint16), LODIndices);
 	}
 
 	FillAssetUserData(SkeletalMeshContext->MeshIndex, SkeletalMeshContext->SkeletalMesh);
@@ -849,15 +831,39 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 	return SkeletalMeshContext->SkeletalMesh;
 }
 
+TArray<FglTFRuntimeFinalizationStep> FglTFRuntimeParser::GetSkeletalMeshFinalizationSteps(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
+{
+	TArray<FglTFRuntimeFinalizationStep> Steps;
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeSkeletalMeshLODs"), [SkeletalMeshContext]() { SkeletalMeshContext->Parser->FinalizeSkeletalMeshLODs(SkeletalMeshContext); });
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeSkeletalMeshMorphTargets"), [SkeletalMeshContext]() { SkeletalMeshContext->Parser->FinalizeSkeletalMeshMorphTargets(SkeletalMeshContext); });
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeSkeletalMeshPhysicsAsset"), [SkeletalMeshContext]() { SkeletalMeshContext->Parser->FinalizeSkeletalMeshPhysicsAsset(SkeletalMeshContext); });
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeSkeletalMeshResources"), [SkeletalMeshContext]() { SkeletalMeshContext->Parser->FinalizeSkeletalMeshResources(SkeletalMeshContext); });
+	return Steps;
+}
+
 USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
 {
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeSkeletalMeshWithLODs, FColor::Magenta);
+
+	for (FglTFRuntimeFinalizationStep& Step : GetSkeletalMeshFinalizationSteps(SkeletalMeshContext))
+	{
+		Step.Function();
+	}
+
+	return SkeletalMeshContext->SkeletalMesh;
+}
+
+void FglTFRuntimeParser::FinalizeSkeletalMeshLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeSkeletalMeshLODs, FColor::Magenta);
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizeSkeletalMeshLODs);
 
 #if WITH_EDITOR
 	FSkeletalMeshModel* ImportedResource = SkeletalMeshContext->SkeletalMesh->GetImportedModel();
 	ImportedResource->LODModels.Empty();
 #endif
 
-	bool bHasMorphTargets = false;
+	SkeletalMeshContext->bHasMorphTargets = false;
 	int32 MorphTargetIndex = 0;
 
 	bool bHasVertexColors = false;
@@ -920,59 +926,75 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 			TMap<FString, UMorphTarget*> MorphTargetNamesHistory;
 			TMap<FString, int32> MorphTargetNamesDuplicateCounter;
 
-			int32 BaseIndex = 0;
+			const TArray<FSkelMeshRenderSection>& RenderSections = SkeletalMeshContext->SkeletalMesh->GetResourceForRendering()->LODRenderData[LODIndex].RenderSections;
 
 			for (int32 PrimitiveIndex = 0; PrimitiveIndex < SkeletalMeshContext->LODs[LODIndex]->Primitives.Num(); PrimitiveIndex++)
 			{
 
 				FglTFRuntimePrimitive& Primitive = SkeletalMeshContext->LODs[LODIndex]->Primitives[PrimitiveIndex];
 
-				for (FglTFRuntimeMorphTarget& MorphTargetData : Primitive.MorphTargets)
-				{
-					bool bSkip = true;
-					FMorphTargetLODModel MorphTargetLODModel;
-					MorphTargetLODModel.NumBaseMeshVerts = Primitive.Indices.Num();
-					MorphTargetLODModel.SectionIndices.Add(PrimitiveIndex);
+				// primitives with morph targets are never welded, so render vertices match the glTF ones
+				const int32 BaseVertexIndex = RenderSections[PrimitiveIndex].BaseVertexIndex;
+				const int32 NumSectionVertices = RenderSections[PrimitiveIndex].NumVertices;
+
+				// deltas are built in parallel (one task per morph target), only the UMorphTarget registration is serial
+				TArray<FMorphTargetLODModel> MorphTargetLODModels;
+				MorphTargetLODModels.AddDefaulted(Primitive.MorphTargets.Num());
 
-					for (int32 Index = 0; Index < Primitive.Indices.Num(); Index++)
+				ParallelFor(Primitive.MorphTargets.Num(), [&](const int32 MorphTargetDataIndex)
 					{
-						FMorphTargetDelta Delta;
-						int32 VertexIndex = Primitive.Indices[Index];
-						if (VertexIndex < MorphTargetData.Positions.Num())
-						{
-#if ENGINE_MAJOR_VERSION > 4
-							Delta.PositionDelta = FVector3f(MorphTargetData.Positions[VertexIndex]);
-#else
-							Delta.PositionDelta = MorphTargetData.Positions[VertexIndex];
-#endif
-						}
-						else
+						const FglTFRuntimeMorphTarget& MorphTargetData = Primitive.MorphTargets[MorphTargetDataIndex];
+						FMorphTargetLODModel& MorphTargetLODModel = MorphTargetLODModels[MorphTargetDataIndex];
+						MorphTargetLODModel.NumBaseMeshVerts = NumSectionVertices;
+						MorphTargetLODModel.SectionIndices.Add(PrimitiveIndex);
+
+						const int32 NumVertices = FMath::Min(FMath::Max(MorphTargetData.Positions.Num(), MorphTargetData.Normals.Num()), NumSectionVertices);
+						TBitArray<> NonZeroVertices(false, NumVertices);
+						int32 NumDeltas = 0;
+						for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
 						{
-#if ENGINE_MAJOR_VERSION > 4
-							Delta.PositionDelta = FVector3f::ZeroVector;
-#else
-							Delta.PositionDelta = FVector::ZeroVector;
-#endif
+							const bool bHasPositionDelta = MorphTargetData.Positions.IsValidIndex(VertexIndex) && !MorphTargetData.Positions[VertexIndex].IsNearlyZero();
+							const bool bHasNormalDelta = MorphTargetData.Normals.IsValidIndex(VertexIndex) && !MorphTargetData.Normals[VertexIndex].IsNearlyZero();
+							NonZeroVertices[VertexIndex] = bHasPositionDelta || bHasNormalDelta;
+							if (NonZeroVertices[VertexIndex])
+							{
+								NumDeltas++;
+							}
 						}
 
-						if (!Delta.PositionDelta.IsNearlyZero())
+						MorphTargetLODModel.Vertices.Reserve(NumDeltas);
+
+						for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
 						{
-							bSkip = false;
-						}
+							if (!NonZeroVertices[VertexIndex])
+							{
+								continue;
+							}
 
-						Delta.SourceIdx = BaseIndex + Index;
+							FMorphTargetDelta& Delta = MorphTargetLODModel.Vertices.AddDefaulted_GetRef();
 #if ENGINE_MAJOR_VERSION > 4
-						Delta.TangentZDelta = FVector3f::ZeroVector;
+							Delta.PositionDelta = MorphTargetData.Positions.IsValidIndex(VertexIndex) ? FVector3f(MorphTargetData.Positions[VertexIndex]) : FVector3f::ZeroVector;
+							Delta.TangentZDelta = MorphTargetData.Normals.IsValidIndex(VertexIndex) ? FVector3f(MorphTargetData.Normals[VertexIndex]) : FVector3f::ZeroVector;
 #else
-						Delta.TangentZDelta = FVector::ZeroVector;
+							Delta.PositionDelta = MorphTargetData.Positions.IsValidIndex(VertexIndex) ? MorphTargetData.Positions[VertexIndex] : FVector::ZeroVector;
+							Delta.TangentZDelta = MorphTargetData.Normals.IsValidIndex(VertexIndex) ? MorphTargetData.Normals[VertexIndex] : FVector::ZeroVector;
 #endif
-						MorphTargetLODModel.Vertices.Add(Delta);
+							Delta.SourceIdx = BaseVertexIndex + VertexIndex;
+						}
 #if ENGINE_MAJOR_VERSION > 4
 						MorphTargetLODModel.NumVertices = MorphTargetLODModel.Vertices.Num();
 #endif
-					}
+					});
 
-					if (SkeletalMeshContext->SkeletalMeshConfig.bIgnoreEmptyMorphTargets && bSkip)
+				for (int32 MorphTargetDataIndex = 0; MorphTargetDataIndex < Primitive.MorphTargets.Num(); MorphTargetDataIndex++)
+				{
+					const FglTFRuntimeMorphTarget& MorphTargetData = Primitive.MorphTargets[MorphTargetDataIndex];
+					FMorphTargetLODModel& MorphTargetLODModel = MorphTargetLODModels[MorphTargetDataIndex];
+
+					SkeletalMeshContext->NumMorphTargetDeltas += MorphTargetLODModel.Vertices.Num();
+					SkeletalMeshContext->NumDroppedMorphTargetDeltas += NumSectionVertices - MorphTargetLODModel.Vertices.Num();
+
+					if (SkeletalMeshContext->SkeletalMeshConfig.bIgnoreEmptyMorphTargets && MorphTargetLODModel.Vertices.Num() == 0)
 					{
 						continue;
 					}
@@ -1043,18 +1065,17 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 					{
 						UMorphTarget* MorphTarget = NewObject<UMorphTarget>(SkeletalMeshContext->SkeletalMesh, *MorphTargetName, RF_Public);
 #if ENGINE_MAJOR_VERSION > 4
-						MorphTarget->GetMorphLODModels().Add(MorphTargetLODModel);
+						MorphTarget->GetMorphLODModels().Add(MoveTemp(MorphTargetLODModel));
 #else
-						MorphTarget->MorphLODModels.Add(MorphTargetLODModel);
+						MorphTarget->MorphLODModels.Add(MoveTemp(MorphTargetLODModel));
 #endif
 						SkeletalMeshContext->SkeletalMesh->RegisterMorphTarget(MorphTarget, false);
 						MorphTargetNamesHistory.Add(MorphTargetName, MorphTarget);
-						bHasMorphTargets = true;
+						SkeletalMeshContext->bHasMorphTargets = true;
 					}
 
 					MorphTargetIndex++;
 				}
-				BaseIndex += Primitive.Indices.Num();
 			}
 		}
 
@@ -1141,12 +1162,22 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 	}
 	else
 	{
-		if (CanReadFromCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletalMeshContext->SkinIndex > -1 && SkeletonsCache.Contains(SkeletalMeshContext->SkinIndex))
+		USkeleton* CachedSkeleton = nullptr;
+		if (CanReadFromCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletalMeshContext->SkinIndex > -1)
+		{
+			FScopeLock Lock(&MeshesCacheLock);
+			if (SkeletonsCache.Contains(SkeletalMeshContext->SkinIndex))
+			{
+				CachedSkeleton = SkeletonsCache[SkeletalMeshContext->SkinIndex];
+			}
+		}
+
+		if (CachedSkeleton)
 		{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			SkeletalMeshContext->SkeletalMesh->SetSkeleton(SkeletonsCache[SkeletalMeshContext->SkinIndex]);
+			SkeletalMeshContext->SkeletalMesh->SetSkeleton(CachedSkeleton);
 #else
-			SkeletalMeshContext->SkeletalMesh->Skeleton = SkeletonsCache[SkeletalMeshContext->SkinIndex];
+			SkeletalMeshContext->SkeletalMesh->Skeleton = CachedSkeleton;
 #endif
 		}
 		else
@@ -1161,6 +1192,7 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 
 			if (CanWriteToCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletalMeshContext->SkinIndex > -1)
 			{
+				FScopeLock Lock(&MeshesCacheLock);
 				SkeletonsCache.Add(SkeletalMeshContext->SkinIndex, SkeletalMeshContext->GetSkeleton());
 			}
 
@@ -1181,21 +1213,38 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 			SkeletalMeshContext->GetSkeleton()->Sockets.Add(SkeletalSocket);
 		}
 	}
+}
+
+void FglTFRuntimeParser::FinalizeSkeletalMeshMorphTargets(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeSkeletalMeshMorphTargets, FColor::Magenta);
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizeSkeletalMeshMorphTargets);
 
-	if (bHasMorphTargets)
+	if (SkeletalMeshContext->bHasMorphTargets)
 	{
+		UE_LOG(LogGLTFRuntime, Log, TEXT("Built %d morph target deltas (%d zero deltas dropped)"), SkeletalMeshContext->NumMorphTargetDeltas, SkeletalMeshContext->NumDroppedMorphTargetDeltas);
 		SkeletalMeshContext->SkeletalMesh->InitMorphTargets();
 	}
+}
+
+void FglTFRuntimeParser::FinalizeSkeletalMeshPhysicsAsset(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeSkeletalMeshPhysicsAsset, FColor::Magenta);
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizeSkeletalMeshPhysicsAsset);
 
 	GeneratePhysicsAsset_Internal(SkeletalMeshContext);
+}
+
+void FglTFRuntimeParser::FinalizeSkeletalMeshResources(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeSkeletalMeshResources, FColor::Magenta);
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizeSkeletalMeshResources);
 
 	SkeletalMeshContext->SkeletalMesh->InitResources();
 
 	SkeletalMeshContext->SkeletalMesh->RebuildSocketMap();
 
 	OnSkeletalMeshCreated.Broadcast(SkeletalMeshContext->SkeletalMesh);
-
-	return SkeletalMeshContext->SkeletalMesh;
 }
 
 void FglTFRuntimeParser::GeneratePhysicsAsset_Internal(FglTFRuntimeSkeletalMeshContextRef SkeletalMeshContext)
@@ -1633,9 +1682,13 @@ void FglTFRuntimeParser::GeneratePhysicsAsset_Internal(FglTFRuntimeSkeletalMeshC
 USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
 {
 	// first check cache
-	if (CanReadFromCache(SkeletalMeshConfig.CacheMode) && SkeletalMeshesCache.Contains(MeshIndex))
+	if (CanReadFromCache(SkeletalMeshConfig.CacheMode))
 	{
-		return SkeletalMeshesCache[MeshIndex];
+		FScopeLock Lock(&MeshesCacheLock);
+		if (SkeletalMeshesCache.Contains(MeshIndex))
+		{
+			return SkeletalMeshesCache[MeshIndex];
+		}
 	}
 
 	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
@@ -1670,6 +1723,7 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const
 
 	if (CanWriteToCache(SkeletalMeshConfig.CacheMode))
 	{
+		FScopeLock Lock(&MeshesCacheLock);
 		SkeletalMeshesCache.Add(MeshIndex, SkeletalMesh);
 	}
 
@@ -1681,7 +1735,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(SkeletalMeshConfig.AsyncPriority, SkeletalMeshContext->CancellationFlag, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 
@@ -1701,6 +1755,9 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 			SkeletalMeshContext->LODs.Add(LOD);
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
+		}, [SkeletalMeshContext, AsyncCallback]()
+		{
+			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 		});
 }
 
@@ -1761,7 +1818,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName,
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, SkeletalMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(SkeletalMeshConfig.AsyncPriority, SkeletalMeshContext->CancellationFlag, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 			// ensure to cache it as the finalizer requires LOD access
@@ -1776,6 +1833,9 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName,
 			SkeletalMeshContext->LODs.Add(&CombinedLOD);
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
+		}, [SkeletalMeshContext, AsyncCallback]()
+		{
+			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 		});
 }
 
@@ -2101,7 +2161,7 @@ UAnimSequence* FglTFRuntimeParser::LoadSkeletalAnimationFromTracksAndMorphTarget
 
 
 #if !WITH_EDITOR
-	UglTFAnimBoneCompressionCodec* CompressionCodec = NewObject<UglTFAnimBoneCompressionCodec>();
+	UglTFAnimBoneCompressionCodec* CompressionCodec = glTFRuntime::CreateBoneCompressionCodec(SkeletalAnimationConfig);
 	CompressionCodec->Tracks.AddDefaulted(BonesPoses.Num());
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
@@ -2340,6 +2400,7 @@ UAnimSequence* FglTFRuntimeParser::LoadSkeletalAnimationFromTracksAndMorphTarget
 	AnimSequence->PostProcessSequence();
 #endif
 #else
+	glTFRuntime::CompressBoneTracks(CompressionCodec, NumFrames, SkeletalAnimationConfig);
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
 		AnimSequence->CompressedData.CompressedDataStructure = MakeUnique<FUECompressedAnimData>();
@@ -2592,7 +2653,7 @@ UAnimSequence* FglTFRuntimeParser::CreateAnimationFromPose(USkeletalMesh* Skelet
 	const TArray<FMeshBoneInfo>& MeshBoneInfos = AnimSequence->GetSkeleton()->GetReferenceSkeleton().GetRefBoneInfo();
 
 #if !WITH_EDITOR
-	UglTFAnimBoneCompressionCodec* CompressionCodec = NewObject<UglTFAnimBoneCompressionCodec>();
+	UglTFAnimBoneCompressionCodec* CompressionCodec = glTFRuntime::CreateBoneCompressionCodec(SkeletalAnimationConfig);
 	CompressionCodec->Tracks.AddDefaulted(BonesPoses.Num());
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
@@ -2751,6 +2812,7 @@ UAnimSequence* FglTFRuntimeParser::CreateAnimationFromPose(USkeletalMesh* Skelet
 	AnimSequence->PostProcessSequence();
 #endif
 #else
+	glTFRuntime::CompressBoneTracks(CompressionCodec, NumFrames, SkeletalAnimationConfig);
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
 		AnimSequence->CompressedData.CompressedDataStructure = MakeUnique<FUECompressedAnimData>();
@@ -3009,7 +3071,8 @@ UAnimSequence* FglTFRuntimeParser::CreateSkeletalAnimationFromPath(USkeletalMesh
 	AnimSequence->PostProcessSequence();
 #endif
 #else
-	UglTFAnimBoneCompressionCodec* CompressionCodec = NewObject<UglTFAnimBoneCompressionCodec>();
+	UglTFAnimBoneCompressionCodec* CompressionCodec = glTFRuntime::CreateBoneCompressionCodec(SkeletalAnimationConfig);
+	glTFRuntime::CompressBoneTracks(CompressionCodec, NumFrames, SkeletalAnimationConfig);
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
 		AnimSequence->CompressedData.CompressedDataStructure = MakeUnique<FUECompressedAnimData>();
@@ -3740,17 +3803,22 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 
 void FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
 {
-	Async(EAsyncExecution::Thread, [this, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(MaterialsConfig.AsyncPriority, UglTFRuntimeCancellationToken::GetTokenFlag(MaterialsConfig.CancellationToken), [this, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode]()
 		{
 			FglTFRuntimeMeshLOD LOD;
 			int32 NewSkinIndex = SkinIndex;
 			const bool bSuccess = LoadSkinnedMeshRecursiveAsRuntimeLOD(NodeName, NewSkinIndex, ExcludeNodes, LOD, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
+			FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD = MoveTemp(LOD), AsyncCallback]()
+				{
+					AsyncCallback.ExecuteIfBound(bSuccess, LOD);
+				}, TStatId(), nullptr, ENamedThreads::GameThread);
+		}, [AsyncCallback]()
+		{
+			FFunctionGraphTask::CreateAndDispatchWhenReady([AsyncCallback]()
 				{
-					AsyncCallback.ExecuteIfBound(bSuccess, MoveTemp(LOD));
+					AsyncCallback.ExecuteIfBound(false, FglTFRuntimeMeshLOD());
 				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		});
 }
 
@@ -4142,25 +4210,30 @@ void FglTFRuntimeParser::LoadSkeletalMeshFromRuntimeLODsAsync(const TArray<FglTF
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, RuntimeLODs, AsyncCallback]()
+	// the finalization steps could run after this task is completed, so the LODs are owned by the context
+	SkeletalMeshContext->CachedRuntimeMeshLODs = RuntimeLODs;
+
+	FglTFRuntimeTaskQueue::Get().Enqueue(SkeletalMeshConfig.AsyncPriority, SkeletalMeshContext->CancellationFlag, [this, SkeletalMeshContext, AsyncCallback]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 
-			if (RuntimeLODs.Num() < 1)
+			TArray<FglTFRuntimeMeshLOD>& ContextRuntimeLODs = SkeletalMeshContext->CachedRuntimeMeshLODs;
+
+			if (ContextRuntimeLODs.Num() < 1)
 			{
 				AddError("LoadSkeletalMeshFromRuntimeLODsAsync()", "No RuntimeLOD specified");
 				return;
 			}
 
-			if (RuntimeLODs[0].Primitives.Num() < 1)
+			if (ContextRuntimeLODs[0].Primitives.Num() < 1)
 			{
 				AddError("LoadSkeletalMeshFromRuntimeLODsAsync()", "No Primitives for RuntimeLOD 0");
 				return;
 			}
 
-			const TMap<int32, FName>& BaseBoneMap = RuntimeLODs[0].Primitives[0].OverrideBoneMap;
+			const TMap<int32, FName>& BaseBoneMap = ContextRuntimeLODs[0].Primitives[0].OverrideBoneMap;
 
-			SkeletalMeshContext->LODs.Add(const_cast<FglTFRuntimeMeshLOD*>(&RuntimeLODs[0]));
+			SkeletalMeshContext->LODs.Add(&ContextRuntimeLODs[0]);
 
 			auto ContainsBone = [BaseBoneMap](FName BoneName) -> bool
 				{
@@ -4174,15 +4247,15 @@ void FglTFRuntimeParser::LoadSkeletalMeshFromRuntimeLODsAsync(const TArray<FglTF
 					return false;
 				};
 
-			for (int32 LODIndex = 1; LODIndex < RuntimeLODs.Num(); LODIndex++)
+			for (int32 LODIndex = 1; LODIndex < ContextRuntimeLODs.Num(); LODIndex++)
 			{
-				if (RuntimeLODs[LODIndex].Primitives.Num() < 1)
+				if (ContextRuntimeLODs[LODIndex].Primitives.Num() < 1)
 				{
 					AddError("LoadSkeletalMeshFromRuntimeLODsAsync()", "Invalid RuntimeLOD, no Primitives defined");
 					return;
 				}
 
-				for (const FglTFRuntimePrimitive& Primitive : RuntimeLODs[LODIndex].Primitives)
+				for (const FglTFRuntimePrimitive& Primitive : ContextRuntimeLODs[LODIndex].Primitives)
 				{
 					FglTFRuntimePrimitive& NonConstPrimitive = const_cast<FglTFRuntimePrimitive&>(Primitive);
 
@@ -4196,58 +4269,125 @@ void FglTFRuntimeParser::LoadSkeletalMeshFromRuntimeLODsAsync(const TArray<FglTF
 					}
 				}
 
-				SkeletalMeshContext->LODs.Add(const_cast<FglTFRuntimeMeshLOD*>(&RuntimeLODs[LODIndex]));
+				SkeletalMeshContext->LODs.Add(&ContextRuntimeLODs[LODIndex]);
 			}
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
+		}, [SkeletalMeshContext, AsyncCallback]()
+		{
+			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 		});
 }
 
 const FBox& FglTFRuntimeSkeletalMeshContext::GetBoneBox(const int32 BoneIndex)
 {
-	// unfortunately we need access to SkinWeightVertexBuffer.GetBoneIndex (and it is not available in 4.25)
-#if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26
-	if (PerBoneBoundingBoxCache.Contains(BoneIndex))
+	if (PerBoneBoundingBoxCache.Num() == 0)
+	{
+		BuildBoneBoxes();
+	}
+
+	if (const FBox* CachedBox = PerBoneBoundingBoxCache.Find(BoneIndex))
 	{
-		return PerBoneBoundingBoxCache[BoneIndex];
+		return *CachedBox;
 	}
 
 	FBox& Box = PerBoneBoundingBoxCache.Add(BoneIndex);
 	Box.Init();
+	return Box;
+}
+
+void FglTFRuntimeSkeletalMeshContext::BuildBoneBoxes()
+{
+	const int32 NumBones = GetNumBones();
+
+	PerBoneBoundingBoxCache.Empty(NumBones);
 
+	// unfortunately we need access to SkinWeightVertexBuffer.GetBoneIndex (and it is not available in 4.25)
+#if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26
 	const FSkeletalMeshLODRenderData& LOD0 = SkeletalMesh->GetResourceForRendering()->LODRenderData[0];
 	const uint32 NumVertices = LOD0.GetNumVertices();
-	for (uint32 Index = 0; Index < NumVertices; Index++)
-	{
-		const uint32 VertexIndex = LOD0.MultiSizeIndexContainer.GetIndexBuffer()->Get(Index);
+	const uint32 MaxBoneInfluences = LOD0.SkinWeightVertexBuffer.GetMaxBoneInfluences();
+	const auto& RefBasesInvMatrix = SkeletalMesh->GetRefBasesInvMatrix();
+
+	// each chunk accumulates its own boxes, merged at the end
+	const int32 NumChunks = FMath::Clamp<int32>(NumVertices / 1024, 1, FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1));
+	const uint32 ChunkSize = FMath::DivideAndRoundUp<uint32>(NumVertices, NumChunks);
 
-		const uint32 MaxBoneInfluences = LOD0.SkinWeightVertexBuffer.GetMaxBoneInfluences();
+	TArray<TArray<FBox>> ChunksBoneBoxes;
+	ChunksBoneBoxes.SetNum(NumChunks);
 
-		int32 BestBoneIndex = INDEX_NONE;
-		uint16 BestWeight = 0;
-		for (uint32 InfluenceIndex = 0; InfluenceIndex < MaxBoneInfluences; InfluenceIndex++)
+	ParallelFor(NumChunks, [&](const int32 ChunkIndex)
 		{
-			const uint32 VertexBoneIndex = LOD0.SkinWeightVertexBuffer.GetBoneIndex(VertexIndex, InfluenceIndex);
-			const uint16 VertexBoneWeight = LOD0.SkinWeightVertexBuffer.GetBoneWeight(VertexIndex, InfluenceIndex);
-			if (VertexBoneWeight > BestWeight)
+			TArray<FBox>& BoneBoxes = ChunksBoneBoxes[ChunkIndex];
+			BoneBoxes.Init(FBox(ForceInit), NumBones);
+
+			const uint32 FirstVertex = ChunkIndex * ChunkSize;
+			const uint32 LastVertex = FMath::Min(FirstVertex + ChunkSize, NumVertices);
+
+			int32 SectionIndex = 0;
+			for (uint32 VertexIndex = FirstVertex; VertexIndex < LastVertex; VertexIndex++)
 			{
-				BestBoneIndex = VertexBoneIndex;
-				BestWeight = VertexBoneWeight;
+				while (SectionIndex < LOD0.RenderSections.Num() && VertexIndex >= LOD0.RenderSections[SectionIndex].BaseVertexIndex + LOD0.RenderSections[SectionIndex].NumVertices)
+				{
+					SectionIndex++;
+				}
+
+				if (SectionIndex >= LOD0.RenderSections.Num())
+				{
+					break;
+				}
+
+				const FSkelMeshRenderSection& RenderSection = LOD0.RenderSections[SectionIndex];
+				if (VertexIndex < RenderSection.BaseVertexIndex)
+				{
+					continue;
+				}
+
+				int32 BestBoneIndex = INDEX_NONE;
+				uint16 BestWeight = 0;
+				for (uint32 InfluenceIndex = 0; InfluenceIndex < MaxBoneInfluences; InfluenceIndex++)
+				{
+					const uint32 VertexBoneIndex = LOD0.SkinWeightVertexBuffer.GetBoneIndex(VertexIndex, InfluenceIndex);
+					const uint16 VertexBoneWeight = LOD0.SkinWeightVertexBuffer.GetBoneWeight(VertexIndex, InfluenceIndex);
+					if (VertexBoneWeight > BestWeight)
+					{
+						BestBoneIndex = VertexBoneIndex;
+						BestWeight = VertexBoneWeight;
+					}
+				}
+
+				// influences are relative to the section bone map
+				if (!RenderSection.BoneMap.IsValidIndex(BestBoneIndex))
+				{
+					continue;
+				}
+
+				const int32 BoneIndex = RenderSection.BoneMap[BestBoneIndex];
+				if (BoneIndex < NumBones)
+				{
+					BoneBoxes[BoneIndex] += FVector(RefBasesInvMatrix[BoneIndex].TransformPosition(LOD0.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex)));
+				}
 			}
-		}
+		});
 
-		if (BestBoneIndex == BoneIndex)
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		FBox& Box = PerBoneBoundingBoxCache.Add(BoneIndex);
+		Box.Init();
+		for (const TArray<FBox>& BoneBoxes : ChunksBoneBoxes)
 		{
-			Box += FVector(SkeletalMesh->GetRefBasesInvMatrix()[BoneIndex].TransformPosition(LOD0.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex)));
+			if (BoneBoxes.IsValidIndex(BoneIndex))
+			{
+				Box += BoneBoxes[BoneIndex];
+			}
 		}
 	}
-
-	return PerBoneBoundingBoxCache[BoneIndex];
 #else
 	// dummy logic
-	FBox& Box = PerBoneBoundingBoxCache.Add(BoneIndex);
-	Box.Init();
-	return PerBoneBoundingBoxCache[BoneIndex];
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		PerBoneBoundingBoxCache.Add(BoneIndex).Init();
+	}
 #endif
 }
 
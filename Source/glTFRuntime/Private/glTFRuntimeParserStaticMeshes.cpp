@@ -12,6 +12,7 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "StaticMeshResources.h"
+#include "Rendering/SkinWeightVertexBuffer.h"
 #if ENGINE_MAJOR_VERSION >= 5
 #if ENGINE_MINOR_VERSION < 2
 #include "MeshCardRepresentation.h"
@@ -22,11 +23,399 @@
 #endif
 #endif
 
+namespace glTFRuntime
+{
+	struct FStaticMeshVertexWeldKey
+	{
+		int64 Position[3];
+		int64 Normal[3];
+		int64 UVs[MAX_STATIC_TEXCOORDS * 2];
+		FColor Color;
+		FSkinWeightInfo SkinWeights;
+
+		bool operator==(const FStaticMeshVertexWeldKey& Other) const
+		{
+			return FMemory::Memcmp(this, &Other, sizeof(FStaticMeshVertexWeldKey)) == 0;
+		}
+
+		friend uint32 GetTypeHash(const FStaticMeshVertexWeldKey& Key)
+		{
+			return FCrc::MemCrc32(&Key, sizeof(FStaticMeshVertexWeldKey));
+		}
+	};
+
+	// snap the value to the welding grid (or use its bits for exact matching)
+	FORCEINLINE int64 QuantizeWeldValue(const float Value, const float InvTolerance)
+	{
+		// +0 and -0 must match
+		const float ExactValue = Value == 0 ? 0 : Value;
+		const uint32 ExactBits = *reinterpret_cast<const uint32*>(&ExactValue);
+		if (InvTolerance > 0)
+		{
+			const double GridValue = FMath::RoundToDouble(static_cast<double>(Value) * InvTolerance);
+			if (FMath::Abs(GridValue) < 9.0e18)
+			{
+				return static_cast<int64>(GridValue);
+			}
+			// out of the grid range (or not finite), below any grid value
+			return MIN_int64 + ExactBits;
+		}
+		return ExactBits;
+	}
+
+	// one value per index (indices must be already validated)
+	template<typename T>
+	void UnweldStream(TArray<T>& Values, const TArray<uint32>& Indices, const int32 NumVertices)
+	{
+		if (Values.Num() == 0)
+		{
+			return;
+		}
+
+		// partial streams are zero padded to keep them aligned with the positions
+		if (Values.Num() < NumVertices)
+		{
+			Values.AddZeroed(NumVertices - Values.Num());
+		}
+
+		TArray<T> UnweldedValues;
+		UnweldedValues.AddUninitialized(Indices.Num());
+		for (int32 Index = 0; Index < Indices.Num(); Index++)
+		{
+			UnweldedValues[Index] = Values[Indices[Index]];
+		}
+		Values = MoveTemp(UnweldedValues);
+	}
+
+	// vertex -> triangle corners adjacency of a section (corners are stored in triangle order, so accumulations are deterministic)
+	struct FStaticMeshVertexAdjacency
+	{
+		TArray<int32> Offsets;
+		TArray<int32> Corners;
+	};
+
+	// returns the section relative vertices of the triangle, false if any index is out of the section range
+	FORCEINLINE bool GetStaticMeshTriangle(const TArray<uint32>& Indices, const int32 IndexBaseIndex, const int32 TriangleIndex, const int32 VertexBaseIndex, const int32 NumVertices, uint32 OutVertices[3])
+	{
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			OutVertices[Corner] = Indices[IndexBaseIndex + TriangleIndex * 3 + Corner] - VertexBaseIndex;
+			if (OutVertices[Corner] >= static_cast<uint32>(NumVertices))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void BuildStaticMeshVertexAdjacency(const TArray<uint32>& Indices, const int32 IndexBaseIndex, const int32 NumTriangles, const int32 VertexBaseIndex, const int32 NumVertices, FStaticMeshVertexAdjacency& Adjacency)
+	{
+		// counting sort, those are cheap integer passes compared to the math done per vertex
+		Adjacency.Offsets.SetNumZeroed(NumVertices + 1);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			uint32 TriangleVertices[3];
+			if (GetStaticMeshTriangle(Indices, IndexBaseIndex, TriangleIndex, VertexBaseIndex, NumVertices, TriangleVertices))
+			{
+				Adjacency.Offsets[TriangleVertices[0] + 1]++;
+				Adjacency.Offsets[TriangleVertices[1] + 1]++;
+				Adjacency.Offsets[TriangleVertices[2] + 1]++;
+			}
+		}
+
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			Adjacency.Offsets[VertexIndex + 1] += Adjacency.Offsets[VertexIndex];
+		}
+
+		TArray<int32> Cursors = Adjacency.Offsets;
+		Adjacency.Corners.SetNumUninitialized(Adjacency.Offsets[NumVertices]);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			uint32 TriangleVertices[3];
+			if (GetStaticMeshTriangle(Indices, IndexBaseIndex, TriangleIndex, VertexBaseIndex, NumVertices, TriangleVertices))
+			{
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					Adjacency.Corners[Cursors[TriangleVertices[Corner]]++] = TriangleIndex * 3 + Corner;
+				}
+			}
+		}
+	}
+}
+
+int32 FglTFRuntimeParser::WeldVertices(TArray<FStaticMeshBuildVertex>& Vertices, const int32 VertexBaseIndex, const int32 NumVertices, TArray<uint32>& Indices, const int32 IndexBaseIndex, const int32 NumIndices, const int32 NumUVs, const bool bHasVertexColors, const float Tolerance, TArray<FSkinWeightInfo>* SkinWeights)
+{
+	const float InvTolerance = Tolerance > 0 ? 1.0f / Tolerance : 0;
+
+	TArray<glTFRuntime::FStaticMeshVertexWeldKey> Keys;
+	Keys.AddZeroed(NumVertices);
+
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			const FStaticMeshBuildVertex& Vertex = Vertices[VertexBaseIndex + VertexIndex];
+			glTFRuntime::FStaticMeshVertexWeldKey& Key = Keys[VertexIndex];
+			for (int32 Component = 0; Component < 3; Component++)
+			{
+				Key.Position[Component] = glTFRuntime::QuantizeWeldValue(Vertex.Position[Component], InvTolerance);
+				Key.Normal[Component] = glTFRuntime::QuantizeWeldValue(Vertex.TangentZ[Component], InvTolerance);
+			}
+			for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
+			{
+				Key.UVs[UVIndex * 2] = glTFRuntime::QuantizeWeldValue(Vertex.UVs[UVIndex].X, InvTolerance);
+				Key.UVs[UVIndex * 2 + 1] = glTFRuntime::QuantizeWeldValue(Vertex.UVs[UVIndex].Y, InvTolerance);
+			}
+			if (bHasVertexColors)
+			{
+				Key.Color = Vertex.Color;
+			}
+			// skinned vertices can be merged only when sharing the same influences too (copied as raw bytes, the key padding must stay zeroed)
+			if (SkinWeights)
+			{
+				FMemory::Memcpy(&Key.SkinWeights, &(*SkinWeights)[VertexBaseIndex + VertexIndex], sizeof(FSkinWeightInfo));
+			}
+		});
+
+	TMap<glTFRuntime::FStaticMeshVertexWeldKey, uint32> UniqueVertices;
+	UniqueVertices.Reserve(NumVertices);
+
+	TArray<uint32> Remap;
+	Remap.AddUninitialized(NumVertices);
+
+	int32 NumUniqueVertices = 0;
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		if (const uint32* UniqueVertexIndex = UniqueVertices.Find(Keys[VertexIndex]))
+		{
+			Remap[VertexIndex] = *UniqueVertexIndex;
+			continue;
+		}
+
+		// the packed slot is always <= the current one, so it can be safely overwritten
+		Vertices[VertexBaseIndex + NumUniqueVertices] = Vertices[VertexBaseIndex + VertexIndex];
+		if (SkinWeights)
+		{
+			(*SkinWeights)[VertexBaseIndex + NumUniqueVertices] = (*SkinWeights)[VertexBaseIndex + VertexIndex];
+		}
+		UniqueVertices.Add(Keys[VertexIndex], NumUniqueVertices);
+		Remap[VertexIndex] = NumUniqueVertices++;
+	}
+
+	ParallelFor(NumIndices, [&](const int32 Index)
+		{
+			uint32& VertexIndex = Indices[IndexBaseIndex + Index];
+			VertexIndex = VertexBaseIndex + Remap[VertexIndex - VertexBaseIndex];
+		});
+
+	return NumUniqueVertices;
+}
+
+bool FglTFRuntimeParser::UnweldPrimitive(FglTFRuntimePrimitive& Primitive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_UnweldPrimitive, FColor::Magenta);
+
+	const int32 NumVertices = Primitive.Positions.Num();
+	const int32 NumIndices = Primitive.Indices.Num();
+
+	for (const uint32 VertexIndex : Primitive.Indices)
+	{
+		if (VertexIndex >= static_cast<uint32>(NumVertices))
+		{
+			return false;
+		}
+	}
+
+	glTFRuntime::UnweldStream(Primitive.Positions, Primitive.Indices, NumVertices);
+	glTFRuntime::UnweldStream(Primitive.Normals, Primitive.Indices, NumVertices);
+	glTFRuntime::UnweldStream(Primitive.Tangents, Primitive.Indices, NumVertices);
+	glTFRuntime::UnweldStream(Primitive.Colors, Primitive.Indices, NumVertices);
+	for (TArray<FVector2D>& UV : Primitive.UVs)
+	{
+		glTFRuntime::UnweldStream(UV, Primitive.Indices, NumVertices);
+	}
+	for (TArray<FglTFRuntimeUInt16Vector4>& Joints : Primitive.Joints)
+	{
+		glTFRuntime::UnweldStream(Joints, Primitive.Indices, NumVertices);
+	}
+	for (TArray<FVector4>& Weights : Primitive.Weights)
+	{
+		glTFRuntime::UnweldStream(Weights, Primitive.Indices, NumVertices);
+	}
+	for (FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+	{
+		glTFRuntime::UnweldStream(MorphTarget.Positions, Primitive.Indices, NumVertices);
+		glTFRuntime::UnweldStream(MorphTarget.Normals, Primitive.Indices, NumVertices);
+	}
+
+	for (int32 Index = 0; Index < NumIndices; Index++)
+	{
+		Primitive.Indices[Index] = Index;
+	}
+
+	return true;
+}
+
+void FglTFRuntimeParser::GenerateNormalsAndTangents(TArray<FStaticMeshBuildVertex>& Vertices, const int32 VertexBaseIndex, const int32 NumVertices, const TArray<uint32>& Indices, const int32 IndexBaseIndex, const int32 NumIndices, const bool bGenerateNormals, const bool bGenerateTangents, const float TangentsDirection)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_GenerateNormalsAndTangents, FColor::Magenta);
+
+	const int32 NumTriangles = NumIndices / 3;
+
+	glTFRuntime::FStaticMeshVertexAdjacency Adjacency;
+	glTFRuntime::BuildStaticMeshVertexAdjacency(Indices, IndexBaseIndex, NumTriangles, VertexBaseIndex, NumVertices, Adjacency);
+
+	TArray<float> CornerAngles;
+	CornerAngles.AddZeroed(NumTriangles * 3);
+
+	TArray<FVector> FaceNormals;
+	if (bGenerateNormals)
+	{
+		FaceNormals.AddZeroed(NumTriangles);
+	}
+
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			uint32 TriangleVertices[3];
+			if (!glTFRuntime::GetStaticMeshTriangle(Indices, IndexBaseIndex, TriangleIndex, VertexBaseIndex, NumVertices, TriangleVertices))
+			{
+				return;
+			}
+
+			FVector Positions[3];
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				Positions[Corner] = FVector(Vertices[VertexBaseIndex + TriangleVertices[Corner]].Position);
+			}
+
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const FVector EdgeA = (Positions[(Corner + 1) % 3] - Positions[Corner]).GetSafeNormal();
+				const FVector EdgeB = (Positions[(Corner + 2) % 3] - Positions[Corner]).GetSafeNormal();
+				CornerAngles[TriangleIndex * 3 + Corner] = FMath::Acos(FMath::Clamp<float>(FVector::DotProduct(EdgeA, EdgeB), -1, 1));
+			}
+
+			if (bGenerateNormals)
+			{
+				FaceNormals[TriangleIndex] = FVector::CrossProduct(Positions[2] - Positions[0], Positions[1] - Positions[0]).GetSafeNormal();
+			}
+		});
+
+	if (bGenerateNormals)
+	{
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				const int32 FirstCorner = Adjacency.Offsets[VertexIndex];
+				const int32 LastCorner = Adjacency.Offsets[VertexIndex + 1];
+				// unreferenced vertex
+				if (FirstCorner == LastCorner)
+				{
+					return;
+				}
+
+				FVector Normal = FVector::ZeroVector;
+				for (int32 CornerIndex = FirstCorner; CornerIndex < LastCorner; CornerIndex++)
+				{
+					const int32 Corner = Adjacency.Corners[CornerIndex];
+					Normal += FaceNormals[Corner / 3] * CornerAngles[Corner];
+				}
+
+#if ENGINE_MAJOR_VERSION > 4
+				Vertices[VertexBaseIndex + VertexIndex].TangentZ = FVector3f(Normal.GetSafeNormal());
+#else
+				Vertices[VertexBaseIndex + VertexIndex].TangentZ = Normal.GetSafeNormal();
+#endif
+			});
+	}
+
+	if (!bGenerateTangents)
+	{
+		return;
+	}
+
+	TArray<FVector> FaceTangents;
+	TArray<FVector> FaceBitangents;
+	FaceTangents.AddZeroed(NumTriangles);
+	FaceBitangents.AddZeroed(NumTriangles);
+
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			uint32 TriangleVertices[3];
+			if (!glTFRuntime::GetStaticMeshTriangle(Indices, IndexBaseIndex, TriangleIndex, VertexBaseIndex, NumVertices, TriangleVertices))
+			{
+				return;
+			}
+
+			const FStaticMeshBuildVertex& Vertex0 = Vertices[VertexBaseIndex + TriangleVertices[0]];
+			const FStaticMeshBuildVertex& Vertex1 = Vertices[VertexBaseIndex + TriangleVertices[1]];
+			const FStaticMeshBuildVertex& Vertex2 = Vertices[VertexBaseIndex + TriangleVertices[2]];
+
+			const FVector DeltaPosition0 = FVector(Vertex1.Position) - FVector(Vertex0.Position);
+			const FVector DeltaPosition1 = FVector(Vertex2.Position) - FVector(Vertex0.Position);
+
+			const FVector2D DeltaUV0 = FVector2D(Vertex1.UVs[0]) - FVector2D(Vertex0.UVs[0]);
+			const FVector2D DeltaUV1 = FVector2D(Vertex2.UVs[0]) - FVector2D(Vertex0.UVs[0]);
+
+			// degenerate uv mapping, this face does not contribute to the tangent space
+			const float Determinant = DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X;
+			if (FMath::Abs(Determinant) <= SMALL_NUMBER)
+			{
+				return;
+			}
+
+			const float Factor = 1.0f / Determinant;
+			FaceTangents[TriangleIndex] = (((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor).GetSafeNormal();
+			FaceBitangents[TriangleIndex] = (((DeltaPosition1 * DeltaUV0.X) - (DeltaPosition0 * DeltaUV1.X)) * Factor).GetSafeNormal();
+		});
+
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			const int32 FirstCorner = Adjacency.Offsets[VertexIndex];
+			const int32 LastCorner = Adjacency.Offsets[VertexIndex + 1];
+			if (FirstCorner == LastCorner)
+			{
+				return;
+			}
+
+			FStaticMeshBuildVertex& Vertex = Vertices[VertexBaseIndex + VertexIndex];
+			const FVector Normal = FVector(Vertex.TangentZ);
+
+			FVector Tangent = FVector::ZeroVector;
+			FVector Bitangent = FVector::ZeroVector;
+			for (int32 CornerIndex = FirstCorner; CornerIndex < LastCorner; CornerIndex++)
+			{
+				const int32 Corner = Adjacency.Corners[CornerIndex];
+				const FVector& FaceTangent = FaceTangents[Corner / 3];
+				Tangent += (FaceTangent - Normal * FVector::DotProduct(Normal, FaceTangent)).GetSafeNormal() * CornerAngles[Corner];
+				Bitangent += FaceBitangents[Corner / 3] * CornerAngles[Corner];
+			}
+
+			Tangent -= Normal * FVector::DotProduct(Normal, Tangent);
+			if (!Tangent.Normalize())
+			{
+				FVector BitangentAxis;
+				Normal.FindBestAxisVectors(Tangent, BitangentAxis);
+			}
+
+			// mirrored uv mapping flips the bitangent (unmirrored faces give a positive dot product in engine space, like TANGENT.w = 1)
+			const float TangentW = FVector::DotProduct(FVector::CrossProduct(Normal, Tangent), Bitangent) < 0 ? -1 : 1;
+
+#if ENGINE_MAJOR_VERSION > 4
+			Vertex.TangentX = FVector3f(Tangent);
+			Vertex.TangentY = FVector3f(ComputeTangentYWithW(Normal, Tangent, TangentW * TangentsDirection));
+#else
+			Vertex.TangentX = Tangent;
+			Vertex.TangentY = ComputeTangentYWithW(Normal, Tangent, TangentW * TangentsDirection);
+#endif
+		});
+}
+
 FglTFRuntimeStaticMeshContext::FglTFRuntimeStaticMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const int32 InMeshIndex, const FglTFRuntimeStaticMeshConfig& InStaticMeshConfig) :
 	Parser(InParser),
 	StaticMeshConfig(InStaticMeshConfig),
 	MeshIndex(InMeshIndex)
 {
+	CancellationFlag = UglTFRuntimeCancellationToken::GetTokenFlag(StaticMeshConfig.CancellationToken);
+
 	StaticMesh = NewObject<UStaticMesh>(StaticMeshConfig.Outer ? StaticMeshConfig.Outer : GetTransientPackage(), NAME_None, RF_Public);
 #if PLATFORM_ANDROID || PLATFORM_IOS
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
@@ -64,9 +453,19 @@ FglTFRuntimeStaticMeshContext::FglTFRuntimeStaticMeshContext(TSharedRef<FglTFRun
 void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
 	// first check cache
-	if (CanReadFromCache(StaticMeshConfig.CacheMode) && StaticMeshesCache.Contains(MeshIndex))
+	UStaticMesh* CachedStaticMesh = nullptr;
+	if (CanReadFromCache(StaticMeshConfig.CacheMode))
+	{
+		FScopeLock Lock(&MeshesCacheLock);
+		if (StaticMeshesCache.Contains(MeshIndex))
+		{
+			CachedStaticMesh = StaticMeshesCache[MeshIndex];
+		}
+	}
+
+	if (CachedStaticMesh)
 	{
-		UStaticMesh* StaticMesh = StaticMeshesCache[MeshIndex];
+		UStaticMesh* StaticMesh = CachedStaticMesh;
 		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMesh, AsyncCallback]()
 			{
 				AsyncCallback.ExecuteIfBound(StaticMesh);
@@ -76,13 +475,13 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(StaticMeshConfig.AsyncPriority, StaticMeshContext->CancellationFlag, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
 		{
 			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
 			if (JsonMeshObject)
 			{
 				FglTFRuntimeMeshLOD* LOD = nullptr;
-				if (LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig))
+				if (LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig, StaticMeshContext->StaticMeshConfig.bCompactVertexStreams))
 				{
 					StaticMeshContext->LODs.Add(LOD);
 
@@ -90,28 +489,25 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 				}
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([MeshIndex, StaticMeshContext, AsyncCallback]()
+			FinalizeStaticMeshAsync(StaticMeshContext, [MeshIndex, StaticMeshContext, AsyncCallback]()
 				{
-					if (StaticMeshContext->StaticMesh)
-					{
-						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
-					}
-
 					if (StaticMeshContext->StaticMesh)
 					{
 						if (StaticMeshContext->Parser->CanWriteToCache(StaticMeshContext->StaticMeshConfig.CacheMode))
 						{
+							FScopeLock Lock(&StaticMeshContext->Parser->MeshesCacheLock);
 							StaticMeshContext->Parser->StaticMeshesCache.Add(MeshIndex, StaticMeshContext->StaticMesh);
 						}
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
-					// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
-					StaticMeshContext->UnregisterGCObject();
-#endif
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				});
+		}, [this, StaticMeshContext, AsyncCallback]()
+		{
+			FinalizeStaticMeshAsync(StaticMeshContext, [StaticMeshContext, AsyncCallback]()
+				{
+					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
+				});
 		});
 }
 
@@ -151,23 +547,25 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 #endif
 		TArray<uint32> LODIndices;
 		int32 NumUVs = 1;
+		const int32 MaxUVChannels = FMath::Clamp<int32>(StaticMeshContext->StaticMeshConfig.MaxUVChannels, 1, MAX_STATIC_TEXCOORDS);
 		FVector PivotDelta = FVector::ZeroVector;
 
 		int32 NumVerticesToBuildPerLOD = 0;
 
 		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
 		{
-			if (Primitive.UVs.Num() > NumUVs)
+			const int32 NumPrimitiveUVs = FMath::Min<int32>(Primitive.GetNumUVs(), MaxUVChannels);
+			if (NumPrimitiveUVs > NumUVs)
 			{
-				NumUVs = Primitive.UVs.Num();
+				NumUVs = NumPrimitiveUVs;
 			}
 
-			if (Primitive.Colors.Num() > 0)
+			if (Primitive.HasColors())
 			{
 				bHasVertexColors = true;
 			}
 
-			NumVerticesToBuildPerLOD += Primitive.bHasIndices ? Primitive.Positions.Num() : Primitive.Indices.Num();
+			NumVerticesToBuildPerLOD += Primitive.bHasIndices ? Primitive.GetNumVertices() : Primitive.Indices.Num();
 		}
 
 		TArray<FStaticMeshBuildVertex> StaticMeshBuildVertices;
@@ -185,6 +583,9 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 		int32 AdditionalTransformsPrimitiveIndex = 0; // used only when applying additional transforms
 
+		// first vertex and number of vertices of each section
+		TArray<FIntPoint> SectionsVertexRanges;
+
 		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
 		{
 			FName MaterialName = FName(FString::Printf(TEXT("LOD_%d_Section_%d_%s"), CurrentLODIndex, StaticMeshContext->StaticMaterials.Num(), *Primitive.MaterialName));
@@ -210,9 +611,14 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			Section.bEnableCollision = true;
 			Section.bCastShadow = !Primitive.bDisableShadows;
 
-			if (Primitive.bHighPrecisionUVs)
+			// channels that are not going to be used do not affect the precision
+			for (int32 UVIndex = 0; UVIndex < FMath::Min<int32>(Primitive.GetNumUVs(), NumUVs); UVIndex++)
 			{
-				bHighPrecisionUVs = true;
+				if (Primitive.IsHighPrecisionUVChannel(UVIndex))
+				{
+					bHighPrecisionUVs = true;
+					break;
+				}
 			}
 
 			const int32 SectionIndex = Sections.Num() - 1;
@@ -253,86 +659,34 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			LODIndices.AddUninitialized(NumVertexInstancesPerSection);
 
 			// Geometry generation
-			if (Primitive.bHasIndices)
-			{
-				ParallelFor(Primitive.Positions.Num(), [&](const int32 VertexIndex)
+			auto BuildVertex = [&](FStaticMeshBuildVertex& StaticMeshVertex, const uint32 VertexIndex)
+				{
+					if (Primitive.bCompactVertexStreams)
 					{
-						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexIndex];
-
-#if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
-#else
-						StaticMeshVertex.Position = GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore);
-#endif
-
-						FVector4 TangentX = GetSafeValue(Primitive.Tangents, VertexIndex, FVector4(0, 0, 0, 1), bMissingTangents);
+						// compact streams already match the vertex buffer layout
+						StaticMeshVertex.Position = GetSafeValue(Primitive.CompactPositions, VertexIndex, FglTFRuntimeCompactVector3::ZeroVector, bMissingIgnore);
+						const FglTFRuntimeCompactVector4 TangentX = GetSafeValue(Primitive.CompactTangents, VertexIndex, FglTFRuntimeCompactVector4(0, 0, 0, 1), bMissingTangents);
+						StaticMeshVertex.TangentX = TangentX;
+						StaticMeshVertex.TangentZ = GetSafeValue(Primitive.CompactNormals, VertexIndex, FglTFRuntimeCompactVector3::ZeroVector, bMissingNormals);
 #if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex.TangentX = FVector4f(TangentX);
-						StaticMeshVertex.TangentZ = FVector3f(GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals));
 						StaticMeshVertex.TangentY = FVector3f(ComputeTangentYWithW(FVector(StaticMeshVertex.TangentZ), FVector(StaticMeshVertex.TangentX), TangentX.W * TangentsDirection));
 #else
-						StaticMeshVertex.TangentX = TangentX;
-						StaticMeshVertex.TangentZ = GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals);
 						StaticMeshVertex.TangentY = ComputeTangentYWithW(StaticMeshVertex.TangentZ, StaticMeshVertex.TangentX, TangentX.W * TangentsDirection);
 #endif
 
 						for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
 						{
-							if (UVIndex < Primitive.UVs.Num())
-							{
-#if ENGINE_MAJOR_VERSION > 4
-								StaticMeshVertex.UVs[UVIndex] = FVector2f(GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore));
-#else
-								StaticMeshVertex.UVs[UVIndex] = GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore);
-#endif
-							}
 							// no UVs specified, let's set them to 0
-							else
-							{
-#if ENGINE_MAJOR_VERSION > 4
-								StaticMeshVertex.UVs[UVIndex] = FVector2f::ZeroVector;
-#else
-								StaticMeshVertex.UVs[UVIndex] = FVector2D::ZeroVector;
-#endif
-							}
+							StaticMeshVertex.UVs[UVIndex] = UVIndex < Primitive.CompactUVs.Num() ? GetSafeValue(Primitive.CompactUVs[UVIndex], VertexIndex, FglTFRuntimeCompactVector2::ZeroVector, bMissingIgnore) : FglTFRuntimeCompactVector2::ZeroVector;
 						}
 
 						if (bHasVertexColors)
 						{
-							StaticMeshVertex.Color = FLinearColor(GetSafeValue(Primitive.Colors, VertexIndex, WhiteColor, bMissingIgnore)).ToFColor(true);
+							StaticMeshVertex.Color = GetSafeValue(Primitive.CompactColors, VertexIndex, FColor::White, bMissingIgnore);
 						}
-
-						if (bApplyAdditionalTransforms)
-						{
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex.Position = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(FVector3d(StaticMeshVertex.Position)));
-							StaticMeshVertex.TangentX = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentX)));
-							StaticMeshVertex.TangentY = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentY)));
-							StaticMeshVertex.TangentZ = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentZ)));
-#else
-							StaticMeshVertex.Position = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(StaticMeshVertex.Position);
-							StaticMeshVertex.TangentX = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentX);
-							StaticMeshVertex.TangentY = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentY);
-							StaticMeshVertex.TangentZ = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentZ);
-#endif
-						}
-					});
-
-				ParallelFor(NumVertexInstancesPerSection, [&](const int32 VertexInstanceSectionIndex)
-					{
-						const uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
-						LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexBaseIndex + VertexIndex;
-					});
-			}
-			else
-			{
-				ParallelFor(NumVertexInstancesPerSection, [&](const int32 VertexInstanceSectionIndex)
+					}
+					else
 					{
-						uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
-						LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexBaseIndex + VertexInstanceSectionIndex;
-
-						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexInstanceSectionIndex];
-
 #if ENGINE_MAJOR_VERSION > 4
 						StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
 #else
@@ -375,21 +729,43 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 						{
 							StaticMeshVertex.Color = FLinearColor(GetSafeValue(Primitive.Colors, VertexIndex, WhiteColor, bMissingIgnore)).ToFColor(true);
 						}
+					}
 
-						if (bApplyAdditionalTransforms)
-						{
+					if (bApplyAdditionalTransforms)
+					{
 #if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex.Position = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(FVector3d(StaticMeshVertex.Position)));
-							StaticMeshVertex.TangentX = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentX)));
-							StaticMeshVertex.TangentY = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentY)));
-							StaticMeshVertex.TangentZ = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentZ)));
+						StaticMeshVertex.Position = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(FVector3d(StaticMeshVertex.Position)));
+						StaticMeshVertex.TangentX = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentX)));
+						StaticMeshVertex.TangentY = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentY)));
+						StaticMeshVertex.TangentZ = FVector3f(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(FVector3d(StaticMeshVertex.TangentZ)));
 #else
-							StaticMeshVertex.Position = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(StaticMeshVertex.Position);
-							StaticMeshVertex.TangentX = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentX);
-							StaticMeshVertex.TangentY = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentY);
-							StaticMeshVertex.TangentZ = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentZ);
+						StaticMeshVertex.Position = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformPosition(StaticMeshVertex.Position);
+						StaticMeshVertex.TangentX = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentX);
+						StaticMeshVertex.TangentY = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentY);
+						StaticMeshVertex.TangentZ = LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex].TransformVectorNoScale(StaticMeshVertex.TangentZ);
 #endif
-						}
+					}
+				};
+
+			if (Primitive.bHasIndices)
+			{
+				ParallelFor(Primitive.GetNumVertices(), [&](const int32 VertexIndex)
+					{
+						BuildVertex(StaticMeshBuildVertices[VertexBaseIndex + VertexIndex], VertexIndex);
+					});
+
+				ParallelFor(NumVertexInstancesPerSection, [&](const int32 VertexInstanceSectionIndex)
+					{
+						const uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
+						LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexBaseIndex + VertexIndex;
+					});
+			}
+			else
+			{
+				ParallelFor(NumVertexInstancesPerSection, [&](const int32 VertexInstanceSectionIndex)
+					{
+						LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexBaseIndex + VertexInstanceSectionIndex;
+						BuildVertex(StaticMeshBuildVertices[VertexBaseIndex + VertexInstanceSectionIndex], Primitive.Indices[VertexInstanceSectionIndex]);
 					});
 			}
 			// End of Geometry generation
@@ -407,248 +783,116 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 			const bool bCanGenerateNormals = (bMissingNormals && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
 				StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
-			if (bCanGenerateNormals && (NumVertexInstancesPerSection % 3) == 0)
+			const bool bGenerateNormals = bCanGenerateNormals && (NumVertexInstancesPerSection % 3) == 0;
+			if (bGenerateNormals)
 			{
-				TSet<uint32> ProcessedVertices;
-				ProcessedVertices.Reserve(NumVertexInstancesPerSection);
-
-				FCriticalSection NormalsGenerationLock;
-
-				ParallelFor(NumVertexInstancesPerSection / 3, [&](const int32 VertexInstanceSectionTriangleIndex)
-					{
-						const int32 VertexInstanceSectionIndex = VertexInstanceBaseIndex + VertexInstanceSectionTriangleIndex * 3;
-						bool bSetVertex0 = false;
-						bool bSetVertex1 = false;
-						bool bSetVertex2 = false;
-
-						const uint32 VertexIndex0 = LODIndices[VertexInstanceSectionIndex];
-						const uint32 VertexIndex1 = LODIndices[VertexInstanceSectionIndex + 1];
-						const uint32 VertexIndex2 = LODIndices[VertexInstanceSectionIndex + 2];
-
-						if (Primitive.bHasIndices)
-						{
-							FScopeLock Lock(&NormalsGenerationLock);
-
-							if (!ProcessedVertices.Contains(VertexIndex0))
-							{
-								ProcessedVertices.Add(VertexIndex0);
-								bSetVertex0 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex1))
-							{
-								ProcessedVertices.Add(VertexIndex1);
-								bSetVertex1 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex2))
-							{
-								ProcessedVertices.Add(VertexIndex2);
-								bSetVertex2 = true;
-							}
-
-							if (!bSetVertex0 && !bSetVertex1 && !bSetVertex2)
-							{
-								return;
-							}
-						}
-						else
-						{
-							bSetVertex0 = true;
-							bSetVertex1 = true;
-							bSetVertex2 = true;
-						}
-
-						if (!StaticMeshBuildVertices.IsValidIndex(VertexIndex0) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex1) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex2))
-						{
-							return;
-						}
-
-						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexIndex0];
-						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexIndex1];
-						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexIndex2];
-
-#if ENGINE_MAJOR_VERSION > 4
-						FVector SideA = FVector(StaticMeshVertex1.Position - StaticMeshVertex0.Position);
-						FVector SideB = FVector(StaticMeshVertex2.Position - StaticMeshVertex0.Position);
-						FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-						StaticMeshVertex0.TangentZ = FVector3f(NormalFromCross);
-						StaticMeshVertex1.TangentZ = FVector3f(NormalFromCross);
-						StaticMeshVertex2.TangentZ = FVector3f(NormalFromCross);
-#else
-						FVector SideA = StaticMeshVertex1.Position - StaticMeshVertex0.Position;
-						FVector SideB = StaticMeshVertex2.Position - StaticMeshVertex0.Position;
-						FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-						if (bSetVertex0)
-						{
-							StaticMeshVertex0.TangentZ = NormalFromCross;
-						}
-
-						if (bSetVertex1)
-						{
-							StaticMeshVertex1.TangentZ = NormalFromCross;
-						}
-
-						if (bSetVertex2)
-						{
-							StaticMeshVertex2.TangentZ = NormalFromCross;
-						}
-#endif
-					});
 				bMissingNormals = false;
 			}
 
 			const bool bCanGenerateTangents = (bMissingTangents && StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::IfMissing) ||
 				StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always;
 			// recompute tangents if required (need normals and uvs)
-			if (bCanGenerateTangents && !bMissingNormals && Primitive.UVs.Num() > 0 && (NumVertexInstancesPerSection % 3) == 0)
-			{
-				TSet<uint32> ProcessedVertices;
-				ProcessedVertices.Reserve(NumVertexInstancesPerSection);
+			const bool bGenerateTangents = bCanGenerateTangents && !bMissingNormals && Primitive.GetNumUVs() > 0 && (NumVertexInstancesPerSection % 3) == 0;
 
-				FCriticalSection TangentsGenerationLock;
-
-				ParallelFor(NumVertexInstancesPerSection / 3, [&](const int32 VertexInstanceSectionTriangleIndex)
-					{
-						const int32 VertexInstanceSectionIndex = VertexInstanceBaseIndex + VertexInstanceSectionTriangleIndex * 3;
-						bool bSetVertex0 = false;
-						bool bSetVertex1 = false;
-						bool bSetVertex2 = false;
+			int32 NumVerticesPerSection = Primitive.bHasIndices ? Primitive.GetNumVertices() : NumVertexInstancesPerSection;
 
-						const uint32 VertexIndex0 = LODIndices[VertexInstanceSectionIndex];
-						const uint32 VertexIndex1 = LODIndices[VertexInstanceSectionIndex + 1];
-						const uint32 VertexIndex2 = LODIndices[VertexInstanceSectionIndex + 2];
+			if (bGenerateNormals || bGenerateTangents)
+			{
+				GenerateNormalsAndTangents(StaticMeshBuildVertices, VertexBaseIndex, NumVerticesPerSection, LODIndices, VertexInstanceBaseIndex, NumVertexInstancesPerSection, bGenerateNormals, bGenerateTangents, TangentsDirection);
+			}
 
-						if (Primitive.bHasIndices)
-						{
-							FScopeLock Lock(&TangentsGenerationLock);
+			if (StaticMeshConfig.bWeldVertices && !Primitive.bHasIndices)
+			{
+				const int32 NumWeldedVertices = WeldVertices(StaticMeshBuildVertices, VertexBaseIndex, NumVerticesPerSection, LODIndices, VertexInstanceBaseIndex, NumVertexInstancesPerSection, NumUVs, bHasVertexColors, StaticMeshConfig.WeldVerticesTolerance);
+				StaticMeshContext->NumVerticesBeforeWelding += NumVerticesPerSection;
+				StaticMeshContext->NumVerticesAfterWelding += NumWeldedVertices;
+				NumVerticesPerSection = NumWeldedVertices;
+			}
 
-							if (!ProcessedVertices.Contains(VertexIndex0))
-							{
-								ProcessedVertices.Add(VertexIndex0);
-								bSetVertex0 = true;
-							}
+			SectionsVertexRanges.Add(FIntPoint(VertexBaseIndex, NumVerticesPerSection));
 
-							if (!ProcessedVertices.Contains(VertexIndex1))
-							{
-								ProcessedVertices.Add(VertexIndex1);
-								bSetVertex1 = true;
-							}
+			VertexInstanceBaseIndex += NumVertexInstancesPerSection;
+			VertexBaseIndex += NumVerticesPerSection;
+		}
 
-							if (!ProcessedVertices.Contains(VertexIndex2))
-							{
-								ProcessedVertices.Add(VertexIndex2);
-								bSetVertex2 = true;
-							}
+		// welding packed the vertices, drop the unused tail
+		if (VertexBaseIndex < StaticMeshBuildVertices.Num())
+		{
+			UE_LOG(LogGLTFRuntime, Log, TEXT("Welded LOD %d vertices: %d -> %d"), CurrentLODIndex, StaticMeshBuildVertices.Num(), VertexBaseIndex);
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+			StaticMeshBuildVertices.RemoveAt(VertexBaseIndex, StaticMeshBuildVertices.Num() - VertexBaseIndex, EAllowShrinking::Yes);
+#else
+			StaticMeshBuildVertices.RemoveAt(VertexBaseIndex, StaticMeshBuildVertices.Num() - VertexBaseIndex, true);
+#endif
+		}
 
-							if (!bSetVertex0 && !bSetVertex1 && !bSetVertex2)
-							{
-								return;
-							}
-						}
-						else
-						{
-							bSetVertex0 = true;
-							bSetVertex1 = true;
-							bSetVertex2 = true;
-						}
+		if (StaticMeshConfig.bOptimizeVertexCache)
+		{
+			TArray<FglTFRuntimeVertexCacheStats> SectionsStatsBefore;
+			TArray<FglTFRuntimeVertexCacheStats> SectionsStatsAfter;
+			SectionsStatsBefore.AddDefaulted(Sections.Num());
+			SectionsStatsAfter.AddDefaulted(Sections.Num());
 
-						if (!StaticMeshBuildVertices.IsValidIndex(VertexIndex0) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex1) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex2))
+			// sections own disjoint ranges of both indices and vertices
+			ParallelFor(Sections.Num(), [&](const int32 SectionIndex)
+				{
+					const int32 FirstIndex = Sections[SectionIndex].FirstIndex;
+					const int32 NumIndices = Sections[SectionIndex].NumTriangles * 3;
+					const int32 SectionBaseVertex = SectionsVertexRanges[SectionIndex].X;
+					const int32 SectionNumVertices = SectionsVertexRanges[SectionIndex].Y;
+
+					TArray<uint32> SectionIndices;
+					SectionIndices.AddUninitialized(NumIndices);
+					for (int32 Index = 0; Index < NumIndices; Index++)
+					{
+						SectionIndices[Index] = LODIndices[FirstIndex + Index] - SectionBaseVertex;
+						// broken indices, leave the section as is
+						if (SectionIndices[Index] >= static_cast<uint32>(SectionNumVertices))
 						{
 							return;
 						}
+					}
 
-						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexIndex0];
-						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexIndex1];
-						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexIndex2];
-
-#if ENGINE_MAJOR_VERSION > 4
-						const FVector Position0 = FVector(StaticMeshVertex0.Position);
-						const FVector4 TangentZ0 = FVector(StaticMeshVertex0.TangentZ);
-						const FVector2D UV0 = FVector2D(StaticMeshVertex0.UVs[0]);
-#else
-						const FVector Position0 = StaticMeshVertex0.Position;
-						const FVector4 TangentZ0 = StaticMeshVertex0.TangentZ;
-						const FVector2D UV0 = StaticMeshVertex0.UVs[0];
-#endif
-
-#if ENGINE_MAJOR_VERSION > 4
-						const FVector Position1 = FVector(StaticMeshVertex1.Position);
-						const FVector4 TangentZ1 = FVector(StaticMeshVertex1.TangentZ);
-						const FVector2D UV1 = FVector2D(StaticMeshVertex1.UVs[0]);
-#else
-						const FVector Position1 = StaticMeshVertex1.Position;
-						const FVector4 TangentZ1 = StaticMeshVertex1.TangentZ;
-						const FVector2D UV1 = StaticMeshVertex1.UVs[0];
-#endif
-
-#if ENGINE_MAJOR_VERSION > 4
-						const FVector Position2 = FVector(StaticMeshVertex2.Position);
-						const FVector4 TangentZ2 = FVector(StaticMeshVertex2.TangentZ);
-						const FVector2D UV2 = FVector2D(StaticMeshVertex2.UVs[0]);
-#else
-						const FVector Position2 = StaticMeshVertex2.Position;
-						const FVector4 TangentZ2 = StaticMeshVertex2.TangentZ;
-						const FVector2D UV2 = StaticMeshVertex2.UVs[0];
-#endif
-
-						const FVector DeltaPosition0 = Position1 - Position0;
-						const FVector DeltaPosition1 = Position2 - Position0;
-
-						const FVector2D DeltaUV0 = UV1 - UV0;
-						const FVector2D DeltaUV1 = UV2 - UV0;
+					SectionsStatsBefore[SectionIndex] = AnalyzeVertexCache(SectionIndices.GetData(), NumIndices, SectionNumVertices);
 
-						const float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
+					OptimizeVertexCache(SectionIndices.GetData(), NumIndices, SectionNumVertices);
+					if (StaticMeshConfig.OverdrawOptimizationThreshold > 0)
+					{
+						OptimizeOverdraw(SectionIndices.GetData(), NumIndices, SectionNumVertices, [&](const uint32 VertexIndex) -> FVector
+							{
+								return FVector(StaticMeshBuildVertices[SectionBaseVertex + VertexIndex].Position);
+							}, StaticMeshConfig.OverdrawOptimizationThreshold);
+					}
 
-						const FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-						//const FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
+					TArray<uint32> Remap;
+					OptimizeVertexFetch(SectionIndices.GetData(), NumIndices, SectionNumVertices, Remap);
 
-						if (bSetVertex0)
-						{
-							FVector TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-							TangentX0.Normalize();
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex0.TangentX = FVector3f(TangentX0);
-							StaticMeshVertex0.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex0.TangentZ), FVector(StaticMeshVertex0.TangentX)) * TangentsDirection);
-#else
-							StaticMeshVertex0.TangentX = TangentX0;
-							StaticMeshVertex0.TangentY = ComputeTangentY(StaticMeshVertex0.TangentZ, StaticMeshVertex0.TangentX) * TangentsDirection;
-#endif
-						}
+					TArray<FStaticMeshBuildVertex> SectionVertices(StaticMeshBuildVertices.GetData() + SectionBaseVertex, SectionNumVertices);
+					for (int32 VertexIndex = 0; VertexIndex < SectionNumVertices; VertexIndex++)
+					{
+						StaticMeshBuildVertices[SectionBaseVertex + Remap[VertexIndex]] = SectionVertices[VertexIndex];
+					}
 
-						if (bSetVertex1)
-						{
-							FVector TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-							TangentX1.Normalize();
+					SectionsStatsAfter[SectionIndex] = AnalyzeVertexCache(SectionIndices.GetData(), NumIndices, SectionNumVertices);
 
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex1.TangentX = FVector3f(TangentX1);
-							StaticMeshVertex1.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex1.TangentZ), FVector(StaticMeshVertex1.TangentX)) * TangentsDirection);
-#else
-							StaticMeshVertex1.TangentX = TangentX1;
-							StaticMeshVertex1.TangentY = ComputeTangentY(StaticMeshVertex1.TangentZ, StaticMeshVertex1.TangentX) * TangentsDirection;
-#endif
-						}
+					for (int32 Index = 0; Index < NumIndices; Index++)
+					{
+						LODIndices[FirstIndex + Index] = SectionIndices[Index] + SectionBaseVertex;
+					}
+				});
 
-						if (bSetVertex2)
-						{
-							FVector TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-							TangentX2.Normalize();
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex2.TangentX = FVector3f(TangentX2);
-							StaticMeshVertex2.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex2.TangentZ), FVector(StaticMeshVertex2.TangentX)) * TangentsDirection);
-#else
-							StaticMeshVertex2.TangentX = TangentX2;
-							StaticMeshVertex2.TangentY = ComputeTangentY(StaticMeshVertex2.TangentZ, StaticMeshVertex2.TangentX) * TangentsDirection;
-#endif
-						}
-					});
+			FglTFRuntimeVertexCacheStats LODStatsBefore;
+			FglTFRuntimeVertexCacheStats LODStatsAfter;
+			for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); SectionIndex++)
+			{
+				LODStatsBefore.Append(SectionsStatsBefore[SectionIndex]);
+				LODStatsAfter.Append(SectionsStatsAfter[SectionIndex]);
 			}
 
-			VertexInstanceBaseIndex += NumVertexInstancesPerSection;
-			VertexBaseIndex += Primitive.bHasIndices ? Primitive.Positions.Num() : Primitive.Indices.Num();
+			StaticMeshContext->VertexCacheStatsBefore.Append(LODStatsBefore);
+			StaticMeshContext->VertexCacheStatsAfter.Append(LODStatsAfter);
+
+			UE_LOG(LogGLTFRuntime, Log, TEXT("Optimized LOD %d vertex cache: ACMR %f -> %f ATVR %f -> %f"), CurrentLODIndex, LODStatsBefore.GetACMR(), LODStatsAfter.GetACMR(), LODStatsBefore.GetATVR(), LODStatsAfter.GetATVR());
 		}
 
 		// this is way more fast than doing it in the ParalellFor with a lock
@@ -927,10 +1171,59 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 	return StaticMesh;
 }
 
+TArray<FglTFRuntimeFinalizationStep> FglTFRuntimeParser::GetStaticMeshFinalizationSteps(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
+{
+	TArray<FglTFRuntimeFinalizationStep> Steps;
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeStaticMeshResources"), [StaticMeshContext]() { StaticMeshContext->Parser->FinalizeStaticMeshResources(StaticMeshContext); });
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeStaticMeshCollisions"), [StaticMeshContext]() { StaticMeshContext->Parser->FinalizeStaticMeshCollisions(StaticMeshContext); });
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeStaticMeshSockets"), [StaticMeshContext]() { StaticMeshContext->Parser->FinalizeStaticMeshSockets(StaticMeshContext); });
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeStaticMeshNavigation"), [StaticMeshContext]() { StaticMeshContext->Parser->FinalizeStaticMeshNavigation(StaticMeshContext); });
+	return Steps;
+}
+
 UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeStaticMesh, FColor::Magenta);
 
+	for (FglTFRuntimeFinalizationStep& Step : GetStaticMeshFinalizationSteps(StaticMeshContext))
+	{
+		Step.Function();
+	}
+
+	return StaticMeshContext->StaticMesh;
+}
+
+void FglTFRuntimeParser::FinalizeStaticMeshAsync(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext, TFunction<void()>&& OnFinalized)
+{
+	// a cancelled load still triggers the callback, but without a StaticMesh
+	if (FglTFRuntimeTaskQueue::IsCancelled(StaticMeshContext->CancellationFlag))
+	{
+		StaticMeshContext->StaticMesh = nullptr;
+	}
+
+	TArray<FglTFRuntimeFinalizationStep> Steps;
+	if (StaticMeshContext->StaticMesh)
+	{
+		Steps = GetStaticMeshFinalizationSteps(StaticMeshContext);
+	}
+
+	Steps.Emplace(TEXT("FglTFRuntimeParser_FinalizeStaticMeshAsync"), [StaticMeshContext, OnFinalized = MoveTemp(OnFinalized)]()
+		{
+			OnFinalized();
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
+			// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
+			StaticMeshContext->UnregisterGCObject();
+#endif
+		});
+
+	FglTFRuntimeFinalizationQueue::Get().Enqueue(MoveTemp(Steps));
+}
+
+void FglTFRuntimeParser::FinalizeStaticMeshResources(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeStaticMeshResources, FColor::Magenta);
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizeStaticMeshResources);
+
 	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
 	FStaticMeshRenderData* RenderData = StaticMeshContext->RenderData;
 	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
@@ -941,12 +1234,6 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 	StaticMesh->StaticMaterials = StaticMeshContext->StaticMaterials;
 #endif
 
-#if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MINOR_VERSION > 26)
-	UBodySetup* BodySetup = StaticMesh->GetBodySetup();
-#else
-	UBodySetup* BodySetup = StaticMesh->BodySetup;
-#endif
-
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
 	if (StaticMesh->bSupportRayTracing)
 	{
@@ -977,6 +1264,22 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 
 	RenderData->Bounds = StaticMeshContext->BoundingBoxAndSphere;
 	StaticMesh->CalculateExtendedBounds();
+}
+
+void FglTFRuntimeParser::FinalizeStaticMeshCollisions(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeStaticMeshCollisions, FColor::Magenta);
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizeStaticMeshCollisions);
+
+	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
+	FStaticMeshRenderData* RenderData = StaticMeshContext->RenderData;
+	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
+
+#if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MINOR_VERSION > 26)
+	UBodySetup* BodySetup = StaticMesh->GetBodySetup();
+#else
+	UBodySetup* BodySetup = StaticMesh->BodySetup;
+#endif
 
 	if (!BodySetup)
 	{
@@ -1041,6 +1344,15 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 	{
 		ActorComponent->RecreatePhysicsState();
 	}
+}
+
+void FglTFRuntimeParser::FinalizeStaticMeshSockets(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeStaticMeshSockets, FColor::Magenta);
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizeStaticMeshSockets);
+
+	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
+	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
 
 	for (const TPair<FString, FTransform>& Pair : StaticMeshConfig.Sockets)
 	{
@@ -1074,6 +1386,15 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 		Socket->RelativeLocation = -StaticMeshContext->LOD0PivotDelta;
 		StaticMesh->AddSocket(Socket);
 	}
+}
+
+void FglTFRuntimeParser::FinalizeStaticMeshNavigation(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeStaticMeshNavigation, FColor::Magenta);
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntime_FinalizeStaticMeshNavigation);
+
+	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
+	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
 
 	StaticMesh->bHasNavigationData = StaticMeshConfig.bBuildNavCollision;
 
@@ -1087,8 +1408,6 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 	OnStaticMeshCreated.Broadcast(StaticMesh);
 
 	FillAssetUserData(StaticMeshContext->MeshIndex, StaticMesh);
-
-	return StaticMesh;
 }
 
 bool FglTFRuntimeParser::LoadStaticMeshes(TArray<UStaticMesh*>& StaticMeshes, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
@@ -1113,26 +1432,18 @@ bool FglTFRuntimeParser::LoadStaticMeshes(TArray<UStaticMesh*>& StaticMeshes, co
 	return true;
 }
 
-bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bCompactVertexStreams)
 {
-	if (LODsCache.Contains(JsonMeshObject))
-	{
-		LOD = &LODsCache[JsonMeshObject];
-		return true;
-	}
+	// compact LODs can be consumed only by static meshes, so they are cached independently
+	TglTFRuntimeConcurrentCache<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD>& Cache = bCompactVertexStreams ? CompactLODsCache : LODsCache;
 
-	TArray<FglTFRuntimePrimitive> Primitives;
-	if (!LoadPrimitives(JsonMeshObject, Primitives, MaterialsConfig, true))
-	{
-		return false;
-	}
-
-	FglTFRuntimeMeshLOD NewLOD;
-	NewLOD.Primitives = MoveTemp(Primitives);
+	// the same mesh requested by multiple threads is loaded only once, the others wait for it
+	LOD = Cache.FindOrInit(JsonMeshObject, [&](FglTFRuntimeMeshLOD& NewLOD)
+		{
+			return LoadPrimitives(JsonMeshObject, NewLOD.Primitives, MaterialsConfig, true, bCompactVertexStreams);
+		});
 
-	FglTFRuntimeMeshLOD& CachedLOD = LODsCache.Add(JsonMeshObject, MoveTemp(NewLOD));
-	LOD = &CachedLOD;
-	return true;
+	return LOD != nullptr;
 }
 
 UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
@@ -1144,14 +1455,18 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const Fgl
 		return nullptr;
 	}
 
-	if (CanReadFromCache(StaticMeshConfig.CacheMode) && StaticMeshesCache.Contains(MeshIndex))
+	if (CanReadFromCache(StaticMeshConfig.CacheMode))
 	{
-		return StaticMeshesCache[MeshIndex];
+		FScopeLock Lock(&MeshesCacheLock);
+		if (StaticMeshesCache.Contains(MeshIndex))
+		{
+			return StaticMeshesCache[MeshIndex];
+		}
 	}
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, StaticMeshConfig);
 	FglTFRuntimeMeshLOD* LOD = nullptr;
-	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactVertexStreams))
 	{
 		return nullptr;
 	}
@@ -1171,6 +1486,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const Fgl
 
 	if (CanWriteToCache(StaticMeshConfig.CacheMode))
 	{
+		FScopeLock Lock(&MeshesCacheLock);
 		StaticMeshesCache.Add(MeshIndex, StaticMesh);
 	}
 
@@ -1188,7 +1504,7 @@ TArray<UStaticMesh*> FglTFRuntimeParser::LoadStaticMeshesFromPrimitives(const in
 	}
 
 	FglTFRuntimeMeshLOD* LOD = nullptr;
-	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactVertexStreams))
 	{
 		return StaticMeshes;
 	}
@@ -1235,7 +1551,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshLODs(const TArray<int32>& MeshInd
 
 		FglTFRuntimeMeshLOD* LOD = nullptr;
 
-		if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+		if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactVertexStreams))
 		{
 			return nullptr;
 		}
@@ -1255,7 +1571,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndices, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(StaticMeshConfig.AsyncPriority, StaticMeshContext->CancellationFlag, [this, StaticMeshContext, MeshIndices, AsyncCallback]()
 		{
 			bool bSuccess = true;
 			for (const int32 MeshIndex : MeshIndices)
@@ -1269,7 +1585,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 
 				FglTFRuntimeMeshLOD* LOD = nullptr;
 
-				if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig))
+				if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig, StaticMeshContext->StaticMeshConfig.bCompactVertexStreams))
 				{
 					bSuccess = false;
 					break;
@@ -1283,20 +1599,16 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FinalizeStaticMeshAsync(StaticMeshContext, [StaticMeshContext, AsyncCallback]()
 				{
-					if (StaticMeshContext->StaticMesh)
-					{
-						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
-					}
-
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
-					// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
-					StaticMeshContext->UnregisterGCObject();
-#endif
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				});
+		}, [this, StaticMeshContext, AsyncCallback]()
+		{
+			FinalizeStaticMeshAsync(StaticMeshContext, [StaticMeshContext, AsyncCallback]()
+				{
+					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
+				});
 		});
 }
 
@@ -1442,7 +1754,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshRecursive(const FString& NodeName
 			}
 
 			FglTFRuntimeMeshLOD* LOD = nullptr;
-			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactVertexStreams))
 			{
 				return nullptr;
 			}
@@ -1488,7 +1800,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(StaticMeshConfig.AsyncPriority, StaticMeshContext->CancellationFlag, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
 		{
 
 			FglTFRuntimeNode Node;
@@ -1545,7 +1857,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 					}
 
 					FglTFRuntimeMeshLOD* LOD = nullptr;
-					if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+					if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, StaticMeshConfig.bCompactVertexStreams))
 					{
 						return;
 					}
@@ -1578,20 +1890,19 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
-				{
-					if (StaticMeshContext->StaticMesh)
-					{
-						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
-					}
+			// the LODs are owned by this task, and are not required anymore by the finalization steps
+			StaticMeshContext->LODs.Empty();
 
+			FinalizeStaticMeshAsync(StaticMeshContext, [StaticMeshContext, AsyncCallback]()
+				{
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
-					// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
-					StaticMeshContext->UnregisterGCObject();
-#endif
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				});
+		}, [this, StaticMeshContext, AsyncCallback]()
+		{
+			FinalizeStaticMeshAsync(StaticMeshContext, [StaticMeshContext, AsyncCallback]()
+				{
+					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
+				});
 		});
 }
 
@@ -1635,7 +1946,7 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, RuntimeLODs, AsyncCallback]()
+	FglTFRuntimeTaskQueue::Get().Enqueue(StaticMeshConfig.AsyncPriority, StaticMeshContext->CancellationFlag, [this, StaticMeshContext, StaticMeshConfig, RuntimeLODs, AsyncCallback]()
 		{
 			for (const FglTFRuntimeMeshLOD& RuntimeLOD : RuntimeLODs)
 			{
@@ -1644,20 +1955,19 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
-				{
-					if (StaticMeshContext->StaticMesh)
-					{
-						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
-					}
+			// the LODs are owned by this task, and are not required anymore by the finalization steps
+			StaticMeshContext->LODs.Empty();
 
+			FinalizeStaticMeshAsync(StaticMeshContext, [StaticMeshContext, AsyncCallback]()
+				{
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
-					// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
-					StaticMeshContext->UnregisterGCObject();
-#endif
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				});
+		}, [this, StaticMeshContext, AsyncCallback]()
+		{
+			FinalizeStaticMeshAsync(StaticMeshContext, [StaticMeshContext, AsyncCallback]()
+				{
+					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
+				});
 		}
 	);
 }
\ No newline at end of file
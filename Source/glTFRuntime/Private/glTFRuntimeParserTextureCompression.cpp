@@ -0,0 +1,789 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "HAL/IConsoleManager.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+#define GLTFRUNTIME_BC_SSE 1
+#define GLTFRUNTIME_BC_NEON 0
+#include <emmintrin.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_64BITS
+#define GLTFRUNTIME_BC_SSE 0
+#define GLTFRUNTIME_BC_NEON 1
+#include <arm_neon.h>
+#else
+#define GLTFRUNTIME_BC_SSE 0
+#define GLTFRUNTIME_BC_NEON 0
+#endif
+
+static TAutoConsoleVariable<int32> CVarglTFRuntimeTextureCompressionSIMD(
+	TEXT("glTFRuntime.TextureCompressionSIMD"),
+	1,
+	TEXT("Use the SSE/NEON kernels for the runtime block compression of textures (0 forces the scalar path, useful for comparing them)."),
+	ECVF_Default);
+
+namespace glTFRuntime
+{
+	// 4x4 pixels, one array per RGBA channel (so that 4 pixels can be processed at once)
+	struct FBCBlock
+	{
+		float Channels[4][16];
+	};
+
+	// colors a block can be decoded to, only the channels being encoded are used
+	struct FBCPalette
+	{
+		float Colors[16][4];
+		int32 Num;
+	};
+
+	const int32 BC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	void LoadBCBlock(const uint8* Pixels, const int32 Width, const int32 Height, const int32 BlockX, const int32 BlockY, const int32 RedOffset, const int32 BlueOffset, FBCBlock& Block)
+	{
+		for (int32 Y = 0; Y < 4; Y++)
+		{
+			// blocks of the smallest mips are padded by replicating the edges
+			const int32 SourceY = FMath::Min(BlockY * 4 + Y, Height - 1);
+			for (int32 X = 0; X < 4; X++)
+			{
+				const int32 SourceX = FMath::Min(BlockX * 4 + X, Width - 1);
+				const uint8* Pixel = Pixels + (static_cast<int64>(SourceY) * Width + SourceX) * 4;
+				Block.Channels[0][Y * 4 + X] = Pixel[RedOffset];
+				Block.Channels[1][Y * 4 + X] = Pixel[1];
+				Block.Channels[2][Y * 4 + X] = Pixel[BlueOffset];
+				Block.Channels[3][Y * 4 + X] = Pixel[3];
+			}
+		}
+	}
+
+	// assign every pixel to the nearest palette color (on the specified channels), returns the total squared error
+	float FitBCPaletteScalar(const FBCBlock& Block, const int32 FirstChannel, const int32 NumChannels, const FBCPalette& Palette, uint8* Indices)
+	{
+		float TotalError = 0;
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+		{
+			float BestError = MAX_flt;
+			uint8 BestIndex = 0;
+			for (int32 PaletteIndex = 0; PaletteIndex < Palette.Num; PaletteIndex++)
+			{
+				float Error = 0;
+				for (int32 Channel = FirstChannel; Channel < FirstChannel + NumChannels; Channel++)
+				{
+					const float Delta = Block.Channels[Channel][PixelIndex] - Palette.Colors[PaletteIndex][Channel];
+					Error += Delta * Delta;
+				}
+				if (Error < BestError)
+				{
+					BestError = Error;
+					BestIndex = static_cast<uint8>(PaletteIndex);
+				}
+			}
+			Indices[PixelIndex] = BestIndex;
+			TotalError += BestError;
+		}
+		return TotalError;
+	}
+
+#if GLTFRUNTIME_BC_SSE
+	float FitBCPaletteSSE(const FBCBlock& Block, const int32 FirstChannel, const int32 NumChannels, const FBCPalette& Palette, uint8* Indices)
+	{
+		__m128 TotalError = _mm_setzero_ps();
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex += 4)
+		{
+			__m128 BestError = _mm_set1_ps(MAX_flt);
+			__m128 BestIndex = _mm_setzero_ps();
+			for (int32 PaletteIndex = 0; PaletteIndex < Palette.Num; PaletteIndex++)
+			{
+				__m128 Error = _mm_setzero_ps();
+				for (int32 Channel = FirstChannel; Channel < FirstChannel + NumChannels; Channel++)
+				{
+					const __m128 Delta = _mm_sub_ps(_mm_loadu_ps(&Block.Channels[Channel][PixelIndex]), _mm_set1_ps(Palette.Colors[PaletteIndex][Channel]));
+					Error = _mm_add_ps(Error, _mm_mul_ps(Delta, Delta));
+				}
+				// strictly less, so that ties resolve to the first color like the scalar path
+				const __m128 Mask = _mm_cmplt_ps(Error, BestError);
+				BestError = _mm_min_ps(Error, BestError);
+				BestIndex = _mm_or_ps(_mm_and_ps(Mask, _mm_set1_ps(static_cast<float>(PaletteIndex))), _mm_andnot_ps(Mask, BestIndex));
+			}
+			TotalError = _mm_add_ps(TotalError, BestError);
+
+			alignas(16) int32 Lanes[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(Lanes), _mm_cvttps_epi32(BestIndex));
+			for (int32 Lane = 0; Lane < 4; Lane++)
+			{
+				Indices[PixelIndex + Lane] = static_cast<uint8>(Lanes[Lane]);
+			}
+		}
+
+		alignas(16) float Errors[4];
+		_mm_store_ps(Errors, TotalError);
+		return Errors[0] + Errors[1] + Errors[2] + Errors[3];
+	}
+#endif
+
+#if GLTFRUNTIME_BC_NEON
+	float FitBCPaletteNEON(const FBCBlock& Block, const int32 FirstChannel, const int32 NumChannels, const FBCPalette& Palette, uint8* Indices)
+	{
+		float32x4_t TotalError = vdupq_n_f32(0);
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex += 4)
+		{
+			float32x4_t BestError = vdupq_n_f32(MAX_flt);
+			float32x4_t BestIndex = vdupq_n_f32(0);
+			for (int32 PaletteIndex = 0; PaletteIndex < Palette.Num; PaletteIndex++)
+			{
+				float32x4_t Error = vdupq_n_f32(0);
+				for (int32 Channel = FirstChannel; Channel < FirstChannel + NumChannels; Channel++)
+				{
+					const float32x4_t Delta = vsubq_f32(vld1q_f32(&Block.Channels[Channel][PixelIndex]), vdupq_n_f32(Palette.Colors[PaletteIndex][Channel]));
+					Error = vmlaq_f32(Error, Delta, Delta);
+				}
+				const uint32x4_t Mask = vcltq_f32(Error, BestError);
+				BestError = vminq_f32(Error, BestError);
+				BestIndex = vbslq_f32(Mask, vdupq_n_f32(static_cast<float>(PaletteIndex)), BestIndex);
+			}
+			TotalError = vaddq_f32(TotalError, BestError);
+
+			int32 Lanes[4];
+			vst1q_s32(Lanes, vcvtq_s32_f32(BestIndex));
+			for (int32 Lane = 0; Lane < 4; Lane++)
+			{
+				Indices[PixelIndex + Lane] = static_cast<uint8>(Lanes[Lane]);
+			}
+		}
+
+		return vaddvq_f32(TotalError);
+	}
+#endif
+
+	float FitBCPalette(const FBCBlock& Block, const int32 FirstChannel, const int32 NumChannels, const FBCPalette& Palette, uint8* Indices, const bool bUseSIMD)
+	{
+#if GLTFRUNTIME_BC_SSE
+		if (bUseSIMD)
+		{
+			return FitBCPaletteSSE(Block, FirstChannel, NumChannels, Palette, Indices);
+		}
+#elif GLTFRUNTIME_BC_NEON
+		if (bUseSIMD)
+		{
+			return FitBCPaletteNEON(Block, FirstChannel, NumChannels, Palette, Indices);
+		}
+#endif
+		return FitBCPaletteScalar(Block, FirstChannel, NumChannels, Palette, Indices);
+	}
+
+	// endpoints are the extremes of the block projected on its principal axis (found with a few power iterations on the covariance)
+	void ComputeBCEndpoints(const FBCBlock& Block, const int32 FirstChannel, const int32 NumChannels, float* Endpoint0, float* Endpoint1)
+	{
+		const int32 LastChannel = FirstChannel + NumChannels;
+
+		float Mean[4] = { 0, 0, 0, 0 };
+		float Min[4] = { 255, 255, 255, 255 };
+		float Max[4] = { 0, 0, 0, 0 };
+		for (int32 Channel = FirstChannel; Channel < LastChannel; Channel++)
+		{
+			for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+			{
+				const float Value = Block.Channels[Channel][PixelIndex];
+				Mean[Channel] += Value;
+				Min[Channel] = FMath::Min(Min[Channel], Value);
+				Max[Channel] = FMath::Max(Max[Channel], Value);
+			}
+			Mean[Channel] /= 16;
+		}
+
+		float Covariance[4][4] = {};
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+		{
+			for (int32 ChannelA = FirstChannel; ChannelA < LastChannel; ChannelA++)
+			{
+				const float DeltaA = Block.Channels[ChannelA][PixelIndex] - Mean[ChannelA];
+				for (int32 ChannelB = ChannelA; ChannelB < LastChannel; ChannelB++)
+				{
+					Covariance[ChannelA][ChannelB] += DeltaA * (Block.Channels[ChannelB][PixelIndex] - Mean[ChannelB]);
+				}
+			}
+		}
+		for (int32 ChannelA = FirstChannel; ChannelA < LastChannel; ChannelA++)
+		{
+			for (int32 ChannelB = FirstChannel; ChannelB < ChannelA; ChannelB++)
+			{
+				Covariance[ChannelA][ChannelB] = Covariance[ChannelB][ChannelA];
+			}
+		}
+
+		float Axis[4] = { 0, 0, 0, 0 };
+		for (int32 Channel = FirstChannel; Channel < LastChannel; Channel++)
+		{
+			Axis[Channel] = Max[Channel] - Min[Channel];
+		}
+
+		for (int32 Iteration = 0; Iteration < 8; Iteration++)
+		{
+			float NewAxis[4] = { 0, 0, 0, 0 };
+			float Scale = 0;
+			for (int32 ChannelA = FirstChannel; ChannelA < LastChannel; ChannelA++)
+			{
+				for (int32 ChannelB = FirstChannel; ChannelB < LastChannel; ChannelB++)
+				{
+					NewAxis[ChannelA] += Covariance[ChannelA][ChannelB] * Axis[ChannelB];
+				}
+				Scale = FMath::Max(Scale, FMath::Abs(NewAxis[ChannelA]));
+			}
+
+			if (Scale < KINDA_SMALL_NUMBER)
+			{
+				break;
+			}
+
+			for (int32 Channel = FirstChannel; Channel < LastChannel; Channel++)
+			{
+				Axis[Channel] = NewAxis[Channel] / Scale;
+			}
+		}
+
+		float Length = 0;
+		for (int32 Channel = FirstChannel; Channel < LastChannel; Channel++)
+		{
+			Length += Axis[Channel] * Axis[Channel];
+		}
+		Length = FMath::Sqrt(Length);
+
+		float MinT = 0;
+		float MaxT = 0;
+		if (Length > KINDA_SMALL_NUMBER)
+		{
+			MinT = MAX_flt;
+			MaxT = -MAX_flt;
+			for (int32 Channel = FirstChannel; Channel < LastChannel; Channel++)
+			{
+				Axis[Channel] /= Length;
+			}
+
+			for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+			{
+				float T = 0;
+				for (int32 Channel = FirstChannel; Channel < LastChannel; Channel++)
+				{
+					T += (Block.Channels[Channel][PixelIndex] - Mean[Channel]) * Axis[Channel];
+				}
+				MinT = FMath::Min(MinT, T);
+				MaxT = FMath::Max(MaxT, T);
+			}
+		}
+
+		for (int32 Channel = FirstChannel; Channel < LastChannel; Channel++)
+		{
+			Endpoint0[Channel] = FMath::Clamp(Mean[Channel] + Axis[Channel] * MinT, 0.0f, 255.0f);
+			Endpoint1[Channel] = FMath::Clamp(Mean[Channel] + Axis[Channel] * MaxT, 0.0f, 255.0f);
+		}
+	}
+
+	// least squares endpoints for the current indices (Weights maps an index to its interpolation factor)
+	bool RefineBCEndpoints(const FBCBlock& Block, const int32 FirstChannel, const int32 NumChannels, const uint8* Indices, const float* Weights, float* Endpoint0, float* Endpoint1)
+	{
+		float A = 0;
+		float B = 0;
+		float C = 0;
+		float X0[4] = { 0, 0, 0, 0 };
+		float X1[4] = { 0, 0, 0, 0 };
+
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+		{
+			const float T = Weights[Indices[PixelIndex]];
+			const float S = 1 - T;
+			A += S * S;
+			B += S * T;
+			C += T * T;
+			for (int32 Channel = FirstChannel; Channel < FirstChannel + NumChannels; Channel++)
+			{
+				X0[Channel] += S * Block.Channels[Channel][PixelIndex];
+				X1[Channel] += T * Block.Channels[Channel][PixelIndex];
+			}
+		}
+
+		const float Determinant = A * C - B * B;
+		if (FMath::Abs(Determinant) < KINDA_SMALL_NUMBER)
+		{
+			return false;
+		}
+
+		for (int32 Channel = FirstChannel; Channel < FirstChannel + NumChannels; Channel++)
+		{
+			Endpoint0[Channel] = FMath::Clamp((C * X0[Channel] - B * X1[Channel]) / Determinant, 0.0f, 255.0f);
+			Endpoint1[Channel] = FMath::Clamp((A * X1[Channel] - B * X0[Channel]) / Determinant, 0.0f, 255.0f);
+		}
+
+		return true;
+	}
+
+	uint16 QuantizeBC1Color(const float* Color)
+	{
+		const int32 R = FMath::Clamp(FMath::RoundToInt(Color[0] * 31.0f / 255.0f), 0, 31);
+		const int32 G = FMath::Clamp(FMath::RoundToInt(Color[1] * 63.0f / 255.0f), 0, 63);
+		const int32 B = FMath::Clamp(FMath::RoundToInt(Color[2] * 31.0f / 255.0f), 0, 31);
+		return static_cast<uint16>((R << 11) | (G << 5) | B);
+	}
+
+	void ExpandBC1Color(const uint16 Color, float* Expanded)
+	{
+		const int32 R = (Color >> 11) & 0x1F;
+		const int32 G = (Color >> 5) & 0x3F;
+		const int32 B = Color & 0x1F;
+		Expanded[0] = (R << 3) | (R >> 2);
+		Expanded[1] = (G << 2) | (G >> 4);
+		Expanded[2] = (B << 3) | (B >> 2);
+		Expanded[3] = 255;
+	}
+
+	float EncodeBC1Endpoints(const FBCBlock& Block, const float* Endpoint0, const float* Endpoint1, uint8* Output, uint8* Indices, const bool bUseSIMD)
+	{
+		uint16 Color0 = QuantizeBC1Color(Endpoint0);
+		uint16 Color1 = QuantizeBC1Color(Endpoint1);
+		// the 4 colors mode requires Color0 > Color1
+		if (Color0 < Color1)
+		{
+			Swap(Color0, Color1);
+		}
+
+		FBCPalette Palette;
+		ExpandBC1Color(Color0, Palette.Colors[0]);
+		ExpandBC1Color(Color1, Palette.Colors[1]);
+		if (Color0 == Color1)
+		{
+			Palette.Num = 1;
+		}
+		else
+		{
+			Palette.Num = 4;
+			for (int32 Channel = 0; Channel < 3; Channel++)
+			{
+				Palette.Colors[2][Channel] = (2 * Palette.Colors[0][Channel] + Palette.Colors[1][Channel]) / 3;
+				Palette.Colors[3][Channel] = (Palette.Colors[0][Channel] + 2 * Palette.Colors[1][Channel]) / 3;
+			}
+		}
+
+		const float Error = FitBCPalette(Block, 0, 3, Palette, Indices, bUseSIMD);
+
+		uint32 Bits = 0;
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+		{
+			Bits |= static_cast<uint32>(Indices[PixelIndex]) << (PixelIndex * 2);
+		}
+
+		Output[0] = Color0 & 0xFF;
+		Output[1] = Color0 >> 8;
+		Output[2] = Color1 & 0xFF;
+		Output[3] = Color1 >> 8;
+		for (int32 Byte = 0; Byte < 4; Byte++)
+		{
+			Output[4 + Byte] = (Bits >> (Byte * 8)) & 0xFF;
+		}
+
+		return Error;
+	}
+
+	void EncodeBC1Block(const FBCBlock& Block, uint8* Output, const bool bUseSIMD)
+	{
+		static const float Weights[4] = { 0, 1, 1.0f / 3, 2.0f / 3 };
+
+		float Endpoint0[4];
+		float Endpoint1[4];
+		ComputeBCEndpoints(Block, 0, 3, Endpoint0, Endpoint1);
+
+		uint8 Indices[16];
+		const float Error = EncodeBC1Endpoints(Block, Endpoint0, Endpoint1, Output, Indices, bUseSIMD);
+
+		// a least squares pass on the fitted indices recovers most of the error of the principal axis extremes
+		if (Error > 0 && RefineBCEndpoints(Block, 0, 3, Indices, Weights, Endpoint0, Endpoint1))
+		{
+			uint8 RefinedOutput[8];
+			uint8 RefinedIndices[16];
+			if (EncodeBC1Endpoints(Block, Endpoint0, Endpoint1, RefinedOutput, RefinedIndices, bUseSIMD) < Error)
+			{
+				FMemory::Memcpy(Output, RefinedOutput, 8);
+			}
+		}
+	}
+
+	float EncodeBC4Endpoints(const FBCBlock& Block, const int32 Channel, const float Endpoint0, const float Endpoint1, uint8* Output, uint8* Indices, const bool bUseSIMD)
+	{
+		uint8 Value0 = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Endpoint0), 0, 255));
+		uint8 Value1 = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Endpoint1), 0, 255));
+		// the 8 values mode requires Value0 > Value1
+		if (Value0 < Value1)
+		{
+			Swap(Value0, Value1);
+		}
+
+		FBCPalette Palette;
+		Palette.Colors[0][Channel] = Value0;
+		Palette.Colors[1][Channel] = Value1;
+		if (Value0 == Value1)
+		{
+			Palette.Num = 1;
+		}
+		else
+		{
+			Palette.Num = 8;
+			for (int32 Step = 1; Step < 7; Step++)
+			{
+				Palette.Colors[Step + 1][Channel] = ((7 - Step) * Value0 + Step * Value1) / 7.0f;
+			}
+		}
+
+		const float Error = FitBCPalette(Block, Channel, 1, Palette, Indices, bUseSIMD);
+
+		uint64 Bits = 0;
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+		{
+			Bits |= static_cast<uint64>(Indices[PixelIndex]) << (PixelIndex * 3);
+		}
+
+		Output[0] = Value0;
+		Output[1] = Value1;
+		for (int32 Byte = 0; Byte < 6; Byte++)
+		{
+			Output[2 + Byte] = (Bits >> (Byte * 8)) & 0xFF;
+		}
+
+		return Error;
+	}
+
+	void EncodeBC4Block(const FBCBlock& Block, const int32 Channel, uint8* Output, const bool bUseSIMD)
+	{
+		static const float Weights[8] = { 0, 1, 1.0f / 7, 2.0f / 7, 3.0f / 7, 4.0f / 7, 5.0f / 7, 6.0f / 7 };
+
+		float Min = 255;
+		float Max = 0;
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+		{
+			Min = FMath::Min(Min, Block.Channels[Channel][PixelIndex]);
+			Max = FMath::Max(Max, Block.Channels[Channel][PixelIndex]);
+		}
+
+		uint8 Indices[16];
+		const float Error = EncodeBC4Endpoints(Block, Channel, Max, Min, Output, Indices, bUseSIMD);
+
+		float Endpoint0[4];
+		float Endpoint1[4];
+		if (Error > 0 && RefineBCEndpoints(Block, Channel, 1, Indices, Weights, Endpoint0, Endpoint1))
+		{
+			uint8 RefinedOutput[8];
+			uint8 RefinedIndices[16];
+			if (EncodeBC4Endpoints(Block, Channel, Endpoint0[Channel], Endpoint1[Channel], RefinedOutput, RefinedIndices, bUseSIMD) < Error)
+			{
+				FMemory::Memcpy(Output, RefinedOutput, 8);
+			}
+		}
+	}
+
+	void EncodeBC3Block(const FBCBlock& Block, uint8* Output, const bool bUseSIMD)
+	{
+		EncodeBC4Block(Block, 3, Output, bUseSIMD);
+		EncodeBC1Block(Block, Output + 8, bUseSIMD);
+	}
+
+	void EncodeBC5Block(const FBCBlock& Block, uint8* Output, const bool bUseSIMD)
+	{
+		EncodeBC4Block(Block, 0, Output, bUseSIMD);
+		EncodeBC4Block(Block, 1, Output + 8, bUseSIMD);
+	}
+
+	struct FBC7BitWriter
+	{
+		uint8* Output;
+		int32 Offset;
+
+		FBC7BitWriter(uint8* InOutput) : Output(InOutput), Offset(0)
+		{
+			FMemory::Memzero(Output, 16);
+		}
+
+		void Write(const uint32 Value, const int32 NumBits)
+		{
+			for (int32 Bit = 0; Bit < NumBits; Bit++, Offset++)
+			{
+				if ((Value >> Bit) & 1)
+				{
+					Output[Offset >> 3] |= 1 << (Offset & 7);
+				}
+			}
+		}
+	};
+
+	// 7 bits per channel plus a shared (per endpoint) lowest bit, opaque blocks force it to 1 for keeping alpha at 255
+	void QuantizeBC7Mode6Endpoint(const float* Endpoint, const bool bOpaque, uint8* Quantized, uint8& PBit)
+	{
+		float BestError = MAX_flt;
+		for (int32 Bit = bOpaque ? 1 : 0; Bit < 2; Bit++)
+		{
+			uint8 Values[4];
+			float Error = 0;
+			for (int32 Channel = 0; Channel < 4; Channel++)
+			{
+				const int32 Value = FMath::Clamp(FMath::RoundToInt((Endpoint[Channel] - Bit) * 0.5f), 0, 127);
+				Error += FMath::Square(static_cast<float>((Value << 1) | Bit) - Endpoint[Channel]);
+				Values[Channel] = static_cast<uint8>(Value);
+			}
+
+			if (Error < BestError)
+			{
+				BestError = Error;
+				FMemory::Memcpy(Quantized, Values, 4);
+				PBit = static_cast<uint8>(Bit);
+			}
+		}
+	}
+
+	float EncodeBC7Mode6Endpoints(const FBCBlock& Block, const float* Endpoint0, const float* Endpoint1, const bool bOpaque, uint8* Output, uint8* Indices, const bool bUseSIMD)
+	{
+		uint8 Quantized0[4];
+		uint8 Quantized1[4];
+		uint8 PBit0 = 0;
+		uint8 PBit1 = 0;
+		QuantizeBC7Mode6Endpoint(Endpoint0, bOpaque, Quantized0, PBit0);
+		QuantizeBC7Mode6Endpoint(Endpoint1, bOpaque, Quantized1, PBit1);
+
+		FBCPalette Palette;
+		Palette.Num = 16;
+		for (int32 PaletteIndex = 0; PaletteIndex < 16; PaletteIndex++)
+		{
+			for (int32 Channel = 0; Channel < 4; Channel++)
+			{
+				const int32 Value0 = (Quantized0[Channel] << 1) | PBit0;
+				const int32 Value1 = (Quantized1[Channel] << 1) | PBit1;
+				Palette.Colors[PaletteIndex][Channel] = ((64 - BC7Weights[PaletteIndex]) * Value0 + BC7Weights[PaletteIndex] * Value1 + 32) >> 6;
+			}
+		}
+
+		const float Error = FitBCPalette(Block, 0, 4, Palette, Indices, bUseSIMD);
+
+		// the first index is stored without its highest bit, swapping the endpoints (the weights are symmetric) ensures it is zero
+		if (Indices[0] & 0x8)
+		{
+			for (int32 Channel = 0; Channel < 4; Channel++)
+			{
+				Swap(Quantized0[Channel], Quantized1[Channel]);
+			}
+			Swap(PBit0, PBit1);
+			for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+			{
+				Indices[PixelIndex] = 15 - Indices[PixelIndex];
+			}
+		}
+
+		FBC7BitWriter Writer(Output);
+		// mode 6
+		Writer.Write(1 << 6, 7);
+		for (int32 Channel = 0; Channel < 4; Channel++)
+		{
+			Writer.Write(Quantized0[Channel], 7);
+			Writer.Write(Quantized1[Channel], 7);
+		}
+		Writer.Write(PBit0, 1);
+		Writer.Write(PBit1, 1);
+		Writer.Write(Indices[0], 3);
+		for (int32 PixelIndex = 1; PixelIndex < 16; PixelIndex++)
+		{
+			Writer.Write(Indices[PixelIndex], 4);
+		}
+
+		return Error;
+	}
+
+	// single subset RGBA (mode 6) only: the best quality/speed trade-off for a runtime encoder, the other modes are left to offline tools
+	void EncodeBC7Block(const FBCBlock& Block, uint8* Output, const bool bUseSIMD)
+	{
+		static const float Weights[16] = {
+			0 / 64.0f, 4 / 64.0f, 9 / 64.0f, 13 / 64.0f, 17 / 64.0f, 21 / 64.0f, 26 / 64.0f, 30 / 64.0f,
+			34 / 64.0f, 38 / 64.0f, 43 / 64.0f, 47 / 64.0f, 51 / 64.0f, 55 / 64.0f, 60 / 64.0f, 64 / 64.0f };
+
+		bool bOpaque = true;
+		for (int32 PixelIndex = 0; PixelIndex < 16; PixelIndex++)
+		{
+			if (Block.Channels[3][PixelIndex] < 255)
+			{
+				bOpaque = false;
+				break;
+			}
+		}
+
+		const int32 NumChannels = bOpaque ? 3 : 4;
+
+		float Endpoint0[4] = { 0, 0, 0, 255 };
+		float Endpoint1[4] = { 0, 0, 0, 255 };
+		ComputeBCEndpoints(Block, 0, NumChannels, Endpoint0, Endpoint1);
+
+		uint8 Indices[16];
+		const float Error = EncodeBC7Mode6Endpoints(Block, Endpoint0, Endpoint1, bOpaque, Output, Indices, bUseSIMD);
+
+		if (Error > 0 && RefineBCEndpoints(Block, 0, NumChannels, Indices, Weights, Endpoint0, Endpoint1))
+		{
+			uint8 RefinedOutput[16];
+			uint8 RefinedIndices[16];
+			if (EncodeBC7Mode6Endpoints(Block, Endpoint0, Endpoint1, bOpaque, RefinedOutput, RefinedIndices, bUseSIMD) < Error)
+			{
+				FMemory::Memcpy(Output, RefinedOutput, 16);
+			}
+		}
+	}
+}
+
+bool FglTFRuntimeParser::CompressMips(TArray<FglTFRuntimeMipMap>& Mips, const FglTFRuntimeImagesConfig& ImagesConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_CompressMips, FColor::Magenta);
+
+	if (Mips.Num() == 0)
+	{
+		return false;
+	}
+
+	const EPixelFormat SourcePixelFormat = Mips[0].PixelFormat;
+	if (SourcePixelFormat != EPixelFormat::PF_B8G8R8A8 && SourcePixelFormat != EPixelFormat::PF_R8G8B8A8)
+	{
+		return false;
+	}
+
+	// the first mip of block compressed textures needs to be aligned to the 4x4 blocks (the smaller ones are padded)
+	if (Mips[0].Width <= 0 || Mips[0].Height <= 0 || (Mips[0].Width % 4) != 0 || (Mips[0].Height % 4) != 0)
+	{
+		return false;
+	}
+
+	for (const FglTFRuntimeMipMap& MipMap : Mips)
+	{
+		if (MipMap.PixelFormat != SourcePixelFormat || MipMap.Width <= 0 || MipMap.Height <= 0 || MipMap.Pixels.Num() != static_cast<int64>(MipMap.Width) * MipMap.Height * 4)
+		{
+			return false;
+		}
+	}
+
+	EglTFRuntimeBlockCompression BlockCompression = ImagesConfig.BlockCompression;
+	if (BlockCompression == EglTFRuntimeBlockCompression::Auto)
+	{
+		switch (ImagesConfig.Compression)
+		{
+		case TextureCompressionSettings::TC_Normalmap:
+			BlockCompression = EglTFRuntimeBlockCompression::BC5;
+			break;
+		case TextureCompressionSettings::TC_Grayscale:
+			BlockCompression = EglTFRuntimeBlockCompression::BC4;
+			break;
+		case TextureCompressionSettings::TC_BC7:
+			BlockCompression = EglTFRuntimeBlockCompression::BC7;
+			break;
+		case TextureCompressionSettings::TC_VectorDisplacementmap:
+		case TextureCompressionSettings::TC_EditorIcon:
+			// those are uncompressed by design
+			return false;
+		default:
+		{
+			BlockCompression = EglTFRuntimeBlockCompression::BC1;
+			const uint8* Pixels = Mips[0].Pixels.GetData();
+			for (int64 PixelIndex = 3; PixelIndex < Mips[0].Pixels.Num(); PixelIndex += 4)
+			{
+				if (Pixels[PixelIndex] < 255)
+				{
+					BlockCompression = EglTFRuntimeBlockCompression::BC3;
+					break;
+				}
+			}
+		}
+		break;
+		}
+	}
+
+	EPixelFormat PixelFormat = EPixelFormat::PF_Unknown;
+	switch (BlockCompression)
+	{
+	case EglTFRuntimeBlockCompression::BC1:
+		PixelFormat = EPixelFormat::PF_DXT1;
+		break;
+	case EglTFRuntimeBlockCompression::BC3:
+		PixelFormat = EPixelFormat::PF_DXT5;
+		break;
+	case EglTFRuntimeBlockCompression::BC4:
+		PixelFormat = EPixelFormat::PF_BC4;
+		break;
+	case EglTFRuntimeBlockCompression::BC5:
+		PixelFormat = EPixelFormat::PF_BC5;
+		break;
+	case EglTFRuntimeBlockCompression::BC7:
+		PixelFormat = EPixelFormat::PF_BC7;
+		break;
+	default:
+		return false;
+	}
+
+	if (!GPixelFormats[PixelFormat].Supported)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Pixel format %s is not supported by the current RHI, mips will not be compressed"), GPixelFormats[PixelFormat].Name);
+		return false;
+	}
+
+	const int32 BlockBytes = GPixelFormats[PixelFormat].BlockBytes;
+	const int32 RedOffset = SourcePixelFormat == EPixelFormat::PF_B8G8R8A8 ? 2 : 0;
+	const int32 BlueOffset = SourcePixelFormat == EPixelFormat::PF_B8G8R8A8 ? 0 : 2;
+	const bool bUseSIMD = CVarglTFRuntimeTextureCompressionSIMD.GetValueOnAnyThread() != 0;
+
+	// every task compresses a row of blocks, rows of all the mips are mixed together so that the small ones do not serialize the work
+	TArray<int32> MipsFirstRow;
+	TArray<TArray64<uint8>> CompressedMips;
+	CompressedMips.AddDefaulted(Mips.Num());
+	int32 NumRows = 0;
+	for (int32 MipIndex = 0; MipIndex < Mips.Num(); MipIndex++)
+	{
+		const int32 NumBlocksX = FMath::DivideAndRoundUp(Mips[MipIndex].Width, 4);
+		const int32 NumBlocksY = FMath::DivideAndRoundUp(Mips[MipIndex].Height, 4);
+		MipsFirstRow.Add(NumRows);
+		NumRows += NumBlocksY;
+		CompressedMips[MipIndex].AddUninitialized(static_cast<int64>(NumBlocksX) * NumBlocksY * BlockBytes);
+	}
+
+	ParallelFor(NumRows, [&](const int32 Row)
+		{
+			int32 MipIndex = MipsFirstRow.Num() - 1;
+			while (MipsFirstRow[MipIndex] > Row)
+			{
+				MipIndex--;
+			}
+
+			const FglTFRuntimeMipMap& MipMap = Mips[MipIndex];
+			const int32 NumBlocksX = FMath::DivideAndRoundUp(MipMap.Width, 4);
+			const int32 BlockY = Row - MipsFirstRow[MipIndex];
+			uint8* Output = CompressedMips[MipIndex].GetData() + static_cast<int64>(BlockY) * NumBlocksX * BlockBytes;
+
+			glTFRuntime::FBCBlock Block;
+			for (int32 BlockX = 0; BlockX < NumBlocksX; BlockX++, Output += BlockBytes)
+			{
+				glTFRuntime::LoadBCBlock(MipMap.Pixels.GetData(), MipMap.Width, MipMap.Height, BlockX, BlockY, RedOffset, BlueOffset, Block);
+				switch (BlockCompression)
+				{
+				case EglTFRuntimeBlockCompression::BC1:
+					glTFRuntime::EncodeBC1Block(Block, Output, bUseSIMD);
+					break;
+				case EglTFRuntimeBlockCompression::BC3:
+					glTFRuntime::EncodeBC3Block(Block, Output, bUseSIMD);
+					break;
+				case EglTFRuntimeBlockCompression::BC4:
+					glTFRuntime::EncodeBC4Block(Block, 0, Output, bUseSIMD);
+					break;
+				case EglTFRuntimeBlockCompression::BC5:
+					glTFRuntime::EncodeBC5Block(Block, Output, bUseSIMD);
+					break;
+				default:
+					glTFRuntime::EncodeBC7Block(Block, Output, bUseSIMD);
+					break;
+				}
+			}
+		});
+
+	for (int32 MipIndex = 0; MipIndex < Mips.Num(); MipIndex++)
+	{
+		Mips[MipIndex].Pixels = MoveTemp(CompressedMips[MipIndex]);
+		Mips[MipIndex].PixelFormat = PixelFormat;
+	}
+
+	return true;
+}
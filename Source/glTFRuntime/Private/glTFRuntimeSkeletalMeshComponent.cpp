@@ -72,8 +72,8 @@ bool UglTFRuntimeSkeletalMeshComponent::GetPhysicsTriMeshData(struct FTriMeshCol
 	{
 		for (uint32 Index = 0; Index < Section.NumTriangles; Index++)
 		{
-			const int32 TriangleIndex = Section.BaseIndex + Index;
-			const uint32 VertexIndex = Index * 3;
+			const int32 TriangleIndex = Section.BaseIndex / 3 + Index;
+			const uint32 VertexIndex = Section.BaseIndex + Index * 3;
 			CollisionData->Indices[TriangleIndex].v0 = IndexBuffer->Get(VertexIndex);
 			CollisionData->Indices[TriangleIndex].v1 = IndexBuffer->Get(VertexIndex + 1);
 			CollisionData->Indices[TriangleIndex].v2 = IndexBuffer->Get(VertexIndex + 2);
@@ -0,0 +1,213 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeTaskQueue.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+
+DEFINE_STAT(STAT_glTFRuntime_QueuedTasks);
+DEFINE_STAT(STAT_glTFRuntime_InFlightTasks);
+
+static TAutoConsoleVariable<int32> CVarglTFRuntimeMaxConcurrentTasks(
+	TEXT("glTFRuntime.MaxConcurrentTasks"),
+	0,
+	TEXT("Max number of glTFRuntime async loaders running at the same time (0 for half of the available cores). The thread pool is sized on startup, so higher values are clamped to it."),
+	ECVF_Default);
+
+UglTFRuntimeCancellationToken::UglTFRuntimeCancellationToken()
+{
+	Flag = MakeShared<FglTFRuntimeCancellationFlag, ESPMode::ThreadSafe>();
+}
+
+void UglTFRuntimeCancellationToken::Cancel()
+{
+	Flag->Cancel();
+}
+
+bool UglTFRuntimeCancellationToken::IsCancelled() const
+{
+	return Flag->IsCancelled();
+}
+
+FglTFRuntimeTaskQueue& FglTFRuntimeTaskQueue::Get()
+{
+	static FglTFRuntimeTaskQueue Queue;
+	return Queue;
+}
+
+void FglTFRuntimeTaskQueue::Startup()
+{
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		return;
+	}
+
+	NumThreads = CVarglTFRuntimeMaxConcurrentTasks.GetValueOnAnyThread();
+	if (NumThreads <= 0)
+	{
+		NumThreads = FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 2);
+	}
+
+	ThreadPool = FQueuedThreadPool::Allocate();
+	// parsers could recurse a lot (nodes hierarchies), so stay on the safe side with the stack size
+	if (!ThreadPool->Create(NumThreads, 1024 * 1024, TPri_Normal, TEXT("glTFRuntimeThreadPool")))
+	{
+		delete ThreadPool;
+		ThreadPool = nullptr;
+		NumThreads = 0;
+	}
+}
+
+void FglTFRuntimeTaskQueue::Shutdown()
+{
+	TArray<FTask> DiscardedTasks;
+
+	{
+		FScopeLock Lock(&TasksLock);
+
+		for (TArray<FTask>& PriorityTasks : Tasks)
+		{
+			DiscardedTasks.Append(MoveTemp(PriorityTasks));
+			PriorityTasks.Empty();
+		}
+		SET_DWORD_STAT(STAT_glTFRuntime_QueuedTasks, 0);
+
+		// running tasks could wait for the game thread, so destroying the pool here could deadlock
+		if (ThreadPool && NumInFlightTasks == 0)
+		{
+			ThreadPool->Destroy();
+			delete ThreadPool;
+		}
+		ThreadPool = nullptr;
+	}
+
+	// discarded tasks are cancelled ones, so their callbacks are still triggered (out of the lock, they could enqueue again)
+	for (FTask& Task : DiscardedTasks)
+	{
+		if (Task.OnCancelled)
+		{
+			Task.OnCancelled();
+		}
+	}
+}
+
+int32 FglTFRuntimeTaskQueue::GetMaxConcurrentTasks() const
+{
+	const int32 MaxConcurrentTasks = CVarglTFRuntimeMaxConcurrentTasks.GetValueOnAnyThread();
+	if (MaxConcurrentTasks <= 0)
+	{
+		return NumThreads;
+	}
+	return FMath::Min(MaxConcurrentTasks, NumThreads);
+}
+
+void FglTFRuntimeTaskQueue::Enqueue(const EglTFRuntimeTaskPriority Priority, FglTFRuntimeCancellationFlagPtr CancellationFlag, TFunction<void()>&& Work, TFunction<void()>&& OnCancelled)
+{
+	FTask Task;
+	Task.CancellationFlag = CancellationFlag;
+	Task.Work = MoveTemp(Work);
+	Task.OnCancelled = MoveTemp(OnCancelled);
+
+	bool bQueued = false;
+	{
+		FScopeLock Lock(&TasksLock);
+		if (ThreadPool)
+		{
+			Tasks[static_cast<uint8>(Priority)].Add(MoveTemp(Task));
+			INC_DWORD_STAT(STAT_glTFRuntime_QueuedTasks);
+			bQueued = true;
+		}
+	}
+
+	if (!bQueued)
+	{
+		// no thread pool available (e.g. the module is shutting down or no multithreading support), fallback to a dedicated thread
+		Async(EAsyncExecution::Thread, [this, Task]() mutable
+			{
+				RunTask(Task);
+			});
+		return;
+	}
+
+	DispatchTasks();
+}
+
+void FglTFRuntimeTaskQueue::DispatchTasks()
+{
+	TArray<FTask> TasksToRun;
+	FQueuedThreadPool* CurrentThreadPool = nullptr;
+
+	{
+		FScopeLock Lock(&TasksLock);
+		if (!ThreadPool)
+		{
+			return;
+		}
+
+		const int32 MaxConcurrentTasks = GetMaxConcurrentTasks();
+
+		for (int32 PriorityIndex = UE_ARRAY_COUNT(Tasks) - 1; PriorityIndex >= 0; PriorityIndex--)
+		{
+			while (NumInFlightTasks < MaxConcurrentTasks && Tasks[PriorityIndex].Num() > 0)
+			{
+				TasksToRun.Add(MoveTemp(Tasks[PriorityIndex][0]));
+				Tasks[PriorityIndex].RemoveAt(0);
+				NumInFlightTasks++;
+				DEC_DWORD_STAT(STAT_glTFRuntime_QueuedTasks);
+				INC_DWORD_STAT(STAT_glTFRuntime_InFlightTasks);
+			}
+		}
+
+		CurrentThreadPool = ThreadPool;
+	}
+
+	for (FTask& Task : TasksToRun)
+	{
+		AsyncPool(*CurrentThreadPool, [this, Task = MoveTemp(Task)]() mutable
+			{
+				RunTask(Task);
+
+				{
+					FScopeLock Lock(&TasksLock);
+					NumInFlightTasks--;
+					DEC_DWORD_STAT(STAT_glTFRuntime_InFlightTasks);
+				}
+
+				DispatchTasks();
+			});
+	}
+}
+
+void FglTFRuntimeTaskQueue::RunTask(FTask& Task)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeTaskQueue_RunTask, FColor::Magenta);
+
+	if (IsCancelled(Task.CancellationFlag))
+	{
+		if (Task.OnCancelled)
+		{
+			Task.OnCancelled();
+		}
+		return;
+	}
+
+	Task.Work();
+}
+
+int32 FglTFRuntimeTaskQueue::GetNumQueuedTasks() const
+{
+	FScopeLock Lock(&TasksLock);
+	int32 NumQueuedTasks = 0;
+	for (const TArray<FTask>& PriorityTasks : Tasks)
+	{
+		NumQueuedTasks += PriorityTasks.Num();
+	}
+	return NumQueuedTasks;
+}
+
+int32 FglTFRuntimeTaskQueue::GetNumInFlightTasks() const
+{
+	FScopeLock Lock(&TasksLock);
+	return NumInFlightTasks;
+}
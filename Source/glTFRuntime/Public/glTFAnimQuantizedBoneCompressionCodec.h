@@ -0,0 +1,80 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFAnimBoneCompressionCodec.h"
+#include "glTFAnimQuantizedBoneCompressionCodec.generated.h"
+
+struct FglTFAnimQuantizedCompressionStats
+{
+	int64 RawSize = 0;
+	int64 CompressedSize = 0;
+	int32 NumConstantChannels = 0;
+	int32 NumSourceKeys = 0;
+	int32 NumKeys = 0;
+	float MaxTranslationError = 0;
+	float MaxRotationError = 0;
+	float MaxScaleError = 0;
+
+	float GetCompressionRatio() const
+	{
+		return CompressedSize > 0 ? static_cast<float>(RawSize) / static_cast<float>(CompressedSize) : 0;
+	}
+};
+
+/**
+ * Bone codec storing keyframe-reduced tracks: constant channels are stored once,
+ * rotations are packed as smallest-three (48 bits per key) and translations/scales
+ * as 16 bit values inside a per-channel range.
+ */
+UCLASS()
+class GLTFRUNTIME_API UglTFAnimQuantizedBoneCompressionCodec : public UglTFAnimBoneCompressionCodec
+{
+	GENERATED_BODY()
+
+public:
+	virtual void DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const override;
+	virtual void DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const override;
+
+	/**
+	 * Builds the compressed channels from Tracks (that are released on completion).
+	 * Tolerances are in world units for translations, degrees for rotations and absolute value for scales.
+	 */
+	FglTFAnimQuantizedCompressionStats Compress(const float TranslationTolerance, const float RotationTolerance, const float ScaleTolerance);
+
+protected:
+	struct FChannel
+	{
+		// index of the first key in Frames (and of its packed value in Values, multiplied by 3)
+		int32 FirstKey = 0;
+		int32 NumKeys = 0;
+		// keys count of the original track, used for mapping time to frames
+		int32 NumSourceKeys = 0;
+		float RangeMin[3] = { 0, 0, 0 };
+		float RangeExtent[3] = { 0, 0, 0 };
+	};
+
+	void ReduceChannel(FChannel& Channel, const int32 NumSourceKeys, const bool bConstant, TFunctionRef<bool(const int32 FirstFrame, const int32 LastFrame)> IsSegmentValid);
+	void QuantizeVectorChannel(FChannel& Channel, TFunctionRef<FVector(const int32 Frame)> GetValue);
+	void QuantizeRotationChannel(FChannel& Channel, TFunctionRef<FQuat(const int32 Frame)> GetValue);
+
+	float GetChannelKeys(const FChannel& Channel, const float RelativePos, const EAnimInterpolationType Interpolation, int32& KeyA, int32& KeyB) const;
+
+	FQuat DecodeRotation(const FChannel& Channel, const float RelativePos, const EAnimInterpolationType Interpolation) const;
+	FVector DecodeVector(const FChannel& Channel, const float RelativePos, const EAnimInterpolationType Interpolation, const FVector& DefaultValue) const;
+
+	FQuat DequantizeRotation(const int32 Key) const;
+	FVector DequantizeVector(const FChannel& Channel, const int32 Key) const;
+
+	bool bCompressed = false;
+
+	TArray<FChannel> RotationChannels;
+	TArray<FChannel> TranslationChannels;
+	TArray<FChannel> ScaleChannels;
+
+	// original frame index of each kept key
+	TArray<uint16> Frames;
+	// 3 x 16 bit values for each kept key
+	TArray<uint16> Values;
+};
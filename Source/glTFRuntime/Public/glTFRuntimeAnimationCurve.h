@@ -29,6 +29,26 @@ class GLTFRUNTIME_API UglTFRuntimeAnimationCurve : public UCurveBase
     TArray<TPair<float, FQuat>> ConvertedQuaternions;
     bool bIsStepped;
 
+    // keys baked in contiguous arrays for fast (and thread safe) sampling
+    struct FBakedTimeline
+    {
+        TArray<float> Times;
+        TArray<FVector4> Values;
+        TArray<bool> Steps;
+        FVector4 DefaultValue;
+
+        bool GetKeys(const float InTime, int32& FirstIndex, int32& SecondIndex, float& Alpha) const;
+    };
+
+    FBakedTimeline BakedLocations;
+    FBakedTimeline BakedRotations;
+    FBakedTimeline BakedScales;
+    FMatrix BakedBasisMatrixInverse;
+    float BakedMinTime;
+    bool bBaked;
+
+    void BakeVectorCurves(const FRichCurve* Curves, FBakedTimeline& Timeline) const;
+
     // Begin FCurveOwnerInterface
     virtual TArray<FRichCurveEditInfoConst> GetCurves() const override;
     virtual TArray<FRichCurveEditInfo> GetCurves() override;
@@ -62,4 +82,15 @@ public:
     void AddScaleValue(const float InTime, const FVector InScale, const ERichCurveInterpMode InterpolationMode);
     void SetDefaultValues(const FVector Location, const FQuat Quat, const FRotator Rotator, const FVector Scale);
     void AddConvertedQuaternion(const float InTime, const FQuat InQuat, const bool bStep);
+
+    /** Bake all of the keys for GetBakedTransformValue(), must be called again after adding new keys */
+    void Bake();
+
+    bool IsBaked() const { return bBaked; }
+
+    /** Same as GetTransformValue() but using the baked keys, safe to be called from any thread */
+    FTransform GetBakedTransformValue(const float InTime) const;
+
+    /** Lowest time of the curves (as reported by GetTimeRange()) cached by Bake() */
+    float GetBakedMinTime() const { return BakedMinTime; }
 };
@@ -29,6 +29,15 @@ protected:
 
 	TMap<USceneComponent*, TMap<FString, UglTFRuntimeAnimationCurve*>> DiscoveredCurveAnimations;
 
+	// CurveBasedAnimations flattened every tick for batched (parallel) evaluation
+	TArray<USceneComponent*> CurveAnimationsComponents;
+	TArray<UglTFRuntimeAnimationCurve*> CurveAnimationsCurves;
+	TArray<float> CurveAnimationsTimes;
+	TArray<FTransform> CurveAnimationsTransforms;
+	// index of the closest animated ancestor (INDEX_NONE if none)
+	TArray<int32> CurveAnimationsParents;
+	TBitArray<> CurveAnimationsUpdated;
+
 	template<typename T>
 	FName GetSafeNodeName(const FglTFRuntimeNode& Node)
 	{
@@ -7,6 +7,34 @@
 #include "glTFRuntimeAsset.h"
 #include "glTFRuntimeAssetActorAsync.generated.h"
 
+class AglTFRuntimeAssetActorAsync;
+
+/**
+ * A single in-flight mesh load of AglTFRuntimeAssetActorAsync (dynamic delegates cannot carry the target component)
+ */
+UCLASS()
+class GLTFRUNTIME_API UglTFRuntimeAssetActorAsyncMeshRequest : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	UPrimitiveComponent* PrimitiveComponent;
+
+	UPROPERTY()
+	UObject* Mesh;
+
+	FglTFRuntimeNode Node;
+
+	TWeakObjectPtr<AglTFRuntimeAssetActorAsync> Actor;
+
+	UFUNCTION()
+	void OnStaticMeshLoaded(UStaticMesh* StaticMesh);
+
+	UFUNCTION()
+	void OnSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh);
+};
+
 UCLASS()
 class GLTFRUNTIME_API AglTFRuntimeAssetActorAsync : public AActor
 {
@@ -74,22 +102,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
 	FglTFRuntimeLightConfig LightConfig;
 
+	// max number of meshes decoded at the same time (they share the parser caches, which are all locked, and every skeletal mesh works on its own copy of the cached LODs)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
+	int32 MaxConcurrentMeshLoads;
+
+	// max milliseconds per frame spent assigning loaded meshes to their components (at least one is assigned per frame)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
+	float MeshesFinalizationBudget;
+
+	// load the meshes closest to the camera first
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
+	bool bPrioritizeByCameraDistance;
+
+	virtual void Tick(float DeltaTime) override;
+
+	void OnMeshLoaded(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest);
+
 private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"), Category="glTFRuntime")
 	USceneComponent* AssetRoot;
 
-	TMap<UPrimitiveComponent*, FglTFRuntimeNode> MeshesToLoad;
+	TArray<TPair<UPrimitiveComponent*, FglTFRuntimeNode>> MeshesToLoad;
+	int32 NextMeshToLoad;
 
-	void LoadNextMeshAsync();
+	UPROPERTY()
+	TArray<UglTFRuntimeAssetActorAsyncMeshRequest*> InFlightMeshRequests;
 
-	UFUNCTION()
-	void LoadStaticMeshAsync(UStaticMesh* StaticMesh);
+	UPROPERTY()
+	TArray<UglTFRuntimeAssetActorAsyncMeshRequest*> LoadedMeshRequests;
 
-	UFUNCTION()
-	void LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh);
+	void LoadNextMeshAsync();
 
-	// this is safe to share between game and async threads because everything is sequential
-	UPrimitiveComponent* CurrentPrimitiveComponent;
+	void FinalizeMeshRequest(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest);
 
 	double LoadingStartTime;
 
@@ -0,0 +1,115 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
+
+/**
+ * Cache whose values are built only once, even when the same key is requested by multiple threads at the same time
+ * (the other threads wait for the first one to complete). Values are heap allocated, so the returned pointers
+ * stay valid until the key is removed.
+ */
+template<typename KeyType, typename ValueType>
+class TglTFRuntimeConcurrentCache
+{
+public:
+	/**
+	 * Returns the cached value, or runs Initializer on a default constructed value.
+	 * A failing Initializer returns nullptr and does not cache anything, so the next request will try again.
+	 */
+	ValueType* FindOrInit(const KeyType& Key, TFunctionRef<bool(ValueType&)> Initializer)
+	{
+		TSharedPtr<FSlot, ESPMode::ThreadSafe> Slot = FindSlot(Key);
+		if (!Slot)
+		{
+			FWriteScopeLock WriteLock(SlotsLock);
+			TSharedPtr<FSlot, ESPMode::ThreadSafe>& NewSlot = Slots.FindOrAdd(Key);
+			if (!NewSlot)
+			{
+				NewSlot = MakeShared<FSlot, ESPMode::ThreadSafe>();
+			}
+			Slot = NewSlot;
+		}
+
+		if (Slot->bInitialized)
+		{
+			return &Slot->Value;
+		}
+
+		FScopeLock InitLock(&Slot->InitLock);
+		if (!Slot->bInitialized)
+		{
+			Slot->Value = ValueType();
+			if (!Initializer(Slot->Value))
+			{
+				return nullptr;
+			}
+			Slot->bInitialized = true;
+		}
+
+		return &Slot->Value;
+	}
+
+	// adds the value only if the key is not already cached, returns false otherwise
+	bool Add(const KeyType& Key, ValueType&& Value)
+	{
+		bool bAdded = false;
+		FindOrInit(Key, [&](ValueType& NewValue)
+			{
+				NewValue = MoveTemp(Value);
+				bAdded = true;
+				return true;
+			});
+		return bAdded;
+	}
+
+	ValueType* Find(const KeyType& Key) const
+	{
+		TSharedPtr<FSlot, ESPMode::ThreadSafe> Slot = FindSlot(Key);
+		if (Slot && Slot->bInitialized)
+		{
+			return &Slot->Value;
+		}
+		return nullptr;
+	}
+
+	bool Contains(const KeyType& Key) const
+	{
+		return Find(Key) != nullptr;
+	}
+
+	bool Remove(const KeyType& Key)
+	{
+		FWriteScopeLock WriteLock(SlotsLock);
+		return Slots.Remove(Key) > 0;
+	}
+
+	void Empty()
+	{
+		FWriteScopeLock WriteLock(SlotsLock);
+		Slots.Empty();
+	}
+
+private:
+	struct FSlot
+	{
+		FCriticalSection InitLock;
+		std::atomic<bool> bInitialized{ false };
+		ValueType Value;
+	};
+
+	TSharedPtr<FSlot, ESPMode::ThreadSafe> FindSlot(const KeyType& Key) const
+	{
+		FReadScopeLock ReadLock(SlotsLock);
+		if (const TSharedPtr<FSlot, ESPMode::ThreadSafe>* Slot = Slots.Find(Key))
+		{
+			return *Slot;
+		}
+		return nullptr;
+	}
+
+	mutable FRWLock SlotsLock;
+	TMap<KeyType, TSharedPtr<FSlot, ESPMode::ThreadSafe>> Slots;
+};
@@ -0,0 +1,80 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Containers/Ticker.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("glTFRuntime"), STATGROUP_glTFRuntime, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalization Queue Tick"), STAT_glTFRuntime_FinalizationQueueTick, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize StaticMesh Resources"), STAT_glTFRuntime_FinalizeStaticMeshResources, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize StaticMesh Collisions"), STAT_glTFRuntime_FinalizeStaticMeshCollisions, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize StaticMesh Sockets"), STAT_glTFRuntime_FinalizeStaticMeshSockets, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize StaticMesh Navigation"), STAT_glTFRuntime_FinalizeStaticMeshNavigation, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize SkeletalMesh LODs"), STAT_glTFRuntime_FinalizeSkeletalMeshLODs, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize SkeletalMesh MorphTargets"), STAT_glTFRuntime_FinalizeSkeletalMeshMorphTargets, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize SkeletalMesh PhysicsAsset"), STAT_glTFRuntime_FinalizeSkeletalMeshPhysicsAsset, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize SkeletalMesh Resources"), STAT_glTFRuntime_FinalizeSkeletalMeshResources, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Finalization Steps"), STAT_glTFRuntime_PendingFinalizationSteps, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Finalization Steps per Frame"), STAT_glTFRuntime_FinalizationStepsPerFrame, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+
+struct FglTFRuntimeFinalizationStep
+{
+	const TCHAR* Name;
+	TFunction<void()> Function;
+
+	FglTFRuntimeFinalizationStep(const TCHAR* InName, TFunction<void()>&& InFunction) : Name(InName), Function(MoveTemp(InFunction))
+	{
+	}
+};
+
+/**
+ * Game thread queue running the finalization of async loaded assets as a sequence of resumable steps.
+ * Every frame steps are consumed (always at least one) until the budget set with glTFRuntime.FinalizationBudget
+ * is exhausted, so that big meshes are spread over multiple frames instead of hitching a single one.
+ */
+class GLTFRUNTIME_API FglTFRuntimeFinalizationQueue
+{
+public:
+	static FglTFRuntimeFinalizationQueue& Get();
+
+	// can be called from any thread, steps of the same job are always run in order
+	void Enqueue(TArray<FglTFRuntimeFinalizationStep>&& Steps);
+
+	void Startup();
+	void Shutdown();
+
+	// runs all of the pending steps in the current frame
+	void Flush();
+
+	// game thread only
+	int32 GetNumPendingJobs() const;
+
+protected:
+	struct FJob
+	{
+		TArray<FglTFRuntimeFinalizationStep> Steps;
+		int32 NextStep = 0;
+	};
+
+	bool Tick(float DeltaTime);
+	void RunStep(FJob& Job);
+	void DrainIncomingJobs();
+
+	bool bStarted = false;
+
+	mutable FCriticalSection IncomingJobsLock;
+	TArray<FJob> IncomingJobs;
+
+	// game thread only
+	TArray<FJob> Jobs;
+
+#if ENGINE_MAJOR_VERSION > 4
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+};
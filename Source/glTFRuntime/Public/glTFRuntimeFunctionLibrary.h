@@ -101,4 +101,10 @@ public:
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create 1D BlendSpace"), Category = "glTFRuntime")
 	static UBlendSpace1D* CreateRuntimeBlendSpace1D(const FString& ParameterName, const float Min, const float Max, const TArray<FglTFRuntimeBlendSpaceSample>& Samples);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Create glTF Runtime Cancellation Token"), Category = "glTFRuntime")
+	static UglTFRuntimeCancellationToken* glTFCreateCancellationToken();
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get glTF Runtime Async Tasks Counters"), Category = "glTFRuntime")
+	static void glTFGetAsyncTasksCounters(int32& NumQueuedTasks, int32& NumInFlightTasks);
 };
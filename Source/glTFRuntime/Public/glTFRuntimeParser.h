@@ -8,6 +8,7 @@
 #include "Animation/PoseAsset.h"
 #include "Animation/Skeleton.h"
 #include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
 #include "Async/ParallelFor.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
@@ -24,6 +25,9 @@
 #include "Components/AudioComponent.h"
 #include "Components/LightComponent.h"
 #include "glTFRuntimeAnimationCurve.h"
+#include "glTFRuntimeConcurrentCache.h"
+#include "glTFRuntimeFinalizationQueue.h"
+#include "glTFRuntimeTaskQueue.h"
 #include "ProceduralMeshComponent.h"
 #if WITH_EDITOR
 #include "Rendering/SkeletalMeshLODImporterData.h"
@@ -43,6 +47,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FglTFRuntimeOnSkeletalMeshCreated, U
 #define GLTFRUNTIME_IMAGE_API_1
 #define GLTFRUNTIME_HAS_BONE_REMAPPER_LOD
 
+struct FStaticMeshBuildVertex;
+struct FSkinWeightInfo;
+
 /*
 * Credits for giving me the idea for the blob structure
 * definitely go to Benjamin MICHEL (SBRK)
@@ -60,6 +67,40 @@ struct FglTFRuntimeBlob
 	}
 };
 
+/*
+* Accessors components decoding, specialized at compile time
+* for the normalized integer types.
+*/
+template<typename ComponentType, bool bNormalized>
+struct TglTFRuntimeAccessorComponent
+{
+	static FORCEINLINE ComponentType Decode(const ComponentType Value) { return Value; }
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<int8, true>
+{
+	static FORCEINLINE float Decode(const int8 Value) { return FMath::Max(((float)Value) / 127.f, -1.f); }
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<uint8, true>
+{
+	static FORCEINLINE float Decode(const uint8 Value) { return ((float)Value) / 255.f; }
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<int16, true>
+{
+	static FORCEINLINE float Decode(const int16 Value) { return FMath::Max(((float)Value) / 32767.f, -1.f); }
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<uint16, true>
+{
+	static FORCEINLINE float Decode(const uint16 Value) { return ((float)Value) / 65535.f; }
+};
+
 UENUM()
 enum class EglTFRuntimeTransformBaseType : uint8
 {
@@ -260,6 +301,27 @@ struct FglTFRuntimeConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeAESDecrypterHook AESDecrypterHook;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bMemoryMapFile;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bIndexJsonTables;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bStreamZipFromFile;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bPrefetchBuffers;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bPrefetchCompressedBufferViews;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeTaskPriority AsyncPriority;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	UglTFRuntimeCancellationToken* CancellationToken;
+
 	FglTFRuntimeConfig()
 	{
 		TransformBaseType = EglTFRuntimeTransformBaseType::Default;
@@ -274,6 +336,13 @@ struct FglTFRuntimeConfig
 		bAsBlob = false;
 		PrefixForUnnamedNodes = "node";
 		bNoArchive = false;
+		bMemoryMapFile = false;
+		bIndexJsonTables = false;
+		bStreamZipFromFile = false;
+		bPrefetchBuffers = false;
+		bPrefetchCompressedBufferViews = false;
+		AsyncPriority = EglTFRuntimeTaskPriority::Normal;
+		CancellationToken = nullptr;
 	}
 
 	FMatrix GetMatrix() const
@@ -467,6 +536,18 @@ struct FglTFRuntimeMorphTarget
 	TArray<FVector> Normals;
 };
 
+// block compression format used by bCompressMips (Auto picks BC5 for normal maps, BC4 for grayscale, BC7 for TC_BC7 and BC1/BC3 for everything else)
+UENUM()
+enum class EglTFRuntimeBlockCompression : uint8
+{
+	Auto,
+	BC1,
+	BC3,
+	BC4,
+	BC5,
+	BC7
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeImagesConfig
 {
@@ -496,6 +577,9 @@ struct FglTFRuntimeImagesConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bCompressMips;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeBlockCompression BlockCompression;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bStreaming;
 
@@ -518,6 +602,7 @@ struct FglTFRuntimeImagesConfig
 		bVerticalFlip = false;
 		bForceHDR = false;
 		bCompressMips = false;
+		BlockCompression = EglTFRuntimeBlockCompression::Auto;
 		bStreaming = false;
 		LODBias = 0;
 		bForceAutoDetect = false;
@@ -721,6 +806,15 @@ struct FglTFRuntimeMaterialsConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bForceEmptyMaterialNameToMaterialIndex;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bDecodeTexturesInParallel;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeTaskPriority AsyncPriority;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	UglTFRuntimeCancellationToken* CancellationToken;
+
 	FglTFRuntimeMaterialsConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -743,6 +837,9 @@ struct FglTFRuntimeMaterialsConfig
 		LinesScaleFactor = 1;
 		bAddEpicInterchangeParams = false;
 		bForceEmptyMaterialNameToMaterialIndex = false;
+		bDecodeTexturesInParallel = true;
+		AsyncPriority = EglTFRuntimeTaskPriority::Normal;
+		CancellationToken = nullptr;
 	}
 };
 
@@ -805,6 +902,10 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bUseHighPrecisionUVs;
 
+	// every additional channel grows the vertex buffer, so only TEXCOORD_0 and TEXCOORD_1 are used by default (up to MAX_STATIC_TEXCOORDS)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 MaxUVChannels;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bGenerateStaticMeshDescription;
 
@@ -842,6 +943,27 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bUseHighPrecisionTangentBasis;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bCompactVertexStreams;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bWeldVertices;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldVerticesTolerance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexCache;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float OverdrawOptimizationThreshold;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeTaskPriority AsyncPriority;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	UglTFRuntimeCancellationToken* CancellationToken;
+
 	FglTFRuntimeStaticMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -856,11 +978,19 @@ struct FglTFRuntimeStaticMeshConfig
 		TangentsGenerationStrategy = EglTFRuntimeTangentsGenerationStrategy::IfMissing;
 		bReverseTangents = false;
 		bUseHighPrecisionUVs = false;
+		MaxUVChannels = 2;
 		bGenerateStaticMeshDescription = false;
 		bBuildNavCollision = false;
 		LODScreenSizeMultiplier = 2;
 		bBuildLumenCards = false;
 		bUseHighPrecisionTangentBasis = false;
+		bCompactVertexStreams = false;
+		bWeldVertices = false;
+		WeldVerticesTolerance = 0;
+		bOptimizeVertexCache = false;
+		OverdrawOptimizationThreshold = 1.05f;
+		AsyncPriority = EglTFRuntimeTaskPriority::Normal;
+		CancellationToken = nullptr;
 	}
 };
 
@@ -1320,6 +1450,28 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeMorphTargetRemapperHook MorphTargetRemapper;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bWeldVertices;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldVerticesTolerance;
+
+	// UV channels whose float data switches the mesh to full precision UVs (empty for all of them)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	TArray<int32> HighPrecisionUVChannels;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexCache;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float OverdrawOptimizationThreshold;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeTaskPriority AsyncPriority;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	UglTFRuntimeCancellationToken* CancellationToken;
+
 	FglTFRuntimeSkeletalMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -1347,6 +1499,12 @@ struct FglTFRuntimeSkeletalMeshConfig
 		bAutoGeneratePhysicsAssetConstraints = false;
 		bAllowCPUAccess = false;
 		bUseHighPrecisionTangentBasis = false;
+		bWeldVertices = false;
+		WeldVerticesTolerance = 0;
+		bOptimizeVertexCache = false;
+		OverdrawOptimizationThreshold = 1.05f;
+		AsyncPriority = EglTFRuntimeTaskPriority::Normal;
+		CancellationToken = nullptr;
 	}
 };
 
@@ -1495,6 +1653,18 @@ struct FglTFRuntimeSkeletalAnimationConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeSkeletalAnimationFrameMorphTargetWeightRemapperHook FrameMorphTargetWeightRemapper;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bQuantizeBoneTracks;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float QuantizeTranslationTolerance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float QuantizeRotationTolerance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float QuantizeScaleTolerance;
+
 	FglTFRuntimeSkeletalAnimationConfig()
 	{
 		RootNodeIndex = INDEX_NONE;
@@ -1512,6 +1682,10 @@ struct FglTFRuntimeSkeletalAnimationConfig
 		RetargetToSkeletalMesh = nullptr;
 		RetargetSkinIndex = INDEX_NONE;
 		PoseForRetargeting = nullptr;
+		bQuantizeBoneTracks = false;
+		QuantizeTranslationTolerance = 0.01f;
+		QuantizeRotationTolerance = 0.05f;
+		QuantizeScaleTolerance = 0.001f;
 	}
 };
 
@@ -1565,6 +1739,42 @@ struct FglTFRuntimeUInt16Vector4
 	}
 };
 
+// post-transform vertex cache efficiency (ACMR: transformed vertices per triangle, ATVR: transformed vertices per unique vertex)
+struct FglTFRuntimeVertexCacheStats
+{
+	int64 NumTriangles = 0;
+	int64 NumVertices = 0;
+	int64 NumTransformedVertices = 0;
+
+	float GetACMR() const
+	{
+		return NumTriangles > 0 ? static_cast<float>(NumTransformedVertices) / NumTriangles : 0;
+	}
+
+	float GetATVR() const
+	{
+		return NumVertices > 0 ? static_cast<float>(NumTransformedVertices) / NumVertices : 0;
+	}
+
+	void Append(const FglTFRuntimeVertexCacheStats& Other)
+	{
+		NumTriangles += Other.NumTriangles;
+		NumVertices += Other.NumVertices;
+		NumTransformedVertices += Other.NumTransformedVertices;
+	}
+};
+
+// single precision types matching the vertex buffers layout
+#if ENGINE_MAJOR_VERSION > 4
+typedef FVector2f FglTFRuntimeCompactVector2;
+typedef FVector3f FglTFRuntimeCompactVector3;
+typedef FVector4f FglTFRuntimeCompactVector4;
+#else
+typedef FVector2D FglTFRuntimeCompactVector2;
+typedef FVector FglTFRuntimeCompactVector3;
+typedef FVector4 FglTFRuntimeCompactVector4;
+#endif
+
 struct FglTFRuntimePrimitive
 {
 	TArray<FVector> Positions;
@@ -1577,6 +1787,12 @@ struct FglTFRuntimePrimitive
 	TArray<TArray<FVector4>> Weights;
 	TArray<FVector4> Colors;
 	TArray<FglTFRuntimeMorphTarget> MorphTargets;
+	// when bCompactVertexStreams is true, vertex attributes are stored here (in the final vertex buffer format) instead of Positions/Normals/Tangents/UVs/Colors
+	TArray<FglTFRuntimeCompactVector3> CompactPositions;
+	TArray<FglTFRuntimeCompactVector3> CompactNormals;
+	TArray<FglTFRuntimeCompactVector4> CompactTangents;
+	TArray<TArray<FglTFRuntimeCompactVector2>> CompactUVs;
+	TArray<FColor> CompactColors;
 	TMap<int32, FName> OverrideBoneMap;
 	TMap<int32, int32> BonesCache;
 	FString MaterialName;
@@ -1584,10 +1800,34 @@ struct FglTFRuntimePrimitive
 	int32 Mode;
 	bool bHasMaterial;
 	bool bHighPrecisionUVs;
+	// one entry per UVs channel, true when loaded from float data
+	TArray<bool> HighPrecisionUVChannels;
 	bool bHighPrecisionWeights;
 
 	bool bDisableShadows;
 	bool bHasIndices;
+	bool bCompactVertexStreams;
+
+	int32 GetNumVertices() const
+	{
+		return bCompactVertexStreams ? CompactPositions.Num() : Positions.Num();
+	}
+
+	int32 GetNumUVs() const
+	{
+		return bCompactVertexStreams ? CompactUVs.Num() : UVs.Num();
+	}
+
+	bool HasColors() const
+	{
+		return bCompactVertexStreams ? CompactColors.Num() > 0 : Colors.Num() > 0;
+	}
+
+	// primitives not built from glTF accessors only have the global flag
+	bool IsHighPrecisionUVChannel(const int32 UVIndex) const
+	{
+		return HighPrecisionUVChannels.IsValidIndex(UVIndex) ? HighPrecisionUVChannels[UVIndex] : bHighPrecisionUVs;
+	}
 
 	FglTFRuntimePrimitive()
 	{
@@ -1599,6 +1839,7 @@ struct FglTFRuntimePrimitive
 		Mode = 4;
 		bDisableShadows = false;
 		bHasIndices = false;
+		bCompactVertexStreams = false;
 	}
 };
 
@@ -1620,6 +1861,24 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 
 	FBox BoundingBox;
 
+	// vertex cache statistics of the optimized sections (when bOptimizeVertexCache is enabled)
+	FglTFRuntimeVertexCacheStats VertexCacheStatsBefore;
+	FglTFRuntimeVertexCacheStats VertexCacheStatsAfter;
+
+	// vertices statistics of the welded sections (when bWeldVertices is enabled)
+	int32 NumVerticesBeforeWelding = 0;
+	int32 NumVerticesAfterWelding = 0;
+
+	// morph target deltas emitted and the zero ones dropped from them
+	int32 NumMorphTargetDeltas = 0;
+	int32 NumDroppedMorphTargetDeltas = 0;
+
+	// set by the LODs finalization step
+	bool bHasMorphTargets = false;
+
+	// from the SkeletalMeshConfig CancellationToken, safe to check from any thread
+	FglTFRuntimeCancellationFlagPtr CancellationFlag;
+
 	TMap<int32, FBox> PerBoneBoundingBoxCache;
 
 	// here we cache per-context LODs
@@ -1633,6 +1892,8 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 
 	FglTFRuntimeSkeletalMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const int32 InMeshIndex, const FglTFRuntimeSkeletalMeshConfig& InSkeletalMeshConfig) : Parser(InParser), SkeletalMeshConfig(InSkeletalMeshConfig), MeshIndex(InMeshIndex)
 	{
+		CancellationFlag = UglTFRuntimeCancellationToken::GetTokenFlag(InSkeletalMeshConfig.CancellationToken);
+
 		EObjectFlags Flags = RF_Public;
 		UObject* Outer = InSkeletalMeshConfig.Outer ? InSkeletalMeshConfig.Outer : GetTransientPackage();
 #if WITH_EDITOR
@@ -1765,6 +2026,33 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 		return ContextLODs[NewIndex];
 	}
 
+	bool IsContextLOD(const FglTFRuntimeMeshLOD* LOD) const
+	{
+		return (LOD >= ContextLODs.GetData() && LOD < ContextLODs.GetData() + ContextLODs.Num()) ||
+			(LOD >= CachedRuntimeMeshLODs.GetData() && LOD < CachedRuntimeMeshLODs.GetData() + CachedRuntimeMeshLODs.Num());
+	}
+
+	// the LODs from the parser cache are shared between concurrent loaders, so the context mutates its own copy
+	void CopyLODsToContext()
+	{
+		for (int32 LODIndex = 0; LODIndex < LODs.Num(); LODIndex++)
+		{
+			if (IsContextLOD(LODs[LODIndex]))
+			{
+				continue;
+			}
+
+			const FglTFRuntimeMeshLOD LODCopy = *LODs[LODIndex];
+			const int32 NewIndex = ContextLODs.Add(LODCopy);
+			ContextLODsMap.Add(NewIndex, LODIndex);
+			// rebuild ContextLODs pointers (as they could have changed)
+			for (const TPair<int32, int32>& Pair : ContextLODsMap)
+			{
+				LODs[Pair.Value] = &ContextLODs[Pair.Key];
+			}
+		}
+	}
+
 	bool BoneHasChildren(const int32 BoneIndex) const
 	{
 		const int32 NumBones = GetNumBones();
@@ -1793,6 +2081,9 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 	}
 
 	const FBox& GetBoneBox(const int32 BoneIndex);
+
+	// fills PerBoneBoundingBoxCache for all of the bones with a single pass over the LOD0 vertices
+	void BuildBoneBoxes();
 };
 
 USTRUCT(BlueprintType)
@@ -1843,6 +2134,17 @@ struct FglTFRuntimeStaticMeshContext : public FGCObject
 	FVector LOD0PivotDelta = FVector::ZeroVector;
 	TArray<FStaticMaterial> StaticMaterials;
 
+	// from the StaticMeshConfig CancellationToken, safe to check from any thread
+	FglTFRuntimeCancellationFlagPtr CancellationFlag;
+
+	// vertices statistics of the welded sections (when bWeldVertices is enabled)
+	int32 NumVerticesBeforeWelding = 0;
+	int32 NumVerticesAfterWelding = 0;
+
+	// vertex cache statistics of the optimized sections (when bOptimizeVertexCache is enabled)
+	FglTFRuntimeVertexCacheStats VertexCacheStatsBefore;
+	FglTFRuntimeVertexCacheStats VertexCacheStatsAfter;
+
 	TMap<FString, FTransform> AdditionalSockets;
 	TArray<FglTFRuntimeMeshLOD> ContextLODs;
 	TMap<int32, int32> ContextLODsMap;
@@ -2188,6 +2490,9 @@ public:
 
 	virtual bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) = 0;
 
+	// true if GetFileContent() can be called concurrently from worker threads
+	virtual bool SupportsConcurrentReads() const { return true; }
+
 	bool FileExists(const FString& Filename) const;
 
 	FString GetFirstFilenameByExtension(const FString& Extension) const;
@@ -2211,14 +2516,134 @@ public:
 
 	void SetPassword(const FString& EncryptionKey);
 
+	void ApplyLoaderConfig(const FglTFRuntimeConfig& LoaderConfig);
+
+	bool SupportsConcurrentReads() const override;
+
 	FglTFRuntimePasswordPromptHook PromptHook;
 	FglTFRuntimeAESDecrypterHook AESDecrypterHook;
 
 protected:
+	bool ParseCentralDirectory();
+
+	virtual int64 GetArchiveSize() const;
+	// OutPtr is valid until Storage is destroyed (Storage can be left empty for zero-copy access)
+	virtual bool ReadArchive(const int64 Offset, const int64 Size, TArray64<uint8>& Storage, const uint8*& OutPtr);
+
 	FArrayReader Data;
 	TArray<uint8> Password;
 };
 
+/*
+* Zip archive backed by a file: only the central directory is read
+* at load time, entries are read (and inflated) on demand.
+*/
+class GLTFRUNTIME_API FglTFRuntimeArchiveZipFile : public FglTFRuntimeArchiveZip
+{
+public:
+	bool FromFilename(const FString& Filename);
+
+protected:
+	int64 GetArchiveSize() const override;
+	bool ReadArchive(const int64 Offset, const int64 Size, TArray64<uint8>& Storage, const uint8*& OutPtr) override;
+
+	TUniquePtr<FArchive> FileReader;
+	FCriticalSection FileReaderLock;
+	int64 FileSize = 0;
+};
+
+/*
+* Flat, already validated, views of the accessors and bufferViews json objects.
+* They are built once at load time (see FglTFRuntimeConfig::bIndexJsonTables)
+* to avoid walking the json graph in hot paths.
+*/
+struct FglTFRuntimeAccessorRecord
+{
+	bool bValid;
+	int64 BufferView;
+	int64 ByteOffset;
+	int64 ComponentType;
+	int64 Count;
+	int64 Elements;
+	int64 ElementSize;
+	bool bHasNormalized;
+	bool bNormalized;
+	TSharedPtr<FJsonObject> JsonSparseObject;
+
+	FglTFRuntimeAccessorRecord()
+	{
+		bValid = false;
+		BufferView = INDEX_NONE;
+		ByteOffset = 0;
+		ComponentType = 0;
+		Count = 0;
+		Elements = 0;
+		ElementSize = 0;
+		bHasNormalized = false;
+		bNormalized = false;
+	}
+};
+
+struct FglTFRuntimeBufferViewRecord
+{
+	bool bValid;
+	int64 Buffer;
+	int64 ByteOffset;
+	int64 ByteLength;
+	int64 ByteStride;
+	bool bMeshOptCompressed;
+	int64 MeshOptCount;
+	FString MeshOptMode;
+	FString MeshOptFilter;
+
+	FglTFRuntimeBufferViewRecord()
+	{
+		bValid = false;
+		Buffer = INDEX_NONE;
+		ByteOffset = 0;
+		ByteLength = 0;
+		ByteStride = 0;
+		bMeshOptCompressed = false;
+		MeshOptCount = 0;
+	}
+};
+
+/*
+* Decoded (meshopt compressed or sparse) data, cached per buffer view/accessor index.
+*/
+struct FglTFRuntimeDecodedBuffer
+{
+	TArray64<uint8> Data;
+	int64 Stride;
+
+	FglTFRuntimeDecodedBuffer()
+	{
+		Stride = 0;
+	}
+};
+
+/*
+* Read-only memory mapping of a file, buffers can be directly
+* referenced by blobs without copying them in memory.
+*/
+class GLTFRUNTIME_API FglTFRuntimeMappedFile
+{
+public:
+	static TSharedPtr<FglTFRuntimeMappedFile> Open(const FString& Filename);
+
+	const uint8* GetData() const { return Data; }
+	int64 Num() const { return DataNum; }
+
+	FglTFRuntimeBlob GetBlob() const;
+
+protected:
+	TUniquePtr<IMappedFileHandle> Handle;
+	// the region must be released before the handle
+	TUniquePtr<IMappedFileRegion> Region;
+	const uint8* Data = nullptr;
+	int64 DataNum = 0;
+};
+
 class FglTFRuntimeArchiveMap : public FglTFRuntimeArchive
 {
 public:
@@ -2351,8 +2776,10 @@ public:
 	static TSharedPtr<FglTFRuntimeParser> FromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig);
 	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromUTF8(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig);
 	static TSharedPtr<FglTFRuntimeParser> FromMap(const TMap<FString, TArray64<uint8>> Map, const FglTFRuntimeConfig& LoaderConfig);
+	static TSharedPtr<FglTFRuntimeParser> FromMappedFile(TSharedRef<FglTFRuntimeMappedFile> InMappedFile, const FglTFRuntimeConfig& LoaderConfig);
 
 	static TSharedPtr<FglTFRuntimeParser> FromRawDataAndArchive(const uint8* DataPtr, int64 DataNum, TSharedPtr<FglTFRuntimeArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig);
 
@@ -2437,6 +2864,12 @@ public:
 	TArray<UglTFRuntimeAnimationCurve*> LoadAllNodeAnimationCurves(const int32 NodeIndex);
 
 	bool GetBuffer(const int32 BufferIndex, FglTFRuntimeBlob& Blob);
+	// drop a cached buffer (blobs previously returned for it are no more valid), it will be reloaded on demand
+	bool ReleaseBuffer(const int32 BufferIndex);
+	// concurrently load all of the not yet cached buffers (data uris, archive entries and external files)
+	void PrefetchBuffers();
+	// concurrently decode all of the meshopt compressed buffer views whose buffer is already loaded
+	void PrefetchCompressedBufferViews();
 	bool GetBufferView(const int32 BufferViewIndex, FglTFRuntimeBlob& Blob, int64& Stride);
 	bool GetAccessor(const int32 AccessorIndex, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, const FglTFRuntimeBlob* AdditionalBufferView);
 
@@ -2460,8 +2893,27 @@ public:
 
 	void AddReferencedObjects(FReferenceCollector& Collector);
 
-	bool LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines);
-	bool LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines);
+	bool LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, const bool bCompactVertexStreams = false);
+	bool LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, const bool bCompactVertexStreams = false);
+	// reorder triangles for post-transform cache locality (indices are relative to the section vertices)
+	static void OptimizeVertexCache(uint32* Indices, const int32 NumIndices, const int32 NumVertices);
+	// reorder clusters of triangles (without degrading the vertex cache more than Threshold) for reducing overdraw
+	static void OptimizeOverdraw(uint32* Indices, const int32 NumIndices, const int32 NumVertices, TFunctionRef<FVector(const uint32)> GetPosition, const float Threshold);
+	// renumber vertices in order of first use, Remap maps the old vertex index to the new one
+	static void OptimizeVertexFetch(uint32* Indices, const int32 NumIndices, const int32 NumVertices, TArray<uint32>& Remap);
+	static FglTFRuntimeVertexCacheStats AnalyzeVertexCache(const uint32* Indices, const int32 NumIndices, const int32 NumVertices);
+	// merge the vertices of a section sharing position, normal, uvs, color (and skin weights if specified), returns the new number of vertices (packed at the start of the range)
+	// give every index its own copy of the vertex attributes (for flat normals generation), returns false on out of range indices
+	static bool UnweldPrimitive(FglTFRuntimePrimitive& Primitive);
+	static int32 WeldVertices(TArray<FStaticMeshBuildVertex>& Vertices, const int32 VertexBaseIndex, const int32 NumVertices, TArray<uint32>& Indices, const int32 IndexBaseIndex, const int32 NumIndices, const int32 NumUVs, const bool bHasVertexColors, const float Tolerance, TArray<FSkinWeightInfo>* SkinWeights = nullptr);
+	/**
+	 * Generates smooth normals (angle weighted face normals) and/or MikkTSpace-like tangents (angle weighted face tangents
+	 * projected on the vertex normal, with the handedness taken from the accumulated bitangents) for a section.
+	 * Faces are processed first, then every vertex gathers its corners, so no locking is required.
+	 */
+	static void GenerateNormalsAndTangents(TArray<FStaticMeshBuildVertex>& Vertices, const int32 VertexBaseIndex, const int32 NumVertices, const TArray<uint32>& Indices, const int32 IndexBaseIndex, const int32 NumIndices, const bool bGenerateNormals, const bool bGenerateTangents, const float TangentsDirection);
+
+	bool LoadPrimitiveCompactVertexStreams(TSharedRef<FJsonObject> JsonAttributesObject, FglTFRuntimePrimitive& Primitive, const TArray<int64>& SupportedPositionComponentTypes, const TArray<int64>& SupportedNormalComponentTypes, const TArray<int64>& SupportedTangentComponentTypes, const TArray<int64>& SupportedTexCoordComponentTypes, const bool bHasMeshQuantization);
 	UMaterialInterface* TriangulatePoints(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	UMaterialInterface* TriangulateLines(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	UMaterialInterface* TriangulatePointsAndLines(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
@@ -2469,7 +2921,7 @@ public:
 	void AddError(const FString& ErrorContext, const FString& ErrorMessage);
 	void ClearErrors();
 	bool HasErrors() const;
-	const TArray<FString>& GetErrors() const;
+	TArray<FString> GetErrors() const;
 
 	bool NodeIsBone(const int32 NodeIndex);
 
@@ -2489,12 +2941,31 @@ public:
 		BinaryBuffer = InBinaryBuffer;
 	}
 
+	void SetMappedBinaryBuffer(TSharedRef<FglTFRuntimeMappedFile> InMappedFile, const FglTFRuntimeBlob& InBinaryBlob)
+	{
+		MappedFile = InMappedFile;
+		MappedBinaryBlob = InBinaryBlob;
+	}
+
 	bool LoadStaticMeshIntoProceduralMeshComponent(const int32 MeshIndex, UProceduralMeshComponent* ProceduralMeshComponent, const FglTFRuntimeProceduralMeshConfig& ProceduralMeshConfig);
 
 	USkeletalMesh* FinalizeSkeletalMeshWithLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
+	TArray<FglTFRuntimeFinalizationStep> GetSkeletalMeshFinalizationSteps(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
+	void FinalizeSkeletalMeshLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
+	void FinalizeSkeletalMeshMorphTargets(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
+	void FinalizeSkeletalMeshPhysicsAsset(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
+	void FinalizeSkeletalMeshResources(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
 
 	UStaticMesh* FinalizeStaticMesh(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
 
+	// splits the finalization in steps run by the FglTFRuntimeFinalizationQueue, OnFinalized is called on the game thread after the last one
+	void FinalizeStaticMeshAsync(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext, TFunction<void()>&& OnFinalized);
+	TArray<FglTFRuntimeFinalizationStep> GetStaticMeshFinalizationSteps(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
+	void FinalizeStaticMeshResources(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
+	void FinalizeStaticMeshCollisions(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
+	void FinalizeStaticMeshSockets(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
+	void FinalizeStaticMeshNavigation(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
+
 	static TSharedPtr<FJsonValue> GetJSONObjectFromRelativePath(TSharedRef<FJsonObject> JsonObject, const TArray<FglTFRuntimePathItem>& Path);
 	TSharedPtr<FJsonValue> GetJSONObjectFromPath(const TArray<FglTFRuntimePathItem>& Path) const;
 
@@ -2527,6 +2998,8 @@ public:
 	bool LoadImage(const int32 ImageIndex, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig);
 	bool LoadImageFromBlob(const TArray64<uint8>& Blob, TSharedRef<FJsonObject> JsonImageObject, TArray64<uint8>& UncompressedBytes, int32& Width, int32& Height, EPixelFormat& PixelFormat, const FglTFRuntimeImagesConfig& ImagesConfig);
 	UTexture2D* BuildTexture(UObject* Outer, const TArray<FglTFRuntimeMipMap>& Mips, const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTextureSampler& Sampler);
+	// block compress 8 bits RGBA mips in place (in parallel over blocks and mips), returns false (leaving them untouched) when they cannot be compressed
+	static bool CompressMips(TArray<FglTFRuntimeMipMap>& Mips, const FglTFRuntimeImagesConfig& ImagesConfig);
 	UTextureCube* BuildTextureCube(UObject* Outer, const TArray<FglTFRuntimeMipMap>& MipsXP, const TArray<FglTFRuntimeMipMap>& MipsXN, const TArray<FglTFRuntimeMipMap>& MipsYP, const TArray<FglTFRuntimeMipMap>& MipsYN, const TArray<FglTFRuntimeMipMap>& MipsZP, const TArray<FglTFRuntimeMipMap>& MipsZN, const bool bAutoRotate, const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTextureSampler& Sampler);
 	UTexture2DArray* BuildTextureArray(UObject* Outer, const TArray<FglTFRuntimeMipMap>& Mips, const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTextureSampler& Sampler);
 	UVolumeTexture* BuildVolumeTexture(UObject* Outer, const TArray<FglTFRuntimeMipMap>& Mips, const int32 TileZ, const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTextureSampler& Sampler);
@@ -2578,12 +3051,16 @@ public:
 		TArray64<uint8> NewArray;
 		NewArray.Append(reinterpret_cast<const uint8*>(Data), Num);
 
-		int32 NewIndex = AdditionalBufferViewsData.Add(MoveTemp(NewArray));
-
 		FglTFRuntimeBlob Blob;
-		Blob.Data = AdditionalBufferViewsData[NewIndex].GetData();
+		Blob.Data = NewArray.GetData();
 		Blob.Num = Num;
 
+		{
+			// the heap allocation of NewArray is preserved by the move, so the blob is still valid
+			FWriteScopeLock WriteLock(AdditionalBufferViewsLock);
+			AdditionalBufferViewsData.Add(MoveTemp(NewArray));
+		}
+
 		AddAdditionalBufferView(Index, Name, Blob);
 	}
 
@@ -2665,9 +3142,12 @@ protected:
 	TMap<int32, UTexture2D*> TexturesCache;
 #endif
 
+	// buffers can be requested by multiple threads at the same time (e.g. async mesh loaders)
+	FRWLock BuffersCacheLock;
+	// serializes the loading of missing buffers (avoids reading the same file multiple times)
+	FCriticalSection BuffersLoadLock;
 	TMap<int32, TArray64<uint8>> BuffersCache;
-	TMap<int32, TArray64<uint8>> CompressedBufferViewsCache;
-	TMap<int32, int64> CompressedBufferViewsStridesCache;
+	TglTFRuntimeConcurrentCache<int32, FglTFRuntimeDecodedBuffer> CompressedBufferViewsCache;
 
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
 	TMap<TObjectPtr<UMaterialInterface>, FString> MaterialsNameCache;
@@ -2675,14 +3155,42 @@ protected:
 	TMap<UMaterialInterface*, FString> MaterialsNameCache;
 #endif
 
+	// materials and textures can be loaded by concurrent mesh loaders
+	FCriticalSection MaterialsCacheLock;
+	// static meshes, skeletons and skeletal meshes caches
+	FCriticalSection MeshesCacheLock;
+
+	// recursive, nodes are lazily loaded by concurrent mesh loaders too
+	FCriticalSection NodesCacheLock;
 	TArray<FglTFRuntimeNode> AllNodesCache;
 	bool bAllNodesCached;
 
-	TMap<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD> LODsCache;
+	TglTFRuntimeConcurrentCache<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD> LODsCache;
+	TglTFRuntimeConcurrentCache<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD> CompactLODsCache;
 
 	TArray64<uint8> BinaryBuffer;
 
-	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	// memory mapped GLB (the BIN chunk is referenced in place)
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile;
+	FglTFRuntimeBlob MappedBinaryBlob;
+	// memory mapped external buffers
+	TMap<int32, TSharedPtr<FglTFRuntimeMappedFile>> MappedBuffersCache;
+	bool bMemoryMapBuffers;
+
+	// flat tables of the json root (enabled by FglTFRuntimeConfig::bIndexJsonTables)
+	bool bJsonTablesIndexed;
+	TMap<FString, TArray<TSharedPtr<FJsonObject>>> RootObjectsTables;
+	TArray<FglTFRuntimeAccessorRecord> AccessorRecords;
+	TArray<FglTFRuntimeBufferViewRecord> BufferViewRecords;
+
+	void BuildJsonTables();
+	bool ParseAccessorRecord(TSharedRef<FJsonObject> JsonAccessorObject, FglTFRuntimeAccessorRecord& Record) const;
+	bool ParseBufferViewRecord(TSharedRef<FJsonObject> JsonBufferViewObject, FglTFRuntimeBufferViewRecord& Record) const;
+
+	static TSharedPtr<FglTFRuntimeParser> FromJsonObject(TSharedRef<FJsonObject> JsonObject, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive);
+	static bool GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, FglTFRuntimeBlob& JsonChunk, FglTFRuntimeBlob& BinaryChunk);
+
+	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bCompactVertexStreams = false);
 
 	UStaticMesh* LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
 	UMaterialInterface* LoadMaterial_Internal(const int32 Index, const FString& MaterialName, TSharedRef<FJsonObject> JsonMaterialObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors, UMaterialInterface* ForceBaseMaterial);
@@ -2719,7 +3227,7 @@ public:
 	bool CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) const;
 	bool CheckJsonRootIndex(const FString FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) const { return CheckJsonIndex(Root, FieldName, Index, JsonItems); }
 	TSharedPtr<FJsonObject> GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index) const;
-	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const { return GetJsonObjectFromIndex(Root, FieldName, Index); }
+	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const;
 	TSharedPtr<FJsonObject> GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index);
 	TSharedPtr<FJsonObject> GetJsonObjectFromRootExtensionIndex(const FString& ExtensionName, const FString& FieldName, const int32 Index) { return GetJsonObjectFromExtensionIndex(Root, ExtensionName, FieldName, Index); }
 	TArray<TSharedRef<FJsonObject>> GetJsonObjectArrayFromExtension(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName);
@@ -2752,7 +3260,7 @@ public:
 
 protected:
 
-	float FindBestFrames(const TArray<float>& FramesTimes, float WantedTime, int32& FirstIndex, int32& SecondIndex);
+	static float FindBestFrames(const TArray<float>& FramesTimes, float WantedTime, int32& FirstIndex, int32& SecondIndex);
 
 	void NormalizeSkeletonScale(FReferenceSkeleton& RefSkeleton);
 	void NormalizeSkeletonBoneScale(FReferenceSkeletonModifier& Modifier, const int32 BoneIndex, FVector BoneScale);
@@ -2788,6 +3296,7 @@ protected:
 #endif
 
 	TArray<FString> Errors;
+	mutable FCriticalSection ErrorsLock;
 
 	FString BaseDirectory;
 	FString BaseFilename;
@@ -2813,6 +3322,13 @@ public:
 
 	template<typename T, typename Callback>
 	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
+	{
+		return BuildConvertedFromAccessorField<T>(JsonObject, Name, Data, SupportedElements, SupportedTypes, Filter, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
+	}
+
+	// elements are decoded as T and then converted by Filter to the destination OutT type (this allows to directly decode into the final memory layout)
+	template<typename T, typename OutT, typename Callback>
+	bool BuildConvertedFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<OutT>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
 		int64 AccessorIndex;
 		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
@@ -2844,84 +3360,63 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		auto ComponentFloat = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = Ptr[i];
-				}
-			};
-
-		auto ComponentByte = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 127.f, -1.f) : Ptr[i];
-				}
-			};
-
-		auto ComponentUnsignedByte = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 255.f : Ptr[i];
-				}
-			};
-
-		auto ComponentShort = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 32767.f, -1.f) : Ptr[i];
-				}
-			};
-
-		auto ComponentUnsignedShort = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 65535.f : Ptr[i];
-				}
-			};
+		if (!IsAccessorComponentTypeDecodable(ComponentType))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			return false;
+		}
 
-		TFunction<void(const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)> ComponentFunction = nullptr;
+		Data.AddUninitialized(Count);
 
 		switch (ComponentType)
 		{
 		case(5126):// FLOAT
-			ComponentFunction = ComponentFloat;
+			DecodeAccessorElements<T, float, false>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
 			break;
 		case(5120):// BYTE
-			ComponentFunction = ComponentByte;
+			if (bNormalized)
+			{
+				DecodeAccessorElements<T, int8, true>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
+			}
+			else
+			{
+				DecodeAccessorElements<T, int8, false>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
+			}
 			break;
 		case(5121):// UNSIGNED_BYTE
-			ComponentFunction = ComponentUnsignedByte;
+			if (bNormalized)
+			{
+				DecodeAccessorElements<T, uint8, true>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
+			}
+			else
+			{
+				DecodeAccessorElements<T, uint8, false>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
+			}
 			break;
 		case(5122):// SHORT
-			ComponentFunction = ComponentShort;
+			if (bNormalized)
+			{
+				DecodeAccessorElements<T, int16, true>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
+			}
+			else
+			{
+				DecodeAccessorElements<T, int16, false>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
+			}
 			break;
 		case(5123):// UNSIGNED_SHORT
-			ComponentFunction = ComponentUnsignedShort;
+			if (bNormalized)
+			{
+				DecodeAccessorElements<T, uint16, true>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
+			}
+			else
+			{
+				DecodeAccessorElements<T, uint16, false>(Blob, Stride, Elements, Count, Data.GetData(), Filter);
+			}
 			break;
 		default:
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
-			return false;
+			break;
 		}
 
-		Data.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int64 ElementIndex)
-			{
-				int64 Index = ElementIndex * Stride;
-				T Value;
-				ComponentFunction(Elements, Index, Blob, Value, bNormalized);
-				Data[ElementIndex] = Filter(Value);
-			});
-
 		return true;
 	}
 
@@ -2958,70 +3453,137 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		auto ComponentFloat = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				Value = *Ptr;
-			};
-
-		auto ComponentByte = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 127.f, -1.f) : *Ptr;
-			};
-
-		auto ComponentUnsignedByte = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 255.f : *Ptr;
-			};
-
-		auto ComponentShort = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 32767.f, -1.f) : *Ptr;
-			};
-
-		auto ComponentUnsignedShort = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 65535.f : *Ptr;
-			};
+		if (!IsAccessorComponentTypeDecodable(ComponentType))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			return false;
+		}
 
-		TFunction<void(const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)> ComponentFunction = nullptr;
+		Data.AddUninitialized(Count);
 
 		switch (ComponentType)
 		{
 		case(5126):// FLOAT
-			ComponentFunction = ComponentFloat;
+			DecodeAccessorScalars<T, float, false>(Blob, Stride, Count, Data.GetData(), Filter);
 			break;
 		case(5120):// BYTE
-			ComponentFunction = ComponentByte;
+			if (bNormalized)
+			{
+				DecodeAccessorScalars<T, int8, true>(Blob, Stride, Count, Data.GetData(), Filter);
+			}
+			else
+			{
+				DecodeAccessorScalars<T, int8, false>(Blob, Stride, Count, Data.GetData(), Filter);
+			}
 			break;
 		case(5121):// UNSIGNED_BYTE
-			ComponentFunction = ComponentUnsignedByte;
+			if (bNormalized)
+			{
+				DecodeAccessorScalars<T, uint8, true>(Blob, Stride, Count, Data.GetData(), Filter);
+			}
+			else
+			{
+				DecodeAccessorScalars<T, uint8, false>(Blob, Stride, Count, Data.GetData(), Filter);
+			}
 			break;
 		case(5122):// SHORT
-			ComponentFunction = ComponentShort;
+			if (bNormalized)
+			{
+				DecodeAccessorScalars<T, int16, true>(Blob, Stride, Count, Data.GetData(), Filter);
+			}
+			else
+			{
+				DecodeAccessorScalars<T, int16, false>(Blob, Stride, Count, Data.GetData(), Filter);
+			}
 			break;
 		case(5123):// UNSIGNED_SHORT
-			ComponentFunction = ComponentUnsignedShort;
+			if (bNormalized)
+			{
+				DecodeAccessorScalars<T, uint16, true>(Blob, Stride, Count, Data.GetData(), Filter);
+			}
+			else
+			{
+				DecodeAccessorScalars<T, uint16, false>(Blob, Stride, Count, Data.GetData(), Filter);
+			}
 			break;
 		default:
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
-			return false;
+			break;
 		}
 
-		Data.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int64 ElementIndex)
+		return true;
+	}
+
+	static bool IsAccessorComponentTypeDecodable(const int64 ComponentType)
+	{
+		return ComponentType == 5126 || ComponentType == 5120 || ComponentType == 5121 || ComponentType == 5122 || ComponentType == 5123;
+	}
+
+	// the number of components is a compile time constant for the common cases, allowing the inner loop to be fully unrolled and vectorized
+	template<typename T, typename ComponentType, int32 NumComponents, bool bNormalized, typename OutT, typename Callback>
+	static void DecodeAccessorElementsKernel(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const int64 Count, OutT* Data, Callback& Filter)
+	{
+		// number of elements decoded by each task (amortizes the scheduling overhead)
+		const int64 BatchSize = 1024;
+		const int32 NumBatches = static_cast<int32>((Count + BatchSize - 1) / BatchSize);
+		ParallelFor(NumBatches, [&](const int32 BatchIndex)
 			{
-				int64 Index = ElementIndex * Stride;
-				T Value;
-				ComponentFunction(Index, Blob, Value, bNormalized);
-				Data[ElementIndex] = Filter(Value);
+				const int64 FirstElement = BatchIndex * BatchSize;
+				const int64 LastElement = FMath::Min(FirstElement + BatchSize, Count);
+				const int64 Components = NumComponents > 0 ? NumComponents : Elements;
+				const uint8* ElementPtr = Blob.Data + FirstElement * Stride;
+				for (int64 ElementIndex = FirstElement; ElementIndex < LastElement; ElementIndex++, ElementPtr += Stride)
+				{
+					const ComponentType* Ptr = reinterpret_cast<const ComponentType*>(ElementPtr);
+					T Value;
+					for (int32 ComponentIndex = 0; ComponentIndex < Components; ComponentIndex++)
+					{
+						Value[ComponentIndex] = TglTFRuntimeAccessorComponent<ComponentType, bNormalized>::Decode(Ptr[ComponentIndex]);
+					}
+					Data[ElementIndex] = Filter(Value);
+				}
 			});
+	}
 
-		return true;
+	template<typename T, typename ComponentType, bool bNormalized, typename OutT, typename Callback>
+	static void DecodeAccessorElements(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const int64 Count, OutT* Data, Callback& Filter)
+	{
+		switch (Elements)
+		{
+		case(1):
+			DecodeAccessorElementsKernel<T, ComponentType, 1, bNormalized>(Blob, Stride, Elements, Count, Data, Filter);
+			break;
+		case(2):
+			DecodeAccessorElementsKernel<T, ComponentType, 2, bNormalized>(Blob, Stride, Elements, Count, Data, Filter);
+			break;
+		case(3):
+			DecodeAccessorElementsKernel<T, ComponentType, 3, bNormalized>(Blob, Stride, Elements, Count, Data, Filter);
+			break;
+		case(4):
+			DecodeAccessorElementsKernel<T, ComponentType, 4, bNormalized>(Blob, Stride, Elements, Count, Data, Filter);
+			break;
+		default:
+			DecodeAccessorElementsKernel<T, ComponentType, 0, bNormalized>(Blob, Stride, Elements, Count, Data, Filter);
+			break;
+		}
+	}
+
+	template<typename T, typename ComponentType, bool bNormalized, typename Callback>
+	static void DecodeAccessorScalars(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Count, T* Data, Callback& Filter)
+	{
+		// number of elements decoded by each task (amortizes the scheduling overhead)
+		const int64 BatchSize = 1024;
+		const int32 NumBatches = static_cast<int32>((Count + BatchSize - 1) / BatchSize);
+		ParallelFor(NumBatches, [&](const int32 BatchIndex)
+			{
+				const int64 FirstElement = BatchIndex * BatchSize;
+				const int64 LastElement = FMath::Min(FirstElement + BatchSize, Count);
+				const uint8* ElementPtr = Blob.Data + FirstElement * Stride;
+				for (int64 ElementIndex = FirstElement; ElementIndex < LastElement; ElementIndex++, ElementPtr += Stride)
+				{
+					T Value = TglTFRuntimeAccessorComponent<ComponentType, bNormalized>::Decode(*reinterpret_cast<const ComponentType*>(ElementPtr));
+					Data[ElementIndex] = Filter(Value);
+				}
+			});
 	}
 
 	template<typename T>
@@ -3036,6 +3598,50 @@ public:
 		return BuildFromAccessorField(JsonObject, Name, Data, SupportedTypes, [&](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
 	}
 
+	// binary search the keyframes surrounding WantedTime (relative to the first frame), returns the interpolation alpha
+	template<typename Callback>
+	static float FindBestFramesInTimeline(const int32 NumFrames, Callback GetFrameTime, const float WantedTime, int32& FirstIndex, int32& SecondIndex)
+	{
+		const float FirstTime = GetFrameTime(0);
+
+		// first frame whose time is not lower than WantedTime (nearly equal times are considered a match)
+		int32 Low = 0;
+		int32 High = NumFrames;
+		while (Low < High)
+		{
+			const int32 Middle = Low + (High - Low) / 2;
+			const float TimeValue = GetFrameTime(Middle) - FirstTime;
+			if (TimeValue < WantedTime && !FMath::IsNearlyEqual(TimeValue, WantedTime))
+			{
+				Low = Middle + 1;
+			}
+			else
+			{
+				High = Middle;
+			}
+		}
+
+		if (Low < NumFrames && FMath::IsNearlyEqual(GetFrameTime(Low) - FirstTime, WantedTime))
+		{
+			FirstIndex = Low;
+			SecondIndex = Low;
+			return 0;
+		}
+
+		// not found ? use the last value
+		SecondIndex = Low < NumFrames ? Low : NumFrames - 1;
+
+		if (SecondIndex == 0)
+		{
+			FirstIndex = 0;
+			return 1.f;
+		}
+
+		FirstIndex = SecondIndex - 1;
+
+		return ((WantedTime + FirstTime) - GetFrameTime(FirstIndex)) / (GetFrameTime(SecondIndex) - GetFrameTime(FirstIndex));
+	}
+
 	template<int32 Num, typename T>
 	bool GetJsonVector(const TArray<TSharedPtr<FJsonValue>>* JsonValues, T& Value)
 	{
@@ -3076,10 +3682,10 @@ protected:
 	FVector ComputeTangentYWithW(const FVector Normal, const FVector TangetX, const float W);
 
 	TArray64<uint8> ZeroBuffer;
-	TMap<int32, TArray64<uint8>> SparseAccessorsCache;
-	TMap<int32, int64> SparseAccessorsStridesCache;
+	TglTFRuntimeConcurrentCache<int32, FglTFRuntimeDecodedBuffer> SparseAccessorsCache;
 
-	TMap<int64, TMap<FString, FglTFRuntimeBlob>> AdditionalBufferViewsCache;
+	mutable FRWLock AdditionalBufferViewsLock;
+	TMap<int64, TMap<FString, TUniquePtr<FglTFRuntimeBlob>>> AdditionalBufferViewsCache;
 	TArray<TArray64<uint8>> AdditionalBufferViewsData;
 
 	FString DefaultPrefixForUnnamedNodes;
@@ -3091,21 +3697,31 @@ public:
 	TArray<FString> GetArchiveItems() const;
 	bool GetBlobByName(const FString& Name, TArray64<uint8>& Blob) const;
 
+	// the AsyncPriority and CancellationToken of the MaterialsConfig are honored (like the other runtime LOD async loaders)
 	template<typename FUNCTION>
-	void LoadAsRuntimeLODAsync(FUNCTION Function, const FglTFRuntimeMeshLODAsync& AsyncCallback)
+	void LoadAsRuntimeLODAsync(FUNCTION Function, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 	{
-		Async(EAsyncExecution::Thread, [Function, AsyncCallback]()
+		FglTFRuntimeTaskQueue::Get().Enqueue(MaterialsConfig.AsyncPriority, UglTFRuntimeCancellationToken::GetTokenFlag(MaterialsConfig.CancellationToken), [Function, AsyncCallback]()
 			{
 				FglTFRuntimeMeshLOD LOD;
 				bool bSuccess = Function(LOD);
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, &LOD, AsyncCallback]()
+				FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD = MoveTemp(LOD), AsyncCallback]()
 					{
 						AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? LOD : FglTFRuntimeMeshLOD());
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-			}
+			}, [AsyncCallback]()
+			{
+				FFunctionGraphTask::CreateAndDispatchWhenReady([AsyncCallback]()
+					{
+						AsyncCallback.ExecuteIfBound(false, FglTFRuntimeMeshLOD());
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+			});
+	}
 
-		);
+	template<typename FUNCTION>
+	void LoadAsRuntimeLODAsync(FUNCTION Function, const FglTFRuntimeMeshLODAsync& AsyncCallback)
+	{
+		LoadAsRuntimeLODAsync(Function, AsyncCallback, FglTFRuntimeMaterialsConfig());
 	}
 
 	TMap<FString, TSharedPtr<FglTFRuntimePluginCacheData>> PluginsCacheData;
@@ -0,0 +1,116 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Stats/Stats.h"
+#include "UObject/Object.h"
+#include "glTFRuntimeFinalizationQueue.h"
+#include <atomic>
+#include "glTFRuntimeTaskQueue.generated.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Queued Async Tasks"), STAT_glTFRuntime_QueuedTasks, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("In-Flight Async Tasks"), STAT_glTFRuntime_InFlightTasks, STATGROUP_glTFRuntime, GLTFRUNTIME_API);
+
+UENUM(BlueprintType)
+enum class EglTFRuntimeTaskPriority : uint8
+{
+	Low,
+	Normal,
+	High
+};
+
+class FglTFRuntimeCancellationFlag
+{
+public:
+	void Cancel()
+	{
+		bCancelled = true;
+	}
+
+	bool IsCancelled() const
+	{
+		return bCancelled;
+	}
+
+private:
+	std::atomic<bool> bCancelled{ false };
+};
+
+using FglTFRuntimeCancellationFlagPtr = TSharedPtr<FglTFRuntimeCancellationFlag, ESPMode::ThreadSafe>;
+
+/**
+ * Cancels the async loads it has been assigned to (via the CancellationToken field of the configs).
+ * Queued loads are discarded, already running loads skip their finalization. In both cases the
+ * callback is still triggered (with an invalid result).
+ */
+UCLASS(BlueprintType)
+class GLTFRUNTIME_API UglTFRuntimeCancellationToken : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UglTFRuntimeCancellationToken();
+
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	void Cancel();
+
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime")
+	bool IsCancelled() const;
+
+	FglTFRuntimeCancellationFlagPtr GetFlag() const { return Flag; }
+
+	static FglTFRuntimeCancellationFlagPtr GetTokenFlag(const UglTFRuntimeCancellationToken* CancellationToken)
+	{
+		return CancellationToken ? CancellationToken->GetFlag() : nullptr;
+	}
+
+protected:
+	FglTFRuntimeCancellationFlagPtr Flag;
+};
+
+/**
+ * Runs the glTFRuntime async loaders on a dedicated thread pool, with at most glTFRuntime.MaxConcurrentTasks tasks
+ * running at the same time. Higher priority tasks are always dequeued first.
+ */
+class GLTFRUNTIME_API FglTFRuntimeTaskQueue
+{
+public:
+	static FglTFRuntimeTaskQueue& Get();
+
+	void Startup();
+	void Shutdown();
+
+	// can be called from any thread, OnCancelled (if bound) is run on a worker thread when the task is cancelled before starting (or by Shutdown() for the still queued tasks)
+	void Enqueue(const EglTFRuntimeTaskPriority Priority, FglTFRuntimeCancellationFlagPtr CancellationFlag, TFunction<void()>&& Work, TFunction<void()>&& OnCancelled = nullptr);
+
+	int32 GetNumQueuedTasks() const;
+	int32 GetNumInFlightTasks() const;
+
+	static bool IsCancelled(FglTFRuntimeCancellationFlagPtr CancellationFlag)
+	{
+		return CancellationFlag.IsValid() && CancellationFlag->IsCancelled();
+	}
+
+protected:
+	struct FTask
+	{
+		FglTFRuntimeCancellationFlagPtr CancellationFlag;
+		TFunction<void()> Work;
+		TFunction<void()> OnCancelled;
+	};
+
+	int32 GetMaxConcurrentTasks() const;
+	void DispatchTasks();
+	void RunTask(FTask& Task);
+
+	mutable FCriticalSection TasksLock;
+	// one queue per EglTFRuntimeTaskPriority
+	TArray<FTask> Tasks[3];
+	int32 NumInFlightTasks = 0;
+
+	FQueuedThreadPool* ThreadPool = nullptr;
+	int32 NumThreads = 0;
+};
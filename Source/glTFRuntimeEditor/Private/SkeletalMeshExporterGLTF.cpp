@@ -88,9 +88,9 @@ void FglTFExportContextSkeletalMesh::GenerateSkeletalMesh(USkeletalMesh* Skeleta
 				TArray<uint16> SectionIndices;
 				for (uint32 IBIndex = 0; IBIndex < RenderSection.NumTriangles * 3; IBIndex += 3)
 				{
-					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseVertexIndex + IBIndex));
-					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseVertexIndex + IBIndex + 2));
-					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseVertexIndex + IBIndex + 1));
+					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseIndex + IBIndex));
+					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseIndex + IBIndex + 2));
+					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseIndex + IBIndex + 1));
 				}
 				IndexAccessor = AppendAccessor(5123, RenderSection.NumTriangles * 3, "SCALAR", (uint8*)SectionIndices.GetData(), (RenderSection.NumTriangles * 3) * sizeof(uint16));
 			}
@@ -99,9 +99,9 @@ void FglTFExportContextSkeletalMesh::GenerateSkeletalMesh(USkeletalMesh* Skeleta
 				TArray<uint32> SectionIndices;
 				for (uint32 IBIndex = 0; IBIndex < RenderSection.NumTriangles * 3; IBIndex += 3)
 				{
-					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseVertexIndex + IBIndex));
-					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseVertexIndex + IBIndex + 2));
-					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseVertexIndex + IBIndex + 1));
+					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseIndex + IBIndex));
+					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseIndex + IBIndex + 2));
+					SectionIndices.Add(RenderData->LODRenderData[LodIndex].MultiSizeIndexContainer.GetIndexBuffer()->Get(RenderSection.BaseIndex + IBIndex + 1));
 				}
 				IndexAccessor = AppendAccessor(5125, RenderSection.NumTriangles * 3, "SCALAR", (uint8*)SectionIndices.GetData(), (RenderSection.NumTriangles * 3) * sizeof(uint32));
 			}